@@ -22,6 +22,10 @@
 
 #include "achieve_condition_instruction.h"
 
+#include "building_block_factory.h"
+#include "instruction_attribute_utils.h"
+#include "log_forwarding_options.h"
+
 #include <sup/oac-tree/instruction_registry.h>
 #include <sup/oac-tree/instruction_utils.h>
 #include <sup/oac-tree/procedure_context.h>
@@ -38,23 +42,89 @@ static bool _achieve_condition_initialised_flag =
 const std::string LOG_MESSAGE_PREFIX =
   "Forwarded log message from internal instruction of AchieveCondition: ";
 
+const std::string EXECUTION_MODE_ATTRIBUTE = "executionMode";
+const std::string COMPOSED_EXECUTION_MODE = "composed";
+const std::string NATIVE_EXECUTION_MODE = "native";
+
 AchieveConditionInstruction::AchieveConditionInstruction()
   : CompoundInstruction(Type)
+  , m_metrics{}
   , m_internal_instruction_tree{}
   , m_instr_manager{}
-{}
+  , m_condition{nullptr}
+  , m_action{nullptr}
+  , m_action_finished{false}
+  , m_condition_debouncer{}
+  , m_lazy_setup{}
+{
+  (void)AddAttributeDefinition(EXECUTION_MODE_ATTRIBUTE);
+  (void)AddAttributeDefinition(LAZY_SETUP_ATTRIBUTE, sup::dto::BooleanType);
+  (void)AddAttributeDefinition(STABLE_FOR_ATTRIBUTE, sup::dto::Float64Type);
+  (void)AddAttributeDefinition(STABLE_COUNT_ATTRIBUTE, sup::dto::UnsignedInteger32Type);
+  (void)AddAttributeDefinition(LOG_QUEUE_SIZE_ATTRIBUTE, sup::dto::UnsignedInteger32Type);
+  (void)AddAttributeDefinition(LOG_OVERFLOW_POLICY_ATTRIBUTE);
+  (void)AddAttributeDefinition(LOG_DEDUP_WINDOW_ATTRIBUTE, sup::dto::Float64Type);
+}
 
 AchieveConditionInstruction::~AchieveConditionInstruction() = default;
 
+const ControlMetrics& AchieveConditionInstruction::GetControlMetrics() const
+{
+  return m_metrics;
+}
+
 void AchieveConditionInstruction::SetupImpl(const Procedure& proc)
 {
-  auto instr_tree = CreateWrappedInstructionTree();
-  std::swap(m_internal_instruction_tree, instr_tree);
-  m_internal_instruction_tree->Setup(proc);
+  m_metrics.SetTraceLabel(GetInstructionLabel(*this));
+  m_internal_instruction_tree.reset();
+  m_condition = nullptr;
+  m_action = nullptr;
+  m_action_finished = false;
+  m_instr_manager.SetLogForwardingOptions(GetLogForwardingOptions(*this));
+  if (ChildInstructions().size() != 2)
+  {
+    std::string error_message = InstructionErrorProlog(*this) +
+      "This compound instruction requires exactly two child instructions";
+    throw InstructionSetupException(error_message);
+  }
+  ConfigureConditionDebouncer(*this, m_condition_debouncer);
+  const bool debounced = m_condition_debouncer.IsEnabled();
+  auto execution_mode = GetStringAttribute(*this, EXECUTION_MODE_ATTRIBUTE,
+                                           debounced ? NATIVE_EXECUTION_MODE
+                                                     : COMPOSED_EXECUTION_MODE);
+  if (debounced && execution_mode == COMPOSED_EXECUTION_MODE)
+  {
+    std::string error_message = InstructionErrorProlog(*this) +
+      "Attributes [" + STABLE_FOR_ATTRIBUTE + "] and [" + STABLE_COUNT_ATTRIBUTE +
+      "] are not supported in execution mode [" + COMPOSED_EXECUTION_MODE + "]";
+    throw InstructionSetupException(error_message);
+  }
+  if (execution_mode == NATIVE_EXECUTION_MODE)
+  {
+    m_lazy_setup.Setup(*this, proc, [this](const Procedure& p) { SetupNative(p); });
+    return;
+  }
+  if (execution_mode != COMPOSED_EXECUTION_MODE)
+  {
+    std::string error_message = InstructionErrorProlog(*this) +
+      "Unknown execution mode [" + execution_mode + "], expected [" + COMPOSED_EXECUTION_MODE +
+      "] or [" + NATIVE_EXECUTION_MODE + "]";
+    throw InstructionSetupException(error_message);
+  }
+  m_lazy_setup.Setup(*this, proc, [this](const Procedure& p) { SetupComposed(p); });
 }
 
 ExecutionStatus AchieveConditionInstruction::ExecuteSingleImpl(UserInterface& ui, Workspace& ws)
 {
+  ScopedMetricsTimer tick_timer{m_metrics, ControlMetrics::Section::kTick};
+  if (!m_lazy_setup.Complete(ui))
+  {
+    return ExecutionStatus::FAILURE;
+  }
+  if (m_condition != nullptr)
+  {
+    return ExecuteNative(ui, ws);
+  }
   auto& wrapped_ui = m_instr_manager.GetWrappedUI(ui, LOG_MESSAGE_PREFIX);
   m_internal_instruction_tree->ExecuteSingle(wrapped_ui, ws);
   return m_internal_instruction_tree->GetStatus();
@@ -62,15 +132,27 @@ ExecutionStatus AchieveConditionInstruction::ExecuteSingleImpl(UserInterface& ui
 
 void AchieveConditionInstruction::ResetHook(UserInterface& ui)
 {
+  if (m_condition != nullptr)
+  {
+    ResetChildren(ui);
+    m_action_finished = false;
+    m_condition_debouncer.Reset();
+  }
   if (m_internal_instruction_tree)
   {
     auto& wrapped_ui = m_instr_manager.GetWrappedUI(ui, LOG_MESSAGE_PREFIX);
     m_internal_instruction_tree->Reset(wrapped_ui);
+    m_instr_manager.ReleaseRetiredUIs();
   }
 }
 
 void AchieveConditionInstruction::HaltImpl(UserInterface& ui)
 {
+  if (m_condition != nullptr)
+  {
+    m_condition->Halt(ui);
+    m_action->Halt(ui);
+  }
   if (m_internal_instruction_tree)
   {
     auto& wrapped_ui = m_instr_manager.GetWrappedUI(ui, LOG_MESSAGE_PREFIX);
@@ -88,33 +170,102 @@ std::unique_ptr<Instruction> AchieveConditionInstruction::CreateWrappedInstructi
       "This compound instruction requires exactly two child instructions";
     throw InstructionSetupException(error_message);
   }
+  return CreateAchieveConditionTree(m_instr_manager, *children[0], *children[1], m_metrics);
+}
 
+std::unique_ptr<Instruction> CreateAchieveConditionTree(WrappedInstructionManager& instr_manager,
+                                                        Instruction& condition,
+                                                        Instruction& action,
+                                                        ControlMetrics& metrics)
+{
   // Wrapped condition
-  auto cond_wrapper = m_instr_manager.CreateInstructionWrapper(*children[0]);
+  auto cond_wrapper = instr_manager.CreateMeasuredWrapper(condition, metrics,
+                                                          ControlMetrics::Section::kCondition);
 
   // Wrapped action
-  auto action_wrapper = m_instr_manager.CreateInstructionWrapper(*children[1]);
+  auto action_wrapper = instr_manager.CreateMeasuredWrapper(action, metrics,
+                                                            ControlMetrics::Section::kAction);
 
   // Ignore failure status of action
-  auto force_success = GlobalInstructionRegistry().Create("ForceSuccess");
+  auto force_success = CreateBuildingBlock(BuildingBlock::kForceSuccess);
   (void)force_success->InsertInstruction(std::move(action_wrapper), 0);
 
-  // Use a clone of the condition here.
-  auto cond_wrapper_2 = CloneInstructionTree(*children[0]);
+  // Re-check of the condition reuses the result of its last evaluation.
+  auto cond_wrapper_2 = instr_manager.CreateRecheckWrapper(condition);
 
   // Sequence combining action and recheck of condition
-  auto sequence = GlobalInstructionRegistry().Create("Sequence");
+  auto sequence = CreateBuildingBlock(BuildingBlock::kSequence);
   (void)sequence->InsertInstruction(std::move(force_success), 0);
   (void)sequence->InsertInstruction(std::move(cond_wrapper_2), 1);
 
   // Reactive fallback combining the condition and the sequence
-  auto fallback = GlobalInstructionRegistry().Create("ReactiveFallback");
+  auto fallback = CreateBuildingBlock(BuildingBlock::kReactiveFallback);
   (void)fallback->InsertInstruction(std::move(cond_wrapper), 0);
   (void)fallback->InsertInstruction(std::move(sequence), 1);
 
   return fallback;
 }
 
+void AchieveConditionInstruction::SetupComposed(const Procedure& proc)
+{
+  auto instr_tree = CreateWrappedInstructionTree();
+  std::swap(m_internal_instruction_tree, instr_tree);
+  m_internal_instruction_tree->Setup(proc);
+}
+
+void AchieveConditionInstruction::SetupNative(const Procedure& proc)
+{
+  auto children = ChildInstructions();
+  SetupChildren(proc);
+  m_condition = children[0];
+  m_action = children[1];
+}
+
+ExecutionStatus AchieveConditionInstruction::ExecuteNative(UserInterface& ui, Workspace& ws)
+{
+  // The condition is re-evaluated on every tick, as in a ReactiveFallback.
+  if (IsFinishedStatus(m_condition->GetStatus()))
+  {
+    m_condition->Reset(ui);
+  }
+  ExecuteMeasuredCondition(*m_condition, ui, ws, std::addressof(m_metrics));
+  auto condition_status = m_condition_debouncer.Update(m_condition->GetStatus());
+  if (condition_status == ExecutionStatus::SUCCESS)
+  {
+    auto action_status = m_action->GetStatus();
+    if (action_status == ExecutionStatus::RUNNING
+        || action_status == ExecutionStatus::NOT_FINISHED)
+    {
+      m_action->Halt(ui);
+    }
+    return ExecutionStatus::SUCCESS;
+  }
+  if (condition_status != ExecutionStatus::FAILURE)
+  {
+    return condition_status;
+  }
+  // The evaluation of the condition in the tick after the action finished is the re-check. When
+  // debounced, the re-check waits until a successful outcome either becomes stable or disappears.
+  if (m_action_finished)
+  {
+    return m_condition_debouncer.IsSettling() ? ExecutionStatus::RUNNING
+                                              : ExecutionStatus::FAILURE;
+  }
+  auto action_status = m_action->GetStatus();
+  if (NeedsExecute(action_status))
+  {
+    ExecuteMeasuredAction(*m_action, ui, ws, std::addressof(m_metrics));
+    action_status = m_action->GetStatus();
+  }
+  // The status of the action is ignored, as with ForceSuccess.
+  if (IsFinishedStatus(action_status))
+  {
+    m_action_finished = true;
+    return ExecutionStatus::NOT_FINISHED;
+  }
+  return action_status;
+}
+
 } // namespace oac_tree
 
 } // namespace sup
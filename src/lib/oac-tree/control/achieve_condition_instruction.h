@@ -23,6 +23,9 @@
 #ifndef SUP_OAC_TREE_PLUGIN_CONTROL_ACHIEVE_CONDITION_INSTRUCTION_H_
 #define SUP_OAC_TREE_PLUGIN_CONTROL_ACHIEVE_CONDITION_INSTRUCTION_H_
 
+#include "condition_debouncer.h"
+#include "control_metrics.h"
+#include "lazy_setup.h"
 #include "wrapped_instruction_manager.h"
 
 #include <sup/oac-tree/compound_instruction.h>
@@ -42,8 +45,22 @@ namespace oac_tree
  * @details This compound instruction expects exactly two child instructions: the first one
  * is the condition to achieve and the second one is the instruction (or tree)
  * to execute when the condition is not (yet) satisfied.
+ *
+ * By default, the behavior is implemented by an internal instruction tree composed of
+ * standard instructions. The native execution mode implements the same semantics with a flat
+ * state machine that calls both child instructions directly.
+ *
+ * The optional 'stableFor' (in seconds) and 'stableCount' (in ticks) attributes debounce a noisy
+ * condition: a change of its outcome is only taken into account when it persists, so that a
+ * single successful evaluation does not interrupt the action and a single failing evaluation does
+ * not start it. Debouncing requires the native execution mode, which is then the default.
+ *
+ * With the 'lazySetup' attribute, the child instructions and the internal instruction tree are
+ * only set up on the first tick.
+ *
+ * Execution metrics are recorded in both modes and can be queried through ControlMetricsProvider.
  */
-class AchieveConditionInstruction : public CompoundInstruction
+class AchieveConditionInstruction : public CompoundInstruction, public ControlMetricsProvider
 {
 public:
   AchieveConditionInstruction();
@@ -51,6 +68,8 @@ public:
 
   static const std::string Type;
 
+  const ControlMetrics& GetControlMetrics() const override;
+
 private:
   void SetupImpl(const Procedure& proc) override;
   ExecutionStatus ExecuteSingleImpl(UserInterface& ui, Workspace& ws) override;
@@ -58,11 +77,39 @@ private:
   void HaltImpl(UserInterface& ui) override;
 
   std::unique_ptr<Instruction> CreateWrappedInstructionTree();
+  void SetupComposed(const Procedure& proc);
+  void SetupNative(const Procedure& proc);
+  ExecutionStatus ExecuteNative(UserInterface& ui, Workspace& ws);
 
+  ControlMetrics m_metrics;
   std::unique_ptr<Instruction> m_internal_instruction_tree;
   WrappedInstructionManager m_instr_manager;
+  Instruction* m_condition;
+  Instruction* m_action;
+  bool m_action_finished;
+  ConditionDebouncer m_condition_debouncer;
+  LazySetup m_lazy_setup;
 };
 
+/**
+ * @brief Create the internal instruction tree of AchieveCondition for the given condition and
+ * action, which are attached through wrappers of the given manager:
+ *
+ *   ReactiveFallback
+ *   ├── <Condition>
+ *   └── Sequence
+ *       ├── ForceSuccess
+ *       │   └── <Action>
+ *       └── <Re-check of condition>
+ *
+ * Condition evaluations and action ticks are recorded in the given metrics, which need to outlive
+ * the tree.
+ */
+std::unique_ptr<Instruction> CreateAchieveConditionTree(WrappedInstructionManager& instr_manager,
+                                                        Instruction& condition,
+                                                        Instruction& action,
+                                                        ControlMetrics& metrics);
+
 }  // namespace oac_tree
 
 }  // namespace sup
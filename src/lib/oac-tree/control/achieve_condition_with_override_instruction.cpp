@@ -46,16 +46,28 @@ const std::string ABORT_TEXT_DEFAULT = "Abort";
 
 AchieveConditionWithOverrideInstruction::AchieveConditionWithOverrideInstruction()
   : CompoundInstruction(Type)
+  , m_metrics{}
   , m_user_decision_needed{false}
+  , m_condition{nullptr}
+  , m_action{nullptr}
+  , m_lazy_setup{}
 {
   (void)AddAttributeDefinition(MAIN_DIALOG_TEXT_ATTRIBUTE).SetCategory(AttributeCategory::kBoth);
+  (void)AddAttributeDefinition(LAZY_SETUP_ATTRIBUTE, sup::dto::BooleanType);
 }
 
 AchieveConditionWithOverrideInstruction::~AchieveConditionWithOverrideInstruction() = default;
 
+const ControlMetrics& AchieveConditionWithOverrideInstruction::GetControlMetrics() const
+{
+  return m_metrics;
+}
+
 void AchieveConditionWithOverrideInstruction::SetupImpl(const Procedure& proc)
 {
-  (void)proc;
+  m_metrics.SetTraceLabel(GetInstructionLabel(*this));
+  m_condition = nullptr;
+  m_action = nullptr;
   auto children = ChildInstructions();
   if (children.size() < 1 || children.size() > 2)
   {
@@ -63,17 +75,26 @@ void AchieveConditionWithOverrideInstruction::SetupImpl(const Procedure& proc)
       "This compound instruction requires either one or two child instructions";
     throw InstructionSetupException(error_message);
   }
-  SetupChildren(proc);
+  m_lazy_setup.Setup(*this, proc, [this](const Procedure& p) {
+    SetupChildren(p);
+    // Cache child pointers to avoid retrieving them on every tick
+    auto children = ChildInstructions();
+    m_condition = children[0];
+    m_action = children.size() == 2 ? children[1] : nullptr;
+  });
 }
 
 ExecutionStatus AchieveConditionWithOverrideInstruction::ExecuteSingleImpl(UserInterface& ui, Workspace& ws)
 {
-  auto children = ChildInstructions();
-  auto condition = children[0];
-  auto condition_status = condition->GetStatus();
+  ScopedMetricsTimer tick_timer{m_metrics, ControlMetrics::Section::kTick};
+  if (!m_lazy_setup.Complete(ui))
+  {
+    return ExecutionStatus::FAILURE;
+  }
+  auto condition_status = m_condition->GetStatus();
   if (NeedsExecute(condition_status))
   {
-    children[0]->ExecuteSingle(ui, ws);
+    ExecuteMeasuredCondition(*m_condition, ui, ws, std::addressof(m_metrics));
     return CalculateCompoundStatus();
   }
   if (ActionNeeded())
@@ -85,9 +106,15 @@ ExecutionStatus AchieveConditionWithOverrideInstruction::ExecuteSingleImpl(UserI
   {
     return ExecutionStatus::FAILURE;
   }
-  switch (GetUserInput(main_text, ui))
+  auto decision = kFail;
+  {
+    ScopedMetricsTimer dialog_timer{m_metrics, ControlMetrics::Section::kUserDialog};
+    decision = GetUserInput(main_text, ui);
+  }
+  switch (decision)
   {
   case kRetry:
+    m_metrics.RecordRetry();
     ResetHook(ui);
     return ExecutionStatus::NOT_FINISHED;
   case kOverride:
@@ -100,13 +127,16 @@ ExecutionStatus AchieveConditionWithOverrideInstruction::ExecuteSingleImpl(UserI
 
 void AchieveConditionWithOverrideInstruction::ResetHook(UserInterface& ui)
 {
-  ResetChildren(ui);
+  if (m_condition != nullptr)
+  {
+    ResetChildren(ui);
+  }
   m_user_decision_needed = false;
 }
 
 bool AchieveConditionWithOverrideInstruction::ActionDefined() const
 {
-  return ChildrenCount() == 2;
+  return m_action != nullptr;
 }
 
 bool AchieveConditionWithOverrideInstruction::ActionNeeded() const
@@ -116,14 +146,12 @@ bool AchieveConditionWithOverrideInstruction::ActionNeeded() const
 
 ExecutionStatus AchieveConditionWithOverrideInstruction::HandleAction(UserInterface& ui, Workspace& ws)
 {
-  auto children = ChildInstructions();
-  auto action = children[1];
-  auto action_status = action->GetStatus();
+  auto action_status = m_action->GetStatus();
   if (NeedsExecute(action_status))
   {
-    action->ExecuteSingle(ui, ws);
+    ExecuteMeasuredAction(*m_action, ui, ws, std::addressof(m_metrics));
   }
-  action_status = action->GetStatus();
+  action_status = m_action->GetStatus();
   if (IsFinishedStatus(action_status))
   {
     ResetChildren(ui);
@@ -169,10 +197,8 @@ std::vector<std::string> AchieveConditionWithOverrideInstruction::GetUserChoices
 
 ExecutionStatus AchieveConditionWithOverrideInstruction::CalculateCompoundStatus() const
 {
-  auto children = ChildInstructions();
-  auto condition = children[0];
-  auto condition_status = condition->GetStatus();
-  auto action_status = ActionDefined() ? children[1]->GetStatus()
+  auto condition_status = m_condition->GetStatus();
+  auto action_status = ActionDefined() ? m_action->GetStatus()
                                        : ExecutionStatus::NOT_STARTED;
   // When condition failed, compound status depends on other child:
   if (condition_status != ExecutionStatus::FAILURE)
@@ -23,6 +23,8 @@
 #ifndef SUP_OAC_TREE_PLUGIN_CONTROL_ACHIEVE_CONDITION_OVERRIDE_INSTRUCTION_H_
 #define SUP_OAC_TREE_PLUGIN_CONTROL_ACHIEVE_CONDITION_OVERRIDE_INSTRUCTION_H_
 
+#include "control_metrics.h"
+#include "lazy_setup.h"
 #include "wrapped_instruction_manager.h"
 
 #include <sup/oac-tree/compound_instruction.h>
@@ -43,8 +45,13 @@ namespace oac_tree
  * @details This compound instruction expects either one or two child instructions: the first one
  * is the condition to achieve and the second one, which is optional, is the instruction (or tree)
  * to execute when the condition is not (yet) satisfied.
+ *
+ * Each time the user chooses to retry, this is recorded as a retry in the execution metrics.
+ *
+ * With the 'lazySetup' attribute, the child instructions are only set up on the first tick.
  */
-class AchieveConditionWithOverrideInstruction : public CompoundInstruction
+class AchieveConditionWithOverrideInstruction : public CompoundInstruction,
+                                                public ControlMetricsProvider
 {
 public:
   AchieveConditionWithOverrideInstruction();
@@ -52,8 +59,14 @@ public:
 
   static const std::string Type;
 
+  const ControlMetrics& GetControlMetrics() const override;
+
 private:
+  ControlMetrics m_metrics;
   bool m_user_decision_needed;
+  Instruction* m_condition;
+  Instruction* m_action;
+  LazySetup m_lazy_setup;
   enum UserDecision {
     kRetry,
     kOverride,
@@ -22,6 +22,9 @@
 
 #include "achieve_condition_with_timeout_instruction.h"
 
+#include "building_block_factory.h"
+#include "deadline_instruction.h"
+#include "log_forwarding_options.h"
 #include "wrapped_user_interface.h"
 
 #include <sup/oac-tree/constants.h>
@@ -41,27 +44,75 @@ const std::string LOG_MESSAGE_PREFIX =
 
 AchieveConditionWithTimeoutInstruction::AchieveConditionWithTimeoutInstruction()
   : CompoundInstruction(Type)
+  , m_metrics{}
   , m_internal_instruction_tree{}
   , m_instr_manager{}
+  , m_deadline{nullptr}
+  , m_lazy_setup{}
 {
   (void)AddAttributeDefinition(Constants::TIMEOUT_SEC_ATTRIBUTE_NAME, sup::dto::Float64Type)
     .SetCategory(AttributeCategory::kBoth).SetMandatory();
+  (void)AddAttributeDefinition(LAZY_SETUP_ATTRIBUTE, sup::dto::BooleanType);
+  (void)AddAttributeDefinition(LOG_QUEUE_SIZE_ATTRIBUTE, sup::dto::UnsignedInteger32Type);
+  (void)AddAttributeDefinition(LOG_OVERFLOW_POLICY_ATTRIBUTE);
+  (void)AddAttributeDefinition(LOG_DEDUP_WINDOW_ATTRIBUTE, sup::dto::Float64Type);
 }
 
 AchieveConditionWithTimeoutInstruction::~AchieveConditionWithTimeoutInstruction() = default;
 
+DeadlineTimer::Clock::duration AchieveConditionWithTimeoutInstruction::GetTimeRemaining() const
+{
+  return m_deadline != nullptr ? m_deadline->GetTimer().GetTimeRemaining()
+                               : DeadlineTimer::Clock::duration::zero();
+}
+
+WakeUpHint AchieveConditionWithTimeoutInstruction::GetWakeUpHint() const
+{
+  auto result = PollingWakeUpHint();
+  if (m_deadline != nullptr && m_deadline->GetTimer().IsStarted())
+  {
+    result.m_deadline = m_deadline->GetTimer().GetDeadline();
+  }
+  return result;
+}
+
+const ControlMetrics& AchieveConditionWithTimeoutInstruction::GetControlMetrics() const
+{
+  return m_metrics;
+}
+
 void AchieveConditionWithTimeoutInstruction::SetupImpl(const Procedure& proc)
 {
-  auto instr_tree = CreateWrappedInstructionTree();
-  std::swap(m_internal_instruction_tree, instr_tree);
-  m_internal_instruction_tree->Setup(proc);
+  m_metrics.SetTraceLabel(GetInstructionLabel(*this));
+  m_internal_instruction_tree.reset();
+  m_deadline = nullptr;
+  m_instr_manager.SetLogForwardingOptions(GetLogForwardingOptions(*this));
+  if (ChildInstructions().size() != 2)
+  {
+    std::string error_message = InstructionErrorProlog(*this) +
+      "This compound instruction requires exactly two child instructions";
+    throw InstructionSetupException(error_message);
+  }
+  m_lazy_setup.Setup(*this, proc, [this](const Procedure& p) { SetupInternalTree(p); });
 }
 
 ExecutionStatus AchieveConditionWithTimeoutInstruction::ExecuteSingleImpl(UserInterface& ui, Workspace& ws)
 {
+  ScopedMetricsTimer tick_timer{m_metrics, ControlMetrics::Section::kTick};
+  if (!m_lazy_setup.Complete(ui))
+  {
+    return ExecutionStatus::FAILURE;
+  }
   auto& wrapped_ui = m_instr_manager.GetWrappedUI(ui, LOG_MESSAGE_PREFIX);
   m_internal_instruction_tree->ExecuteSingle(wrapped_ui, ws);
-  return m_internal_instruction_tree->GetStatus();
+  auto status = m_internal_instruction_tree->GetStatus();
+  // The deadline also fails when its timeout cannot be read, which is not a timeout
+  if (status == ExecutionStatus::FAILURE && m_deadline != nullptr &&
+      m_deadline->GetTimer().IsExpired())
+  {
+    m_metrics.RecordTimeout();
+  }
+  return status;
 }
 
 void AchieveConditionWithTimeoutInstruction::HaltImpl(UserInterface& ui)
@@ -79,12 +130,21 @@ void AchieveConditionWithTimeoutInstruction::ResetHook(UserInterface& ui)
   {
     auto& wrapped_ui = m_instr_manager.GetWrappedUI(ui, LOG_MESSAGE_PREFIX);
     m_internal_instruction_tree->Reset(wrapped_ui);
+    m_instr_manager.ReleaseRetiredUIs();
   }
 }
 
+void AchieveConditionWithTimeoutInstruction::SetupInternalTree(const Procedure& proc)
+{
+  auto instr_tree = CreateWrappedInstructionTree();
+  std::swap(m_internal_instruction_tree, instr_tree);
+  m_internal_instruction_tree->Setup(proc);
+}
+
 std::unique_ptr<Instruction> AchieveConditionWithTimeoutInstruction::CreateWrappedInstructionTree()
 {
   m_instr_manager.ClearWrappers();
+  m_deadline = nullptr;
   auto children = ChildInstructions();
   if (children.size() != 2)
   {
@@ -94,26 +154,29 @@ std::unique_ptr<Instruction> AchieveConditionWithTimeoutInstruction::CreateWrapp
   }
 
   // Wrapped condition
-  auto cond_wrapper = m_instr_manager.CreateInstructionWrapper(*children[0]);
+  auto cond_wrapper = m_instr_manager.CreateMeasuredWrapper(*children[0], m_metrics,
+                                                            ControlMetrics::Section::kCondition);
 
   // Wrapped action
-  auto action_wrapper = m_instr_manager.CreateInstructionWrapper(*children[1]);
+  auto action_wrapper = m_instr_manager.CreateMeasuredWrapper(*children[1], m_metrics,
+                                                              ControlMetrics::Section::kAction);
 
   // Ignore failure status of action
-  auto force_success = GlobalInstructionRegistry().Create("ForceSuccess");
+  auto force_success = CreateBuildingBlock(BuildingBlock::kForceSuccess);
   (void)force_success->InsertInstruction(std::move(action_wrapper), 0);
 
-  // Asynchronous fail for the timeout
-  auto fail = GlobalInstructionRegistry().Create("Fail");
-  (void)fail->AddAttribute("timeout", GetAttributeString(Constants::TIMEOUT_SEC_ATTRIBUTE_NAME));
+  // Fail after the timeout
+  auto deadline = std::make_unique<DeadlineInstruction>(*this,
+                                                        Constants::TIMEOUT_SEC_ATTRIBUTE_NAME);
+  m_deadline = deadline.get();
 
   // Sequence combining action and recheck of condition
-  auto sequence = GlobalInstructionRegistry().Create("Sequence");
+  auto sequence = CreateBuildingBlock(BuildingBlock::kSequence);
   (void)sequence->InsertInstruction(std::move(force_success), 0);
-  (void)sequence->InsertInstruction(std::move(fail), 1);
+  (void)sequence->InsertInstruction(std::move(deadline), 1);
 
   // Reactive fallback combining the condition and the sequence
-  auto fallback = GlobalInstructionRegistry().Create("ReactiveFallback");
+  auto fallback = CreateBuildingBlock(BuildingBlock::kReactiveFallback);
   (void)fallback->InsertInstruction(std::move(cond_wrapper), 0);
   (void)fallback->InsertInstruction(std::move(sequence), 1);
 
@@ -23,6 +23,10 @@
 #ifndef SUP_OAC_TREE_PLUGIN_CONTROL_ACHIEVE_CONDITION_WITH_TIMEOUT_INSTRUCTION_H_
 #define SUP_OAC_TREE_PLUGIN_CONTROL_ACHIEVE_CONDITION_WITH_TIMEOUT_INSTRUCTION_H_
 
+#include "control_metrics.h"
+#include "deadline_timer.h"
+#include "lazy_setup.h"
+#include "wake_up_hint.h"
 #include "wrapped_instruction_manager.h"
 
 #include <sup/oac-tree/compound_instruction.h>
@@ -33,6 +37,7 @@ namespace sup
 {
 namespace oac_tree
 {
+class DeadlineInstruction;
 
 /**
  * @brief Try to achieve a condition. If it is already satisfied, returns SUCCESS. Otherwise, if
@@ -43,8 +48,16 @@ namespace oac_tree
  * @details This compound instruction expects exactly two child instructions: the first one
  * is the condition to achieve and the second one is the instruction (or tree)
  * to execute when the condition is not (yet) satisfied.
+ *
+ * When the condition still fails after the timeout, this is recorded as a timeout in the
+ * execution metrics.
+ *
+ * With the 'lazySetup' attribute, the internal instruction tree is only created and set up on
+ * the first tick.
  */
-class AchieveConditionWithTimeoutInstruction : public CompoundInstruction
+class AchieveConditionWithTimeoutInstruction : public CompoundInstruction,
+                                               public WakeUpHintProvider,
+                                               public ControlMetricsProvider
 {
 public:
   AchieveConditionWithTimeoutInstruction();
@@ -52,15 +65,33 @@ public:
 
   static const std::string Type;
 
+  /**
+   * @brief Time remaining before the condition is considered failed. This is zero when the action
+   * has not finished yet, since the timeout only starts afterwards.
+   */
+  DeadlineTimer::Clock::duration GetTimeRemaining() const;
+
+  /**
+   * @brief The condition is polled on every tick, so the hint always requests polling. When the
+   * action has finished, the timeout deadline is included.
+   */
+  WakeUpHint GetWakeUpHint() const override;
+
+  const ControlMetrics& GetControlMetrics() const override;
+
 private:
   void SetupImpl(const Procedure& proc) override;
   ExecutionStatus ExecuteSingleImpl(UserInterface& ui, Workspace& ws) override;
   void HaltImpl(UserInterface& ui) override;
   void ResetHook(UserInterface& ui) override;
+  void SetupInternalTree(const Procedure& proc);
   std::unique_ptr<Instruction> CreateWrappedInstructionTree();
 
+  ControlMetrics m_metrics;
   std::unique_ptr<Instruction> m_internal_instruction_tree;
   WrappedInstructionManager m_instr_manager;
+  DeadlineInstruction* m_deadline;
+  LazySetup m_lazy_setup;
 };
 
 }  // namespace oac_tree
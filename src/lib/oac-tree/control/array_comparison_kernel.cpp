@@ -0,0 +1,197 @@
+/******************************************************************************
+* $HeadURL: $
+* $Id: $
+*
+* Project       : Supervision and Automation - oac-tree
+*
+* Description   : SUP oac-tree control plugin
+*
+* Author        : Walter Van Herck (IO)
+*
+* Copyright (c) : 2010-2026 ITER Organization,
+*                 CS 90 046
+*                 13067 St. Paul-lez-Durance Cedex
+*                 France
+* SPDX-License-Identifier: MIT
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file LICENSE located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+
+#include "array_comparison_kernel.h"
+
+#include <bitset>
+#include <functional>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define SUP_OAC_TREE_CONTROL_USE_SSE2
+#endif
+
+namespace
+{
+using sup::oac_tree::ArrayComparison;
+
+// Number of elements processed between two checks of the limit
+const std::size_t kBlockSize = 8;
+
+template <typename VectorCompare, typename ScalarCompare>
+std::size_t CountMatches(const double* values, std::size_t n_values, double reference,
+                         bool negate, std::size_t limit, VectorCompare vector_compare,
+                         ScalarCompare scalar_compare);
+
+template <typename Function>
+std::size_t DispatchComparison(ArrayComparison comparison, Function function);
+
+template <typename T>
+std::size_t CountIntegerMatches(const T* values, std::size_t n_values,
+                                ArrayComparison comparison, T reference, bool negate,
+                                std::size_t limit);
+}  // unnamed namespace
+
+namespace sup {
+
+namespace oac_tree {
+
+std::size_t CountArrayMatches(const double* values, std::size_t n_values,
+                              ArrayComparison comparison, double reference, bool negate,
+                              std::size_t limit)
+{
+  return DispatchComparison(comparison, [&](auto vector_compare, auto scalar_compare) {
+    return CountMatches(values, n_values, reference, negate, limit, vector_compare,
+                        scalar_compare);
+  });
+}
+
+std::size_t CountArrayMatches(const std::int64_t* values, std::size_t n_values,
+                              ArrayComparison comparison, std::int64_t reference, bool negate,
+                              std::size_t limit)
+{
+  return CountIntegerMatches(values, n_values, comparison, reference, negate, limit);
+}
+
+std::size_t CountArrayMatches(const std::uint64_t* values, std::size_t n_values,
+                              ArrayComparison comparison, std::uint64_t reference, bool negate,
+                              std::size_t limit)
+{
+  return CountIntegerMatches(values, n_values, comparison, reference, negate, limit);
+}
+
+} // namespace oac_tree
+
+} // namespace sup
+
+namespace
+{
+template <typename VectorCompare, typename ScalarCompare>
+std::size_t CountMatches(const double* values, std::size_t n_values, double reference,
+                         bool negate, std::size_t limit, VectorCompare vector_compare,
+                         ScalarCompare scalar_compare)
+{
+  std::size_t result = 0;
+  std::size_t idx = 0;
+#ifdef SUP_OAC_TREE_CONTROL_USE_SSE2
+  const __m128d ref = _mm_set1_pd(reference);
+  const int negate_mask = negate ? 0xFF : 0x00;
+  for (; idx + kBlockSize <= n_values && result < limit; idx += kBlockSize)
+  {
+    const double* block = values + idx;
+    int mask = _mm_movemask_pd(vector_compare(_mm_loadu_pd(block), ref))
+             | (_mm_movemask_pd(vector_compare(_mm_loadu_pd(block + 2), ref)) << 2)
+             | (_mm_movemask_pd(vector_compare(_mm_loadu_pd(block + 4), ref)) << 4)
+             | (_mm_movemask_pd(vector_compare(_mm_loadu_pd(block + 6), ref)) << 6);
+    result += std::bitset<kBlockSize>(static_cast<unsigned>(mask ^ negate_mask)).count();
+  }
+#else
+  (void)vector_compare;
+  for (; idx + kBlockSize <= n_values && result < limit; idx += kBlockSize)
+  {
+    for (std::size_t offset = 0; offset < kBlockSize; ++offset)
+    {
+      result += (scalar_compare(values[idx + offset], reference) != negate) ? 1 : 0;
+    }
+  }
+#endif
+  for (; idx < n_values && result < limit; ++idx)
+  {
+    result += (scalar_compare(values[idx], reference) != negate) ? 1 : 0;
+  }
+  return result;
+}
+
+#ifdef SUP_OAC_TREE_CONTROL_USE_SSE2
+#define SUP_OAC_TREE_CONTROL_VECTOR_COMPARE(intrinsic) \
+  [](__m128d lhs, __m128d rhs) { return intrinsic(lhs, rhs); }
+#else
+#define SUP_OAC_TREE_CONTROL_VECTOR_COMPARE(intrinsic) [](int, int) { return 0; }
+#endif
+
+template <typename Function>
+std::size_t DispatchComparison(ArrayComparison comparison, Function function)
+{
+  switch (comparison)
+  {
+  case ArrayComparison::kEqual:
+    return function(SUP_OAC_TREE_CONTROL_VECTOR_COMPARE(_mm_cmpeq_pd),
+                    [](double lhs, double rhs) { return lhs == rhs; });
+  case ArrayComparison::kNotEqual:
+    return function(SUP_OAC_TREE_CONTROL_VECTOR_COMPARE(_mm_cmpneq_pd),
+                    [](double lhs, double rhs) { return lhs != rhs; });
+  case ArrayComparison::kLess:
+    return function(SUP_OAC_TREE_CONTROL_VECTOR_COMPARE(_mm_cmplt_pd),
+                    [](double lhs, double rhs) { return lhs < rhs; });
+  case ArrayComparison::kLessOrEqual:
+    return function(SUP_OAC_TREE_CONTROL_VECTOR_COMPARE(_mm_cmple_pd),
+                    [](double lhs, double rhs) { return lhs <= rhs; });
+  case ArrayComparison::kGreater:
+    return function(SUP_OAC_TREE_CONTROL_VECTOR_COMPARE(_mm_cmpgt_pd),
+                    [](double lhs, double rhs) { return lhs > rhs; });
+  case ArrayComparison::kGreaterOrEqual:
+    return function(SUP_OAC_TREE_CONTROL_VECTOR_COMPARE(_mm_cmpge_pd),
+                    [](double lhs, double rhs) { return lhs >= rhs; });
+  }
+  return 0;
+}
+
+#undef SUP_OAC_TREE_CONTROL_VECTOR_COMPARE
+
+template <typename T, typename Compare>
+std::size_t CountScalarMatches(const T* values, std::size_t n_values, T reference, bool negate,
+                               std::size_t limit, Compare compare)
+{
+  std::size_t result = 0;
+  for (std::size_t idx = 0; idx < n_values && result < limit; ++idx)
+  {
+    result += (compare(values[idx], reference) != negate) ? 1 : 0;
+  }
+  return result;
+}
+
+template <typename T>
+std::size_t CountIntegerMatches(const T* values, std::size_t n_values,
+                                ArrayComparison comparison, T reference, bool negate,
+                                std::size_t limit)
+{
+  switch (comparison)
+  {
+  case ArrayComparison::kEqual:
+    return CountScalarMatches(values, n_values, reference, negate, limit, std::equal_to<T>{});
+  case ArrayComparison::kNotEqual:
+    return CountScalarMatches(values, n_values, reference, negate, limit,
+                              std::not_equal_to<T>{});
+  case ArrayComparison::kLess:
+    return CountScalarMatches(values, n_values, reference, negate, limit, std::less<T>{});
+  case ArrayComparison::kLessOrEqual:
+    return CountScalarMatches(values, n_values, reference, negate, limit, std::less_equal<T>{});
+  case ArrayComparison::kGreater:
+    return CountScalarMatches(values, n_values, reference, negate, limit, std::greater<T>{});
+  case ArrayComparison::kGreaterOrEqual:
+    return CountScalarMatches(values, n_values, reference, negate, limit,
+                              std::greater_equal<T>{});
+  }
+  return 0;
+}
+}  // unnamed namespace
@@ -0,0 +1,75 @@
+/******************************************************************************
+* $HeadURL: $
+* $Id: $
+*
+* Project       : Supervision and Automation - oac-tree
+*
+* Description   : SUP oac-tree control plugin
+*
+* Author        : Walter Van Herck (IO)
+*
+* Copyright (c) : 2010-2026 ITER Organization,
+*                 CS 90 046
+*                 13067 St. Paul-lez-Durance Cedex
+*                 France
+* SPDX-License-Identifier: MIT
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file LICENSE located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+
+#ifndef SUP_OAC_TREE_PLUGIN_CONTROL_ARRAY_COMPARISON_KERNEL_H_
+#define SUP_OAC_TREE_PLUGIN_CONTROL_ARRAY_COMPARISON_KERNEL_H_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace sup
+{
+namespace oac_tree
+{
+
+/**
+ * @brief Element-wise comparison of an array against a reference value.
+ */
+enum class ArrayComparison
+{
+  kEqual,
+  kNotEqual,
+  kLess,
+  kLessOrEqual,
+  kGreater,
+  kGreaterOrEqual
+};
+
+/**
+ * @brief Count the elements for which `element <comparison> reference` holds, or does not hold
+ * when negate is set.
+ *
+ * @details Uses SSE2 when available. Counting stops as soon as at least limit matching elements
+ * were found, so the returned count may be larger than limit, but never smaller than the actual
+ * count when that is below limit.
+ */
+std::size_t CountArrayMatches(const double* values, std::size_t n_values,
+                              ArrayComparison comparison, double reference, bool negate,
+                              std::size_t limit);
+
+/**
+ * @brief Exact integer versions of CountArrayMatches, used for 64-bit integers that cannot be
+ * converted to doubles without losing precision.
+ */
+std::size_t CountArrayMatches(const std::int64_t* values, std::size_t n_values,
+                              ArrayComparison comparison, std::int64_t reference, bool negate,
+                              std::size_t limit);
+std::size_t CountArrayMatches(const std::uint64_t* values, std::size_t n_values,
+                              ArrayComparison comparison, std::uint64_t reference, bool negate,
+                              std::size_t limit);
+
+}  // namespace oac_tree
+
+}  // namespace sup
+
+#endif  // SUP_OAC_TREE_PLUGIN_CONTROL_ARRAY_COMPARISON_KERNEL_H_
@@ -0,0 +1,366 @@
+/******************************************************************************
+* $HeadURL: $
+* $Id: $
+*
+* Project       : Supervision and Automation - oac-tree
+*
+* Description   : SUP oac-tree control plugin
+*
+* Author        : Walter Van Herck (IO)
+*
+* Copyright (c) : 2010-2026 ITER Organization,
+*                 CS 90 046
+*                 13067 St. Paul-lez-Durance Cedex
+*                 France
+* SPDX-License-Identifier: MIT
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file LICENSE located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+
+#include "array_condition_instruction.h"
+
+#include "instruction_attribute_utils.h"
+
+#include <sup/oac-tree/instruction_registry.h>
+#include <sup/oac-tree/instruction_utils.h>
+#include <sup/oac-tree/user_interface.h>
+#include <sup/oac-tree/workspace.h>
+
+#include <sup/dto/anyvalue_exceptions.h>
+
+#include <limits>
+#include <map>
+
+namespace
+{
+bool IsSignedIntegerType(sup::dto::TypeCode type_code);
+bool IsUnsignedIntegerType(sup::dto::TypeCode type_code);
+bool Is64BitIntegerType(sup::dto::TypeCode type_code);
+std::size_t CountOutOfRangeMatches(sup::oac_tree::ArrayComparison comparison,
+                                   bool reference_above, std::size_t n_values, bool negate);
+}  // unnamed namespace
+
+namespace sup {
+
+namespace oac_tree {
+
+const std::string ArrayConditionInstruction::Type = "ArrayCondition";
+static bool _array_condition_initialised_flag =
+  RegisterGlobalInstruction<ArrayConditionInstruction>();
+
+const std::string VAR_NAME_ATTRIBUTE = "varName";
+const std::string REFERENCE_VAR_ATTRIBUTE = "referenceVar";
+const std::string COMPARISON_ATTRIBUTE = "comparison";
+const std::string MODE_ATTRIBUTE = "mode";
+const std::string THRESHOLD_ATTRIBUTE = "threshold";
+
+const std::string ALL_MODE = "all";
+const std::string ANY_MODE = "any";
+const std::string COUNT_MODE = "count";
+
+const std::string EQUAL_COMPARISON = "equal";
+
+ArrayConditionInstruction::ArrayConditionInstruction()
+  : Instruction(Type)
+  , m_mode{Mode::kAll}
+  , m_comparison{ArrayComparison::kEqual}
+  , m_threshold{0}
+  , m_monitor{}
+  , m_values_valid{false}
+  , m_array{}
+  , m_reference{}
+  , m_element_kind{ElementKind::kDouble}
+  , m_reference_range{ReferenceRange::kInRange}
+  , m_buffer{}
+  , m_signed_buffer{}
+  , m_unsigned_buffer{}
+  , m_reference_value{0.0}
+  , m_signed_reference{0}
+  , m_unsigned_reference{0}
+{
+  (void)AddAttributeDefinition(VAR_NAME_ATTRIBUTE).SetMandatory();
+  (void)AddAttributeDefinition(REFERENCE_VAR_ATTRIBUTE).SetMandatory();
+  (void)AddAttributeDefinition(COMPARISON_ATTRIBUTE);
+  (void)AddAttributeDefinition(MODE_ATTRIBUTE);
+  (void)AddAttributeDefinition(THRESHOLD_ATTRIBUTE, sup::dto::UnsignedInteger64Type);
+}
+
+ArrayConditionInstruction::~ArrayConditionInstruction() = default;
+
+void ArrayConditionInstruction::SetupImpl(const Procedure& proc)
+{
+  (void)proc;
+  static const std::map<std::string, ArrayComparison> comparison_map = {
+    { EQUAL_COMPARISON, ArrayComparison::kEqual },
+    { "notEqual", ArrayComparison::kNotEqual },
+    { "less", ArrayComparison::kLess },
+    { "lessOrEqual", ArrayComparison::kLessOrEqual },
+    { "greater", ArrayComparison::kGreater },
+    { "greaterOrEqual", ArrayComparison::kGreaterOrEqual }
+  };
+  auto comparison = GetStringAttribute(*this, COMPARISON_ATTRIBUTE, EQUAL_COMPARISON);
+  auto it = comparison_map.find(comparison);
+  if (it == comparison_map.end())
+  {
+    std::string error_message = InstructionErrorProlog(*this) +
+      "Unknown comparison [" + comparison + "], expected one of [equal], [notEqual], [less], "
+      "[lessOrEqual], [greater] or [greaterOrEqual]";
+    throw InstructionSetupException(error_message);
+  }
+  m_comparison = it->second;
+  auto mode = GetStringAttribute(*this, MODE_ATTRIBUTE, ALL_MODE);
+  if (mode == ALL_MODE)
+  {
+    m_mode = Mode::kAll;
+  }
+  else if (mode == ANY_MODE)
+  {
+    m_mode = Mode::kAny;
+  }
+  else if (mode == COUNT_MODE)
+  {
+    m_mode = Mode::kCount;
+  }
+  else
+  {
+    std::string error_message = InstructionErrorProlog(*this) +
+      "Unknown mode [" + mode + "], expected [" + ALL_MODE + "], [" + ANY_MODE + "] or [" +
+      COUNT_MODE + "]";
+    throw InstructionSetupException(error_message);
+  }
+  if (m_mode == Mode::kCount && !HasAttribute(THRESHOLD_ATTRIBUTE))
+  {
+    std::string error_message = InstructionErrorProlog(*this) +
+      "Attribute [" + THRESHOLD_ATTRIBUTE + "] is mandatory in mode [" + COUNT_MODE + "]";
+    throw InstructionSetupException(error_message);
+  }
+  m_threshold = GetUnsignedIntegerAttribute(*this, THRESHOLD_ATTRIBUTE, 0);
+  // The old monitor, if any, stops monitoring on destruction
+  m_monitor = std::make_unique<VariableChangeMonitor>(GetReferencedVariableNames(*this));
+  m_values_valid = false;
+}
+
+ExecutionStatus ArrayConditionInstruction::ExecuteSingleImpl(UserInterface& ui, Workspace& ws)
+{
+  if (!UpdateValues(ui, ws))
+  {
+    return ExecutionStatus::FAILURE;
+  }
+  bool result = false;
+  switch (m_mode)
+  {
+  case Mode::kAll:
+    // Look for a single element that does not satisfy the comparison
+    result = CountMatches(true, 1) == 0;
+    break;
+  case Mode::kAny:
+    result = CountMatches(false, 1) > 0;
+    break;
+  case Mode::kCount:
+    result = CountMatches(false, m_threshold) >= m_threshold;
+    break;
+  }
+  return result ? ExecutionStatus::SUCCESS : ExecutionStatus::FAILURE;
+}
+
+bool ArrayConditionInstruction::UpdateValues(UserInterface& ui, Workspace& ws)
+{
+  m_monitor->Start(ws);
+  // The pending change is consumed before reading, so that changes during reading are not lost
+  if (m_monitor->ConsumeChange() || !m_values_valid)
+  {
+    m_values_valid = ReadValues(ui, ws);
+  }
+  return m_values_valid;
+}
+
+bool ArrayConditionInstruction::ReadValues(UserInterface& ui, Workspace& ws)
+{
+  const auto& var_name = GetAttributeString(VAR_NAME_ATTRIBUTE);
+  const auto& reference_var_name = GetAttributeString(REFERENCE_VAR_ATTRIBUTE);
+  if (!ws.GetValue(var_name, m_array) || !ws.GetValue(reference_var_name, m_reference))
+  {
+    std::string warning_message = InstructionWarningProlog(*this) +
+      "could not read variable [" + var_name + "] or [" + reference_var_name + "]";
+    LogWarning(ui, warning_message);
+    return false;
+  }
+  if (!sup::dto::IsArrayValue(m_array) || !sup::dto::IsScalarValue(m_reference))
+  {
+    std::string warning_message = InstructionWarningProlog(*this) +
+      "variable [" + var_name + "] is not an array or [" + reference_var_name +
+      "] is not a scalar";
+    LogWarning(ui, warning_message);
+    return false;
+  }
+  try
+  {
+    if (!ConvertValues())
+    {
+      std::string warning_message = InstructionWarningProlog(*this) +
+        "variables [" + var_name + "] and [" + reference_var_name + "] must both be integers "
+        "when one of them holds 64-bit integers";
+      LogWarning(ui, warning_message);
+      return false;
+    }
+  }
+  catch (const sup::dto::MessageException&)
+  {
+    std::string warning_message = InstructionWarningProlog(*this) +
+      "variables [" + var_name + "] and [" + reference_var_name + "] must be numeric";
+    LogWarning(ui, warning_message);
+    return false;
+  }
+  return true;
+}
+
+bool ArrayConditionInstruction::ConvertValues()
+{
+  const auto element_type_code = m_array.GetType().ElementType().GetTypeCode();
+  const auto reference_type_code = m_reference.GetTypeCode();
+  // Resizing keeps the capacity, so no allocations are needed while the array size is stable
+  const auto n_elements = m_array.NumberOfElements();
+  if (!Is64BitIntegerType(element_type_code) && !Is64BitIntegerType(reference_type_code))
+  {
+    // All other numeric types are exactly representable as doubles
+    m_element_kind = ElementKind::kDouble;
+    m_buffer.resize(n_elements);
+    for (std::size_t idx = 0; idx < n_elements; ++idx)
+    {
+      m_buffer[idx] = m_array[idx].As<double>();
+    }
+    m_reference_value = m_reference.As<double>();
+    return true;
+  }
+  const bool signed_elements = IsSignedIntegerType(element_type_code);
+  const bool signed_reference = IsSignedIntegerType(reference_type_code);
+  if ((!signed_elements && !IsUnsignedIntegerType(element_type_code)) ||
+      (!signed_reference && !IsUnsignedIntegerType(reference_type_code)))
+  {
+    return false;
+  }
+  m_reference_range = ReferenceRange::kInRange;
+  if (signed_elements)
+  {
+    m_element_kind = ElementKind::kSignedInteger;
+    m_signed_buffer.resize(n_elements);
+    for (std::size_t idx = 0; idx < n_elements; ++idx)
+    {
+      m_signed_buffer[idx] = m_array[idx].As<sup::dto::int64>();
+    }
+    if (signed_reference)
+    {
+      m_signed_reference = m_reference.As<sup::dto::int64>();
+      return true;
+    }
+    auto reference = m_reference.As<sup::dto::uint64>();
+    if (reference > static_cast<sup::dto::uint64>(std::numeric_limits<sup::dto::int64>::max()))
+    {
+      m_reference_range = ReferenceRange::kAbove;
+      return true;
+    }
+    m_signed_reference = static_cast<sup::dto::int64>(reference);
+    return true;
+  }
+  m_element_kind = ElementKind::kUnsignedInteger;
+  m_unsigned_buffer.resize(n_elements);
+  for (std::size_t idx = 0; idx < n_elements; ++idx)
+  {
+    m_unsigned_buffer[idx] = m_array[idx].As<sup::dto::uint64>();
+  }
+  if (!signed_reference)
+  {
+    m_unsigned_reference = m_reference.As<sup::dto::uint64>();
+    return true;
+  }
+  auto reference = m_reference.As<sup::dto::int64>();
+  if (reference < 0)
+  {
+    m_reference_range = ReferenceRange::kBelow;
+    return true;
+  }
+  m_unsigned_reference = static_cast<sup::dto::uint64>(reference);
+  return true;
+}
+
+std::size_t ArrayConditionInstruction::CountMatches(bool negate, std::size_t limit) const
+{
+  switch (m_element_kind)
+  {
+  case ElementKind::kDouble:
+    break;
+  case ElementKind::kSignedInteger:
+    if (m_reference_range != ReferenceRange::kInRange)
+    {
+      return CountOutOfRangeMatches(m_comparison, m_reference_range == ReferenceRange::kAbove,
+                                    m_signed_buffer.size(), negate);
+    }
+    return CountArrayMatches(m_signed_buffer.data(), m_signed_buffer.size(), m_comparison,
+                             m_signed_reference, negate, limit);
+  case ElementKind::kUnsignedInteger:
+    if (m_reference_range != ReferenceRange::kInRange)
+    {
+      return CountOutOfRangeMatches(m_comparison, m_reference_range == ReferenceRange::kAbove,
+                                    m_unsigned_buffer.size(), negate);
+    }
+    return CountArrayMatches(m_unsigned_buffer.data(), m_unsigned_buffer.size(), m_comparison,
+                             m_unsigned_reference, negate, limit);
+  }
+  return CountArrayMatches(m_buffer.data(), m_buffer.size(), m_comparison, m_reference_value,
+                           negate, limit);
+}
+
+} // namespace oac_tree
+
+} // namespace sup
+
+namespace
+{
+using sup::oac_tree::ArrayComparison;
+
+bool IsSignedIntegerType(sup::dto::TypeCode type_code)
+{
+  return type_code == sup::dto::TypeCode::Int8 || type_code == sup::dto::TypeCode::Int16 ||
+         type_code == sup::dto::TypeCode::Int32 || type_code == sup::dto::TypeCode::Int64;
+}
+
+bool IsUnsignedIntegerType(sup::dto::TypeCode type_code)
+{
+  return type_code == sup::dto::TypeCode::UInt8 || type_code == sup::dto::TypeCode::UInt16 ||
+         type_code == sup::dto::TypeCode::UInt32 || type_code == sup::dto::TypeCode::UInt64;
+}
+
+bool Is64BitIntegerType(sup::dto::TypeCode type_code)
+{
+  return type_code == sup::dto::TypeCode::Int64 || type_code == sup::dto::TypeCode::UInt64;
+}
+
+std::size_t CountOutOfRangeMatches(ArrayComparison comparison, bool reference_above,
+                                   std::size_t n_values, bool negate)
+{
+  // All elements compare in the same way with a reference outside of their range
+  bool match = false;
+  switch (comparison)
+  {
+  case ArrayComparison::kEqual:
+    match = false;
+    break;
+  case ArrayComparison::kNotEqual:
+    match = true;
+    break;
+  case ArrayComparison::kLess:
+  case ArrayComparison::kLessOrEqual:
+    match = reference_above;
+    break;
+  case ArrayComparison::kGreater:
+  case ArrayComparison::kGreaterOrEqual:
+    match = !reference_above;
+    break;
+  }
+  return match != negate ? n_values : 0;
+}
+}  // unnamed namespace
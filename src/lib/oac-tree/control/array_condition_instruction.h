@@ -0,0 +1,113 @@
+/******************************************************************************
+* $HeadURL: $
+* $Id: $
+*
+* Project       : Supervision and Automation - oac-tree
+*
+* Description   : SUP oac-tree control plugin
+*
+* Author        : Walter Van Herck (IO)
+*
+* Copyright (c) : 2010-2026 ITER Organization,
+*                 CS 90 046
+*                 13067 St. Paul-lez-Durance Cedex
+*                 France
+* SPDX-License-Identifier: MIT
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file LICENSE located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+
+#ifndef SUP_OAC_TREE_PLUGIN_CONTROL_ARRAY_CONDITION_INSTRUCTION_H_
+#define SUP_OAC_TREE_PLUGIN_CONTROL_ARRAY_CONDITION_INSTRUCTION_H_
+
+#include "array_comparison_kernel.h"
+#include "variable_change_monitor.h"
+
+#include <sup/oac-tree/instruction.h>
+
+#include <sup/dto/anyvalue.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace sup
+{
+namespace oac_tree
+{
+
+/**
+ * @brief Condition over all elements of a numeric array variable. Each element is compared with
+ * a scalar reference variable and the instruction succeeds when all elements, any element or at
+ * least a threshold number of elements satisfy the comparison.
+ *
+ * @details The elements are converted to a contiguous buffer, which is reused between ticks, and
+ * compared with a kernel that stops as soon as the outcome is known. The variables are only read
+ * and converted again when a workspace callback reported a change of one of them, so ticks without
+ * changes do not copy the array. Elements are compared as doubles with a vectorized kernel, unless
+ * the array or the reference holds 64-bit integers. These are compared exactly as integers and
+ * cannot be compared with floating point values.
+ */
+class ArrayConditionInstruction : public Instruction
+{
+public:
+  ArrayConditionInstruction();
+  ~ArrayConditionInstruction() override;
+
+  static const std::string Type;
+
+private:
+  enum class Mode
+  {
+    kAll,
+    kAny,
+    kCount
+  };
+  enum class ElementKind
+  {
+    kDouble,
+    kSignedInteger,
+    kUnsignedInteger
+  };
+  // Position of an integer reference that cannot be represented in the element type
+  enum class ReferenceRange
+  {
+    kBelow,
+    kInRange,
+    kAbove
+  };
+  void SetupImpl(const Procedure& proc) override;
+  ExecutionStatus ExecuteSingleImpl(UserInterface& ui, Workspace& ws) override;
+  bool UpdateValues(UserInterface& ui, Workspace& ws);
+  bool ReadValues(UserInterface& ui, Workspace& ws);
+  bool ConvertValues();
+  std::size_t CountMatches(bool negate, std::size_t limit) const;
+
+  Mode m_mode;
+  ArrayComparison m_comparison;
+  std::size_t m_threshold;
+  std::unique_ptr<VariableChangeMonitor> m_monitor;
+  bool m_values_valid;
+  sup::dto::AnyValue m_array;
+  sup::dto::AnyValue m_reference;
+  ElementKind m_element_kind;
+  ReferenceRange m_reference_range;
+  std::vector<double> m_buffer;
+  std::vector<std::int64_t> m_signed_buffer;
+  std::vector<std::uint64_t> m_unsigned_buffer;
+  double m_reference_value;
+  std::int64_t m_signed_reference;
+  std::uint64_t m_unsigned_reference;
+};
+
+}  // namespace oac_tree
+
+}  // namespace sup
+
+#endif  // SUP_OAC_TREE_PLUGIN_CONTROL_ARRAY_CONDITION_INSTRUCTION_H_
@@ -0,0 +1,468 @@
+/******************************************************************************
+* $HeadURL: $
+* $Id: $
+*
+* Project       : Supervision and Automation - oac-tree
+*
+* Description   : SUP oac-tree control plugin
+*
+* Author        : Walter Van Herck (IO)
+*
+* Copyright (c) : 2010-2026 ITER Organization,
+*                 CS 90 046
+*                 13067 St. Paul-lez-Durance Cedex
+*                 France
+* SPDX-License-Identifier: MIT
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file LICENSE located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+#include "async_log_forwarder.h"
+
+#include <sup/oac-tree/log_severity.h>
+#include <sup/oac-tree/user_interface.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace
+{
+// Backstop for a wake-up that was skipped because it would have blocked the scheduling thread
+const std::chrono::milliseconds kMissedWakeUpPollPeriod{100};
+
+std::size_t RoundUpToPowerOfTwo(std::size_t value);
+}  // unnamed namespace
+
+namespace sup {
+
+namespace oac_tree {
+
+/**
+ * @brief Single background thread that forwards the messages of all scheduled forwarders. It
+ * sleeps until a forwarder is scheduled or the thread is stopped at exit.
+ *
+ * @details Scheduling pushes the forwarder on a lock-free intrusive stack. Only the push that makes
+ * the stack non-empty wakes up the thread, and only when the wake-up mutex can be taken without
+ * blocking. Otherwise the wake-up could be missed, so while forwarders exist, the thread also
+ * checks for scheduled forwarders periodically. Without forwarders it sleeps without timeout.
+ */
+class LogForwardingThread
+{
+public:
+  ~LogForwardingThread();
+
+  LogForwardingThread(const LogForwardingThread&) = delete;
+  LogForwardingThread& operator=(const LogForwardingThread&) = delete;
+
+  static LogForwardingThread& Instance();
+
+  void Register();
+
+  /**
+   * @brief Schedule the forwarder. This never blocks and does not allocate memory.
+   */
+  void Schedule(AsyncLogForwarder& forwarder);
+
+  /**
+   * @brief Remove the forwarder from the scheduled ones and wait until the thread is not
+   * forwarding its messages anymore.
+   */
+  void Unregister(AsyncLogForwarder& forwarder);
+
+private:
+  LogForwardingThread();
+  void Run();
+  AsyncLogForwarder* TakeNext();
+  void TakeScheduled();
+
+  // Protects the list of pending forwarders and the active one
+  std::mutex m_mtx;
+  std::condition_variable m_idle_cv;
+  AsyncLogForwarder* m_pending_head;
+  AsyncLogForwarder* m_pending_tail;
+  AsyncLogForwarder* m_active;
+  // Protects the wake-up condition
+  std::mutex m_wake_mtx;
+  std::condition_variable m_work_cv;
+  std::size_t m_forwarder_count;
+  bool m_halt;
+  std::atomic<AsyncLogForwarder*> m_scheduled_head;
+  std::thread m_thread;
+};
+
+AsyncLogForwarder::AsyncLogForwarder(UserInterface& ui, std::size_t capacity,
+                                     LogOverflowPolicy policy)
+  : m_forwarding_thread{LogForwardingThread::Instance()}
+  , m_ui{ui}
+  , m_policy{policy}
+  , m_mask{RoundUpToPowerOfTwo(capacity) - 1u}
+  , m_cells{new Cell[m_mask + 1u]}
+  , m_enqueue_pos{0}
+  , m_dequeue_pos{0}
+  , m_dropped{0}
+  , m_forwarded{0}
+  , m_reported_dropped{0}
+  , m_scheduled{false}
+  , m_next_scheduled{nullptr}
+{
+  for (std::size_t idx = 0; idx <= m_mask; ++idx)
+  {
+    m_cells[idx].m_sequence.store(idx, std::memory_order_relaxed);
+    m_cells[idx].m_severity = 0;
+  }
+  m_forwarding_thread.Register();
+}
+
+AsyncLogForwarder::~AsyncLogForwarder()
+{
+  m_forwarding_thread.Unregister(*this);
+  // Forward messages that were not forwarded yet by the background thread
+  ForwardQueuedMessages();
+}
+
+bool AsyncLogForwarder::Push(int severity, const std::string& message)
+{
+  if (TryPush(severity, message))
+  {
+    Schedule();
+    return true;
+  }
+  if (m_policy == LogOverflowPolicy::kDropOldest)
+  {
+    int dropped_severity = 0;
+    std::string dropped_message;
+    if (TryPop(dropped_severity, dropped_message))
+    {
+      (void)m_dropped.fetch_add(1u, std::memory_order_relaxed);
+    }
+    if (TryPush(severity, message))
+    {
+      Schedule();
+      return true;
+    }
+  }
+  (void)m_dropped.fetch_add(1u, std::memory_order_relaxed);
+  return false;
+}
+
+bool AsyncLogForwarder::IsEmpty() const
+{
+  return m_dequeue_pos.load(std::memory_order_acquire) ==
+         m_enqueue_pos.load(std::memory_order_acquire);
+}
+
+std::size_t AsyncLogForwarder::GetCapacity() const
+{
+  return m_mask + 1u;
+}
+
+std::size_t AsyncLogForwarder::GetDroppedCount() const
+{
+  return m_dropped.load(std::memory_order_relaxed);
+}
+
+std::size_t AsyncLogForwarder::GetForwardedCount() const
+{
+  return m_forwarded.load(std::memory_order_relaxed);
+}
+
+bool AsyncLogForwarder::TryPush(int severity, const std::string& message)
+{
+  auto pos = m_enqueue_pos.load(std::memory_order_relaxed);
+  Cell* cell = nullptr;
+  while (true)
+  {
+    cell = std::addressof(m_cells[pos & m_mask]);
+    auto sequence = cell->m_sequence.load(std::memory_order_acquire);
+    if (sequence == pos)
+    {
+      if (m_enqueue_pos.compare_exchange_weak(pos, pos + 1u, std::memory_order_relaxed))
+      {
+        break;
+      }
+    }
+    else if (sequence < pos)
+    {
+      // Cell still holds a message from the previous lap: buffer is full
+      return false;
+    }
+    else
+    {
+      pos = m_enqueue_pos.load(std::memory_order_relaxed);
+    }
+  }
+  cell->m_severity = severity;
+  // Assignment reuses the capacity of the string in the cell
+  (void)cell->m_message.assign(message);
+  cell->m_sequence.store(pos + 1u, std::memory_order_release);
+  return true;
+}
+
+bool AsyncLogForwarder::TryPop(int& severity, std::string& message)
+{
+  auto pos = m_dequeue_pos.load(std::memory_order_relaxed);
+  Cell* cell = nullptr;
+  while (true)
+  {
+    cell = std::addressof(m_cells[pos & m_mask]);
+    auto sequence = cell->m_sequence.load(std::memory_order_acquire);
+    if (sequence == pos + 1u)
+    {
+      if (m_dequeue_pos.compare_exchange_weak(pos, pos + 1u, std::memory_order_relaxed))
+      {
+        break;
+      }
+    }
+    else if (sequence < pos + 1u)
+    {
+      // Cell was not yet written in this lap: buffer is empty
+      return false;
+    }
+    else
+    {
+      pos = m_dequeue_pos.load(std::memory_order_relaxed);
+    }
+  }
+  severity = cell->m_severity;
+  // Swapping keeps allocated capacity in both the cell and the caller's string
+  message.swap(cell->m_message);
+  cell->m_sequence.store(pos + m_mask + 1u, std::memory_order_release);
+  return true;
+}
+
+void AsyncLogForwarder::Schedule()
+{
+  // Only the first message after the buffer was drained wakes up the forwarding thread
+  if (!m_scheduled.exchange(true, std::memory_order_acq_rel))
+  {
+    m_forwarding_thread.Schedule(*this);
+  }
+}
+
+void AsyncLogForwarder::ForwardQueuedMessages()
+{
+  // The flag is cleared before draining, so that messages pushed while draining schedule this
+  // forwarder again. The exchange also synchronizes with the push that set the flag, so its
+  // message is visible here.
+  (void)m_scheduled.exchange(false, std::memory_order_acq_rel);
+  thread_local std::string message;
+  int severity = 0;
+  while (TryPop(severity, message))
+  {
+    m_ui.Log(severity, message);
+    (void)m_forwarded.fetch_add(1u, std::memory_order_relaxed);
+  }
+  ReportDropped();
+}
+
+void AsyncLogForwarder::ReportDropped()
+{
+  auto dropped = m_dropped.load(std::memory_order_relaxed);
+  if (dropped == m_reported_dropped)
+  {
+    return;
+  }
+  std::string warning = "Asynchronous log forwarding dropped " +
+    std::to_string(dropped - m_reported_dropped) + " message(s) because the queue was full";
+  m_reported_dropped = dropped;
+  m_ui.Log(log::SUP_SEQ_LOG_WARNING, warning);
+}
+
+LogForwardingThread::LogForwardingThread()
+  : m_mtx{}
+  , m_idle_cv{}
+  , m_pending_head{nullptr}
+  , m_pending_tail{nullptr}
+  , m_active{nullptr}
+  , m_wake_mtx{}
+  , m_work_cv{}
+  , m_forwarder_count{0}
+  , m_halt{false}
+  , m_scheduled_head{nullptr}
+  , m_thread{}
+{
+  m_thread = std::thread(&LogForwardingThread::Run, this);
+}
+
+LogForwardingThread::~LogForwardingThread()
+{
+  {
+    std::lock_guard<std::mutex> lk{m_wake_mtx};
+    m_halt = true;
+  }
+  m_work_cv.notify_one();
+  m_thread.join();
+}
+
+LogForwardingThread& LogForwardingThread::Instance()
+{
+  // Forwarders retrieve the instance on construction, so static forwarders are destroyed first
+  static LogForwardingThread instance;
+  return instance;
+}
+
+void LogForwardingThread::Register()
+{
+  {
+    std::lock_guard<std::mutex> lk{m_wake_mtx};
+    ++m_forwarder_count;
+  }
+  // The thread may be sleeping without timeout
+  m_work_cv.notify_one();
+}
+
+void LogForwardingThread::Schedule(AsyncLogForwarder& forwarder)
+{
+  auto head = m_scheduled_head.load(std::memory_order_relaxed);
+  do
+  {
+    forwarder.m_next_scheduled = head;
+  } while (!m_scheduled_head.compare_exchange_weak(head, std::addressof(forwarder),
+                                                   std::memory_order_release,
+                                                   std::memory_order_relaxed));
+  // The thread is busy or about to take the list when it was not empty
+  if (head != nullptr)
+  {
+    return;
+  }
+  // Taking the mutex ensures that the thread is not between checking the list and sleeping. When
+  // it is busy, the thread finds the forwarder with its periodic check.
+  if (m_wake_mtx.try_lock())
+  {
+    m_wake_mtx.unlock();
+    m_work_cv.notify_one();
+  }
+}
+
+void LogForwardingThread::Unregister(AsyncLogForwarder& forwarder)
+{
+  {
+    std::lock_guard<std::mutex> lk{m_wake_mtx};
+    --m_forwarder_count;
+  }
+  std::unique_lock<std::mutex> lk{m_mtx};
+  TakeScheduled();
+  AsyncLogForwarder* previous = nullptr;
+  for (auto current = m_pending_head; current != nullptr; current = current->m_next_scheduled)
+  {
+    if (current == std::addressof(forwarder))
+    {
+      (previous != nullptr ? previous->m_next_scheduled : m_pending_head) =
+        current->m_next_scheduled;
+      if (m_pending_tail == current)
+      {
+        m_pending_tail = previous;
+      }
+      break;
+    }
+    previous = current;
+  }
+  m_idle_cv.wait(lk, [this, &forwarder]() { return m_active != std::addressof(forwarder); });
+}
+
+void LogForwardingThread::Run()
+{
+  while (true)
+  {
+    auto forwarder = TakeNext();
+    if (forwarder != nullptr)
+    {
+      forwarder->ForwardQueuedMessages();
+      continue;
+    }
+    std::unique_lock<std::mutex> lk{m_wake_mtx};
+    if (m_halt)
+    {
+      break;
+    }
+    auto has_work = [this]() {
+      return m_halt || m_scheduled_head.load(std::memory_order_acquire) != nullptr;
+    };
+    if (m_forwarder_count == 0)
+    {
+      m_work_cv.wait(lk, has_work);
+    }
+    else
+    {
+      (void)m_work_cv.wait_for(lk, kMissedWakeUpPollPeriod, has_work);
+    }
+  }
+  // Wake up forwarders that are still waiting for the last forwarded one
+  std::lock_guard<std::mutex> lk{m_mtx};
+  m_active = nullptr;
+  m_idle_cv.notify_all();
+}
+
+AsyncLogForwarder* LogForwardingThread::TakeNext()
+{
+  std::lock_guard<std::mutex> lk{m_mtx};
+  // The previously forwarded one is finished
+  if (m_active != nullptr)
+  {
+    m_active = nullptr;
+    m_idle_cv.notify_all();
+  }
+  TakeScheduled();
+  auto forwarder = m_pending_head;
+  if (forwarder != nullptr)
+  {
+    m_pending_head = forwarder->m_next_scheduled;
+    if (m_pending_head == nullptr)
+    {
+      m_pending_tail = nullptr;
+    }
+    forwarder->m_next_scheduled = nullptr;
+  }
+  m_active = forwarder;
+  return forwarder;
+}
+
+void LogForwardingThread::TakeScheduled()
+{
+  auto head = m_scheduled_head.exchange(nullptr, std::memory_order_acquire);
+  // The stack holds the most recently scheduled forwarder first: append in reverse order
+  AsyncLogForwarder* reversed = nullptr;
+  auto tail = head;
+  while (head != nullptr)
+  {
+    auto next = head->m_next_scheduled;
+    head->m_next_scheduled = reversed;
+    reversed = head;
+    head = next;
+  }
+  if (reversed == nullptr)
+  {
+    return;
+  }
+  if (m_pending_tail != nullptr)
+  {
+    m_pending_tail->m_next_scheduled = reversed;
+  }
+  else
+  {
+    m_pending_head = reversed;
+  }
+  m_pending_tail = tail;
+}
+
+} // namespace oac_tree
+
+} // namespace sup
+
+namespace
+{
+std::size_t RoundUpToPowerOfTwo(std::size_t value)
+{
+  std::size_t result = 2u;
+  while (result < value)
+  {
+    result <<= 1u;
+  }
+  return result;
+}
+}  // unnamed namespace
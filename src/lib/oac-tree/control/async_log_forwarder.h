@@ -0,0 +1,111 @@
+/******************************************************************************
+* $HeadURL: $
+* $Id: $
+*
+* Project       : Supervision and Automation - oac-tree
+*
+* Description   : SUP oac-tree control plugin
+*
+* Author        : Walter Van Herck (IO)
+*
+* Copyright (c) : 2010-2026 ITER Organization,
+*                 CS 90 046
+*                 13067 St. Paul-lez-Durance Cedex
+*                 France
+* SPDX-License-Identifier: MIT
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file LICENSE located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+#ifndef SUP_OAC_TREE_PLUGIN_CONTROL_ASYNC_LOG_FORWARDER_H_
+#define SUP_OAC_TREE_PLUGIN_CONTROL_ASYNC_LOG_FORWARDER_H_
+
+#include "log_forwarding_options.h"
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <string>
+
+namespace sup
+{
+namespace oac_tree
+{
+class UserInterface;
+
+class LogForwardingThread;
+
+/**
+ * @brief Forwards log messages to a UserInterface from a background thread. Messages are passed
+ * through a bounded lock-free ring buffer, so that pushing a message never blocks the calling
+ * thread. When the buffer is full, messages are dropped according to the overflow policy.
+ *
+ * @details All forwarders share a single background thread, which sleeps until a forwarder has
+ * messages. A forwarder only schedules itself when its buffer goes from empty to non-empty, not for
+ * every message. Scheduling pushes the forwarder on a lock-free intrusive list and never blocks or
+ * allocates. A UserInterface that blocks in its Log method delays the forwarding of all
+ * forwarders. Dropped messages are counted and reported to the UserInterface with a single
+ * warning per batch. Remaining messages are forwarded before the destructor returns.
+ */
+class AsyncLogForwarder
+{
+public:
+  AsyncLogForwarder(UserInterface& ui, std::size_t capacity, LogOverflowPolicy policy);
+  ~AsyncLogForwarder();
+
+  AsyncLogForwarder(const AsyncLogForwarder&) = delete;
+  AsyncLogForwarder& operator=(const AsyncLogForwarder&) = delete;
+
+  /**
+   * @brief Queue a message for forwarding. This method never blocks.
+   *
+   * @return true if the message was queued, false if it was dropped.
+   */
+  bool Push(int severity, const std::string& message);
+
+  /**
+   * @brief Check if all queued messages were taken from the buffer for forwarding.
+   */
+  bool IsEmpty() const;
+
+  std::size_t GetCapacity() const;
+  std::size_t GetDroppedCount() const;
+  std::size_t GetForwardedCount() const;
+
+private:
+  friend class LogForwardingThread;
+  struct Cell
+  {
+    std::atomic<std::size_t> m_sequence;
+    int m_severity;
+    std::string m_message;
+  };
+  bool TryPush(int severity, const std::string& message);
+  bool TryPop(int& severity, std::string& message);
+  void Schedule();
+  void ForwardQueuedMessages();
+  void ReportDropped();
+
+  LogForwardingThread& m_forwarding_thread;
+  UserInterface& m_ui;
+  const LogOverflowPolicy m_policy;
+  const std::size_t m_mask;
+  std::unique_ptr<Cell[]> m_cells;
+  alignas(64) std::atomic<std::size_t> m_enqueue_pos;
+  alignas(64) std::atomic<std::size_t> m_dequeue_pos;
+  std::atomic<std::size_t> m_dropped;
+  std::atomic<std::size_t> m_forwarded;
+  std::size_t m_reported_dropped;
+  std::atomic<bool> m_scheduled;
+  // Link in the list of scheduled forwarders, only used while m_scheduled is set
+  AsyncLogForwarder* m_next_scheduled;
+};
+
+}  // namespace oac_tree
+
+}  // namespace sup
+
+#endif  // SUP_OAC_TREE_PLUGIN_CONTROL_ASYNC_LOG_FORWARDER_H_
@@ -0,0 +1,76 @@
+/******************************************************************************
+* $HeadURL: $
+* $Id: $
+*
+* Project       : Supervision and Automation - oac-tree
+*
+* Description   : SUP oac-tree control plugin
+*
+* Author        : Walter Van Herck (IO)
+*
+* Copyright (c) : 2010-2026 ITER Organization,
+*                 CS 90 046
+*                 13067 St. Paul-lez-Durance Cedex
+*                 France
+* SPDX-License-Identifier: MIT
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file LICENSE located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+
+#include "building_block_factory.h"
+
+#include <sup/oac-tree/exceptions.h>
+#include <sup/oac-tree/instruction.h>
+#include <sup/oac-tree/instruction_registry.h>
+
+#include <array>
+
+namespace sup {
+
+namespace oac_tree {
+
+namespace
+{
+const std::size_t kNumberOfBuildingBlocks = static_cast<std::size_t>(BuildingBlock::kSequence) + 1;
+
+using BuildingBlockTypes = std::array<std::string, kNumberOfBuildingBlocks>;
+
+const BuildingBlockTypes& GetBuildingBlockTypes();
+}  // unnamed namespace
+
+const std::string& GetBuildingBlockType(BuildingBlock block)
+{
+  return GetBuildingBlockTypes()[static_cast<std::size_t>(block)];
+}
+
+std::unique_ptr<Instruction> CreateBuildingBlock(BuildingBlock block)
+{
+  const auto& type = GetBuildingBlockType(block);
+  auto result = GlobalInstructionRegistry().Create(type);
+  if (!result)
+  {
+    std::string error_message =
+      "Instruction type [" + type + "] for internal instruction tree is not registered";
+    throw InstructionSetupException(error_message);
+  }
+  return result;
+}
+
+namespace
+{
+const BuildingBlockTypes& GetBuildingBlockTypes()
+{
+  // Order must match the BuildingBlock enumeration
+  static const BuildingBlockTypes types = {
+    "Async", "ForceSuccess", "ReactiveFallback", "ReactiveSequence", "Sequence" };
+  return types;
+}
+}  // unnamed namespace
+
+} // namespace oac_tree
+
+} // namespace sup
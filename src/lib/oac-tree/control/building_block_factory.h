@@ -0,0 +1,70 @@
+/******************************************************************************
+* $HeadURL: $
+* $Id: $
+*
+* Project       : Supervision and Automation - oac-tree
+*
+* Description   : SUP oac-tree control plugin
+*
+* Author        : Walter Van Herck (IO)
+*
+* Copyright (c) : 2010-2026 ITER Organization,
+*                 CS 90 046
+*                 13067 St. Paul-lez-Durance Cedex
+*                 France
+* SPDX-License-Identifier: MIT
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file LICENSE located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+
+#ifndef SUP_OAC_TREE_PLUGIN_CONTROL_BUILDING_BLOCK_FACTORY_H_
+#define SUP_OAC_TREE_PLUGIN_CONTROL_BUILDING_BLOCK_FACTORY_H_
+
+#include <memory>
+#include <string>
+
+namespace sup
+{
+namespace oac_tree
+{
+class Instruction;
+
+/**
+ * @brief Core instructions that are used to compose the internal instruction trees of the
+ * control instructions.
+ */
+enum class BuildingBlock
+{
+  kAsync = 0,
+  kForceSuccess,
+  kReactiveFallback,
+  kReactiveSequence,
+  kSequence
+};
+
+/**
+ * @brief Registered instruction type of a building block.
+ */
+const std::string& GetBuildingBlockType(BuildingBlock block);
+
+/**
+ * @brief Create a new instance of a building block.
+ *
+ * @details The type names of all building blocks are resolved once in a table that is shared by
+ * all control instructions, so that creating an internal instruction tree does not construct
+ * type name strings. The instances themselves are still created by the global instruction
+ * registry, which does not expose its factory functions.
+ *
+ * @throws InstructionSetupException when the building block is not registered.
+ */
+std::unique_ptr<Instruction> CreateBuildingBlock(BuildingBlock block);
+
+}  // namespace oac_tree
+
+}  // namespace sup
+
+#endif  // SUP_OAC_TREE_PLUGIN_CONTROL_BUILDING_BLOCK_FACTORY_H_
@@ -0,0 +1,141 @@
+/******************************************************************************
+* $HeadURL: $
+* $Id: $
+*
+* Project       : Supervision and Automation - oac-tree
+*
+* Description   : SUP oac-tree control plugin
+*
+* Author        : Walter Van Herck (IO)
+*
+* Copyright (c) : 2010-2026 ITER Organization,
+*                 CS 90 046
+*                 13067 St. Paul-lez-Durance Cedex
+*                 France
+* SPDX-License-Identifier: MIT
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file LICENSE located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+
+#include "condition_debouncer.h"
+
+#include "control_clock.h"
+#include "instruction_attribute_utils.h"
+
+#include <sup/oac-tree/exceptions.h>
+#include <sup/oac-tree/instruction.h>
+#include <sup/oac-tree/instruction_utils.h>
+
+namespace sup {
+
+namespace oac_tree {
+
+const std::string STABLE_FOR_ATTRIBUTE = "stableFor";
+const std::string STABLE_COUNT_ATTRIBUTE = "stableCount";
+
+ConditionDebouncer::ConditionDebouncer()
+  : m_stable_count{0}
+  , m_stable_duration{Clock::duration::zero()}
+  , m_accepted{ExecutionStatus::NOT_STARTED}
+  , m_candidate{ExecutionStatus::NOT_STARTED}
+  , m_candidate_count{0}
+  , m_candidate_since{}
+{}
+
+ConditionDebouncer::~ConditionDebouncer() = default;
+
+void ConditionDebouncer::SetStableCount(std::size_t stable_count)
+{
+  m_stable_count = stable_count;
+  Reset();
+}
+
+void ConditionDebouncer::SetStableDuration(double duration_sec)
+{
+  // Also catches NaN
+  if (!(duration_sec > 0.0))
+  {
+    SetStableDuration(Clock::duration::zero());
+    return;
+  }
+  SetStableDuration(
+    std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(duration_sec)));
+}
+
+void ConditionDebouncer::SetStableDuration(Clock::duration duration)
+{
+  m_stable_duration = duration < Clock::duration::zero() ? Clock::duration::zero() : duration;
+  Reset();
+}
+
+bool ConditionDebouncer::IsEnabled() const
+{
+  return m_stable_count > 1 || m_stable_duration > Clock::duration::zero();
+}
+
+ExecutionStatus ConditionDebouncer::Update(ExecutionStatus status)
+{
+  return Update(status, ControlClockNow());
+}
+
+ExecutionStatus ConditionDebouncer::Update(ExecutionStatus status, Clock::time_point now)
+{
+  const bool has_accepted = IsFinishedStatus(m_accepted);
+  if (!IsFinishedStatus(status))
+  {
+    return has_accepted ? m_accepted : status;
+  }
+  if (!IsEnabled() || status == m_accepted)
+  {
+    m_accepted = status;
+    m_candidate_count = 0;
+    return m_accepted;
+  }
+  if (m_candidate_count == 0 || status != m_candidate)
+  {
+    m_candidate = status;
+    m_candidate_count = 0;
+    m_candidate_since = now;
+  }
+  ++m_candidate_count;
+  if (m_candidate_count >= m_stable_count && now - m_candidate_since >= m_stable_duration)
+  {
+    m_accepted = status;
+    m_candidate_count = 0;
+    return m_accepted;
+  }
+  return has_accepted ? m_accepted : ExecutionStatus::RUNNING;
+}
+
+bool ConditionDebouncer::IsSettling() const
+{
+  return m_candidate_count > 0;
+}
+
+void ConditionDebouncer::Reset()
+{
+  m_accepted = ExecutionStatus::NOT_STARTED;
+  m_candidate = ExecutionStatus::NOT_STARTED;
+  m_candidate_count = 0;
+}
+
+void ConfigureConditionDebouncer(const Instruction& instr, ConditionDebouncer& debouncer)
+{
+  auto stable_for = GetFloatAttribute(instr, STABLE_FOR_ATTRIBUTE, 0.0);
+  if (stable_for < 0.0)
+  {
+    std::string error_message = InstructionErrorProlog(instr) +
+      "Attribute [" + STABLE_FOR_ATTRIBUTE + "] must not be negative";
+    throw InstructionSetupException(error_message);
+  }
+  debouncer.SetStableDuration(stable_for);
+  debouncer.SetStableCount(GetUnsignedIntegerAttribute(instr, STABLE_COUNT_ATTRIBUTE, 0));
+}
+
+} // namespace oac_tree
+
+} // namespace sup
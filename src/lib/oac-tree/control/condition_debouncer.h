@@ -0,0 +1,111 @@
+/******************************************************************************
+* $HeadURL: $
+* $Id: $
+*
+* Project       : Supervision and Automation - oac-tree
+*
+* Description   : SUP oac-tree control plugin
+*
+* Author        : Walter Van Herck (IO)
+*
+* Copyright (c) : 2010-2026 ITER Organization,
+*                 CS 90 046
+*                 13067 St. Paul-lez-Durance Cedex
+*                 France
+* SPDX-License-Identifier: MIT
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file LICENSE located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+
+#ifndef SUP_OAC_TREE_PLUGIN_CONTROL_CONDITION_DEBOUNCER_H_
+#define SUP_OAC_TREE_PLUGIN_CONTROL_CONDITION_DEBOUNCER_H_
+
+#include <sup/oac-tree/execution_status.h>
+
+#include <chrono>
+#include <cstddef>
+#include <string>
+
+namespace sup
+{
+namespace oac_tree
+{
+class Instruction;
+
+extern const std::string STABLE_FOR_ATTRIBUTE;
+extern const std::string STABLE_COUNT_ATTRIBUTE;
+
+/**
+ * @brief Applies hysteresis to the outcome of a noisy condition. A new outcome (SUCCESS or
+ * FAILURE) is only accepted after the condition returned it on a number of consecutive
+ * evaluations and for a minimum duration. Until then, the previously accepted outcome is kept.
+ *
+ * @details Before any outcome was accepted, RUNNING is returned while the first outcome settles.
+ * Unfinished outcomes of the condition do not interrupt settling. Without a stable count above
+ * one and without a stable duration, outcomes are accepted immediately.
+ */
+class ConditionDebouncer
+{
+public:
+  using Clock = std::chrono::steady_clock;
+
+  ConditionDebouncer();
+  ~ConditionDebouncer();
+
+  /**
+   * @brief Set the number of consecutive evaluations a new outcome needs to be returned.
+   */
+  void SetStableCount(std::size_t stable_count);
+
+  /**
+   * @brief Set the minimum duration in seconds a new outcome needs to be returned. Negative or NaN
+   * durations are treated as zero.
+   */
+  void SetStableDuration(double duration_sec);
+  void SetStableDuration(Clock::duration duration);
+
+  bool IsEnabled() const;
+
+  /**
+   * @brief Process the latest outcome of the condition and return the debounced outcome. Without
+   * a time argument, the current time of the control clock is used.
+   */
+  ExecutionStatus Update(ExecutionStatus status);
+  ExecutionStatus Update(ExecutionStatus status, Clock::time_point now);
+
+  /**
+   * @brief Check if the condition currently returns an outcome that differs from the accepted one
+   * and is not stable yet.
+   */
+  bool IsSettling() const;
+
+  /**
+   * @brief Forget the accepted outcome and any settling outcome.
+   */
+  void Reset();
+
+private:
+  std::size_t m_stable_count;
+  Clock::duration m_stable_duration;
+  ExecutionStatus m_accepted;
+  ExecutionStatus m_candidate;
+  std::size_t m_candidate_count;
+  Clock::time_point m_candidate_since;
+};
+
+/**
+ * @brief Configure a debouncer from the stableFor and stableCount attributes of an instruction.
+ *
+ * @throws InstructionSetupException when an attribute value is invalid.
+ */
+void ConfigureConditionDebouncer(const Instruction& instr, ConditionDebouncer& debouncer);
+
+}  // namespace oac_tree
+
+}  // namespace sup
+
+#endif  // SUP_OAC_TREE_PLUGIN_CONTROL_CONDITION_DEBOUNCER_H_
@@ -0,0 +1,150 @@
+/******************************************************************************
+* $HeadURL: $
+* $Id: $
+*
+* Project       : Supervision and Automation - oac-tree
+*
+* Description   : SUP oac-tree control plugin
+*
+* Author        : Walter Van Herck (IO)
+*
+* Copyright (c) : 2010-2026 ITER Organization,
+*                 CS 90 046
+*                 13067 St. Paul-lez-Durance Cedex
+*                 France
+* SPDX-License-Identifier: MIT
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file LICENSE located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+
+#include "condition_memo_table.h"
+
+#include <sup/oac-tree/instruction.h>
+
+#include <map>
+#include <set>
+
+namespace sup {
+
+namespace oac_tree {
+
+namespace
+{
+// Instructions whose outcome only depends on the values of the variables they reference (or on
+// the outcome of their children).
+const std::set<std::string> kMemoizableInstructionTypes = {
+  "ArrayCondition", "Equals", "Fail", "Fallback", "ForceSuccess", "GreaterThan",
+  "GreaterThanOrEqual", "Inverter", "LessThan", "LessThanOrEqual", "Sequence", "Succeed"
+};
+
+void AppendConditionSignature(const Instruction& instr, std::string& signature)
+{
+  signature += instr.GetType();
+  signature += '(';
+  // Sort attributes, so that their order in the procedure does not matter
+  std::map<std::string, std::string> attributes;
+  for (const auto& [attr_name, attr_value] : instr.GetStringAttributes())
+  {
+    attributes[attr_name] = attr_value;
+  }
+  for (const auto& [attr_name, attr_value] : attributes)
+  {
+    signature += attr_name + "=\"" + attr_value + "\";";
+  }
+  for (auto child : instr.ChildInstructions())
+  {
+    AppendConditionSignature(*child, signature);
+  }
+  signature += ')';
+}
+}  // unnamed namespace
+
+std::string GetConditionSignature(const Instruction& condition)
+{
+  std::string result;
+  AppendConditionSignature(condition, result);
+  return result;
+}
+
+bool IsMemoizableCondition(const Instruction& condition)
+{
+  if (kMemoizableInstructionTypes.find(condition.GetType()) == kMemoizableInstructionTypes.end())
+  {
+    return false;
+  }
+  for (auto child : condition.ChildInstructions())
+  {
+    if (!IsMemoizableCondition(*child))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+ConditionMemoTable::ConditionMemoTable()
+  : m_mtx{}
+  , m_tracker{}
+  , m_entries{}
+  , m_hits{0}
+  , m_misses{0}
+{}
+
+ConditionMemoTable::~ConditionMemoTable() = default;
+
+bool ConditionMemoTable::GetVersions(Workspace& ws, const std::vector<std::string>& var_names,
+                                     std::vector<std::uint64_t>& versions)
+{
+  {
+    std::lock_guard<std::mutex> lk{m_mtx};
+    if (!m_tracker.Start(ws))
+    {
+      return false;
+    }
+  }
+  m_tracker.GetVersions(var_names, versions);
+  return true;
+}
+
+bool ConditionMemoTable::Lookup(const std::string& signature,
+                                const std::vector<std::uint64_t>& versions,
+                                ExecutionStatus& status)
+{
+  std::lock_guard<std::mutex> lk{m_mtx};
+  auto it = m_entries.find(signature);
+  if (it == m_entries.end() || it->second.m_versions != versions)
+  {
+    (void)m_misses.fetch_add(1, std::memory_order_relaxed);
+    return false;
+  }
+  (void)m_hits.fetch_add(1, std::memory_order_relaxed);
+  status = it->second.m_status;
+  return true;
+}
+
+void ConditionMemoTable::Store(const std::string& signature,
+                               const std::vector<std::uint64_t>& versions, ExecutionStatus status)
+{
+  std::lock_guard<std::mutex> lk{m_mtx};
+  auto& entry = m_entries[signature];
+  entry.m_versions = versions;
+  entry.m_status = status;
+}
+
+std::size_t ConditionMemoTable::GetHitCount() const
+{
+  return m_hits.load(std::memory_order_relaxed);
+}
+
+std::size_t ConditionMemoTable::GetMissCount() const
+{
+  return m_misses.load(std::memory_order_relaxed);
+}
+
+} // namespace oac_tree
+
+} // namespace sup
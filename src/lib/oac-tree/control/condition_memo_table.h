@@ -0,0 +1,115 @@
+/******************************************************************************
+* $HeadURL: $
+* $Id: $
+*
+* Project       : Supervision and Automation - oac-tree
+*
+* Description   : SUP oac-tree control plugin
+*
+* Author        : Walter Van Herck (IO)
+*
+* Copyright (c) : 2010-2026 ITER Organization,
+*                 CS 90 046
+*                 13067 St. Paul-lez-Durance Cedex
+*                 France
+* SPDX-License-Identifier: MIT
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file LICENSE located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+
+#ifndef SUP_OAC_TREE_PLUGIN_CONTROL_CONDITION_MEMO_TABLE_H_
+#define SUP_OAC_TREE_PLUGIN_CONTROL_CONDITION_MEMO_TABLE_H_
+
+#include "workspace_version_tracker.h"
+
+#include <sup/oac-tree/execution_status.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace sup
+{
+namespace oac_tree
+{
+class Instruction;
+class Workspace;
+
+/**
+ * @brief Canonical description of a condition tree: the types and attributes of all its
+ * instructions. Conditions with the same signature compute the same result for the same variable
+ * values.
+ */
+std::string GetConditionSignature(const Instruction& condition);
+
+/**
+ * @brief Check if a condition tree only consists of instructions whose outcome only depends on the
+ * values of the workspace variables they reference, so that their outcome can be memoized.
+ */
+bool IsMemoizableCondition(const Instruction& condition);
+
+/**
+ * @brief Table of condition outcomes, keyed by condition signature and shared by all memoized
+ * conditions of a procedure. An outcome is valid as long as the versions of the variables read by
+ * the condition are the same as when it was evaluated. The table is owned by the memoized
+ * conditions that use it.
+ *
+ * @details All methods are thread safe.
+ */
+class ConditionMemoTable
+{
+public:
+  ConditionMemoTable();
+  ~ConditionMemoTable();
+
+  ConditionMemoTable(const ConditionMemoTable&) = delete;
+  ConditionMemoTable& operator=(const ConditionMemoTable&) = delete;
+
+  /**
+   * @brief Retrieve the current versions of the given variables in the workspace. Tracking of the
+   * workspace is started on first use.
+   *
+   * @return false if this table is already used with another workspace, in which case no outcome
+   * can be memoized.
+   */
+  bool GetVersions(Workspace& ws, const std::vector<std::string>& var_names,
+                   std::vector<std::uint64_t>& versions);
+
+  /**
+   * @brief Retrieve the outcome that was stored for the signature with the same versions.
+   */
+  bool Lookup(const std::string& signature, const std::vector<std::uint64_t>& versions,
+              ExecutionStatus& status);
+
+  void Store(const std::string& signature, const std::vector<std::uint64_t>& versions,
+             ExecutionStatus status);
+
+  std::size_t GetHitCount() const;
+  std::size_t GetMissCount() const;
+
+private:
+  struct MemoEntry
+  {
+    std::vector<std::uint64_t> m_versions;
+    ExecutionStatus m_status;
+  };
+  mutable std::mutex m_mtx;
+  WorkspaceVersionTracker m_tracker;
+  std::unordered_map<std::string, MemoEntry> m_entries;
+  std::atomic<std::size_t> m_hits;
+  std::atomic<std::size_t> m_misses;
+};
+
+}  // namespace oac_tree
+
+}  // namespace sup
+
+#endif  // SUP_OAC_TREE_PLUGIN_CONTROL_CONDITION_MEMO_TABLE_H_
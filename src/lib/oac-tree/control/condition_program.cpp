@@ -0,0 +1,281 @@
+/******************************************************************************
+* $HeadURL: $
+* $Id: $
+*
+* Project       : Supervision and Automation - oac-tree
+*
+* Description   : SUP oac-tree control plugin
+*
+* Author        : Walter Van Herck (IO)
+*
+* Copyright (c) : 2010-2026 ITER Organization,
+*                 CS 90 046
+*                 13067 St. Paul-lez-Durance Cedex
+*                 France
+* SPDX-License-Identifier: MIT
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file LICENSE located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+
+#include "condition_program.h"
+
+#include <sup/oac-tree/constants.h>
+#include <sup/oac-tree/instruction.h>
+#include <sup/oac-tree/workspace.h>
+
+#include <sup/dto/anyvalue_operations.h>
+
+#include <algorithm>
+
+namespace sup {
+
+namespace oac_tree {
+
+namespace
+{
+const std::string kLeftVarAttribute = "leftVar";
+const std::string kRightVarAttribute = "rightVar";
+const char kVariableReferencePrefix = '@';
+
+bool HasOnlyNameAttribute(const Instruction& instr);
+bool IsCompilableVariableName(const std::string& var_name);
+}  // unnamed namespace
+
+ConditionProgram::ConditionProgram()
+  : m_operations{}
+  , m_operand_names{}
+  , m_operand_values{}
+  , m_stack{}
+{}
+
+ConditionProgram::~ConditionProgram() = default;
+
+std::unique_ptr<ConditionProgram> ConditionProgram::Compile(const Instruction& condition)
+{
+  std::unique_ptr<ConditionProgram> result{new ConditionProgram()};
+  if (!result->CompileInstruction(condition))
+  {
+    return {};
+  }
+  result->m_operand_values.resize(result->m_operand_names.size());
+  // The stack never holds more values than the number of operations
+  result->m_stack.reserve(result->m_operations.size());
+  return result;
+}
+
+bool ConditionProgram::Evaluate(const Workspace& ws, bool& result)
+{
+  for (std::size_t idx = 0; idx < m_operand_names.size(); ++idx)
+  {
+    if (!ws.GetValue(m_operand_names[idx], m_operand_values[idx]))
+    {
+      return false;
+    }
+  }
+  m_stack.clear();
+  for (const auto& operation : m_operations)
+  {
+    switch (operation.m_op)
+    {
+    case OpCode::kTrue:
+      m_stack.push_back(true);
+      break;
+    case OpCode::kFalse:
+      m_stack.push_back(false);
+      break;
+    case OpCode::kEquals:
+      m_stack.push_back(m_operand_values[operation.m_left] == m_operand_values[operation.m_right]);
+      break;
+    case OpCode::kLess:
+    case OpCode::kLessOrEqual:
+    case OpCode::kGreater:
+    case OpCode::kGreaterOrEqual:
+    {
+      auto comparison = sup::dto::Compare(m_operand_values[operation.m_left],
+                                          m_operand_values[operation.m_right]);
+      bool value = false;
+      switch (operation.m_op)
+      {
+      case OpCode::kLess:
+        value = comparison == sup::dto::CompareResult::Less;
+        break;
+      case OpCode::kLessOrEqual:
+        value = comparison == sup::dto::CompareResult::Less ||
+                comparison == sup::dto::CompareResult::Equivalent;
+        break;
+      case OpCode::kGreater:
+        value = comparison == sup::dto::CompareResult::Greater;
+        break;
+      default:
+        value = comparison == sup::dto::CompareResult::Greater ||
+                comparison == sup::dto::CompareResult::Equivalent;
+        break;
+      }
+      m_stack.push_back(value);
+      break;
+    }
+    case OpCode::kNot:
+      m_stack.back() = !m_stack.back();
+      break;
+    case OpCode::kSetTrue:
+      m_stack.back() = true;
+      break;
+    case OpCode::kAll:
+    case OpCode::kAny:
+    {
+      // An empty Sequence succeeds and an empty Fallback fails
+      const bool is_all = operation.m_op == OpCode::kAll;
+      bool value = is_all;
+      for (std::size_t idx = 0; idx < operation.m_left; ++idx)
+      {
+        value = is_all ? (value && m_stack.back()) : (value || m_stack.back());
+        m_stack.pop_back();
+      }
+      m_stack.push_back(value);
+      break;
+    }
+    }
+  }
+  result = m_stack.back();
+  return true;
+}
+
+std::size_t ConditionProgram::GetOperationCount() const
+{
+  return m_operations.size();
+}
+
+std::size_t ConditionProgram::GetOperandCount() const
+{
+  return m_operand_names.size();
+}
+
+bool ConditionProgram::CompileInstruction(const Instruction& instr)
+{
+  const auto& instr_type = instr.GetType();
+  if (instr_type == "Equals")
+  {
+    return CompileComparison(instr, OpCode::kEquals);
+  }
+  if (instr_type == "LessThan")
+  {
+    return CompileComparison(instr, OpCode::kLess);
+  }
+  if (instr_type == "LessThanOrEqual")
+  {
+    return CompileComparison(instr, OpCode::kLessOrEqual);
+  }
+  if (instr_type == "GreaterThan")
+  {
+    return CompileComparison(instr, OpCode::kGreater);
+  }
+  if (instr_type == "GreaterThanOrEqual")
+  {
+    return CompileComparison(instr, OpCode::kGreaterOrEqual);
+  }
+  if (!HasOnlyNameAttribute(instr))
+  {
+    return false;
+  }
+  auto children = instr.ChildInstructions();
+  if (instr_type == "Succeed" || instr_type == "Fail")
+  {
+    if (!children.empty())
+    {
+      return false;
+    }
+    m_operations.push_back({ instr_type == "Succeed" ? OpCode::kTrue : OpCode::kFalse, 0, 0 });
+    return true;
+  }
+  if (instr_type == "Inverter" || instr_type == "ForceSuccess")
+  {
+    if (children.size() != 1 || !CompileInstruction(*children[0]))
+    {
+      return false;
+    }
+    m_operations.push_back({ instr_type == "Inverter" ? OpCode::kNot : OpCode::kSetTrue, 0, 0 });
+    return true;
+  }
+  if (instr_type == "Sequence" || instr_type == "Fallback")
+  {
+    for (auto child : children)
+    {
+      if (!CompileInstruction(*child))
+      {
+        return false;
+      }
+    }
+    m_operations.push_back({ instr_type == "Sequence" ? OpCode::kAll : OpCode::kAny,
+                             children.size(), 0 });
+    return true;
+  }
+  return false;
+}
+
+bool ConditionProgram::CompileComparison(const Instruction& instr, OpCode op)
+{
+  if (!instr.ChildInstructions().empty())
+  {
+    return false;
+  }
+  for (const auto& [attr_name, attr_value] : instr.GetStringAttributes())
+  {
+    if (attr_name != Constants::NAME_ATTRIBUTE_NAME && attr_name != kLeftVarAttribute &&
+        attr_name != kRightVarAttribute)
+    {
+      return false;
+    }
+  }
+  if (!instr.HasAttribute(kLeftVarAttribute) || !instr.HasAttribute(kRightVarAttribute))
+  {
+    return false;
+  }
+  auto left_var = instr.GetAttributeString(kLeftVarAttribute);
+  auto right_var = instr.GetAttributeString(kRightVarAttribute);
+  if (!IsCompilableVariableName(left_var) || !IsCompilableVariableName(right_var))
+  {
+    return false;
+  }
+  m_operations.push_back({ op, GetOperandIndex(left_var), GetOperandIndex(right_var) });
+  return true;
+}
+
+std::size_t ConditionProgram::GetOperandIndex(const std::string& var_name)
+{
+  auto it = std::find(m_operand_names.begin(), m_operand_names.end(), var_name);
+  if (it != m_operand_names.end())
+  {
+    return static_cast<std::size_t>(it - m_operand_names.begin());
+  }
+  m_operand_names.push_back(var_name);
+  return m_operand_names.size() - 1;
+}
+
+namespace
+{
+bool HasOnlyNameAttribute(const Instruction& instr)
+{
+  for (const auto& [attr_name, attr_value] : instr.GetStringAttributes())
+  {
+    if (attr_name != Constants::NAME_ATTRIBUTE_NAME)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool IsCompilableVariableName(const std::string& var_name)
+{
+  // Indirect references are resolved at runtime by the instruction itself
+  return !var_name.empty() && var_name.front() != kVariableReferencePrefix;
+}
+}  // unnamed namespace
+
+} // namespace oac_tree
+
+} // namespace sup
@@ -0,0 +1,124 @@
+/******************************************************************************
+* $HeadURL: $
+* $Id: $
+*
+* Project       : Supervision and Automation - oac-tree
+*
+* Description   : SUP oac-tree control plugin
+*
+* Author        : Walter Van Herck (IO)
+*
+* Copyright (c) : 2010-2026 ITER Organization,
+*                 CS 90 046
+*                 13067 St. Paul-lez-Durance Cedex
+*                 France
+* SPDX-License-Identifier: MIT
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file LICENSE located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+
+#ifndef SUP_OAC_TREE_PLUGIN_CONTROL_CONDITION_PROGRAM_H_
+#define SUP_OAC_TREE_PLUGIN_CONTROL_CONDITION_PROGRAM_H_
+
+#include <sup/dto/anyvalue.h>
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace sup
+{
+namespace oac_tree
+{
+class Instruction;
+class Workspace;
+
+/**
+ * @brief Flat expression program, compiled from a pure condition tree, that is evaluated directly
+ * against the values of workspace variables instead of executing the instructions of the tree.
+ *
+ * @details Only trees consisting of comparisons (Equals, GreaterThan, GreaterThanOrEqual,
+ * LessThan, LessThanOrEqual) between two workspace variables and the compound instructions
+ * Sequence, Fallback, Inverter and ForceSuccess, or the leaves Succeed and Fail, can be compiled.
+ * Each referenced variable is read only once per evaluation into a preallocated buffer.
+ */
+class ConditionProgram
+{
+public:
+  ~ConditionProgram();
+
+  ConditionProgram(const ConditionProgram&) = delete;
+  ConditionProgram& operator=(const ConditionProgram&) = delete;
+
+  /**
+   * @brief Compile the given condition tree.
+   *
+   * @return Compiled program or nullptr if the tree cannot be compiled.
+   */
+  static std::unique_ptr<ConditionProgram> Compile(const Instruction& condition);
+
+  /**
+   * @brief Evaluate the program against the current values in the workspace.
+   *
+   * @param ws Workspace to read the variables from.
+   * @param result Outcome of the condition on success.
+   *
+   * @return false if one of the variables could not be read. The caller should then execute the
+   * original condition tree instead, which will report the error.
+   */
+  bool Evaluate(const Workspace& ws, bool& result);
+
+  /**
+   * @brief Number of operations in the program.
+   */
+  std::size_t GetOperationCount() const;
+
+  /**
+   * @brief Number of distinct variables (or variable fields) read by the program.
+   */
+  std::size_t GetOperandCount() const;
+
+private:
+  enum class OpCode
+  {
+    kTrue,
+    kFalse,
+    kEquals,
+    kLess,
+    kLessOrEqual,
+    kGreater,
+    kGreaterOrEqual,
+    kNot,
+    kSetTrue,
+    kAll,
+    kAny
+  };
+  // Operations are stored in postfix order. Comparisons use m_left and m_right as indices into
+  // the operands, while kAll and kAny use m_left as the number of values they consume.
+  struct Operation
+  {
+    OpCode m_op;
+    std::size_t m_left;
+    std::size_t m_right;
+  };
+  ConditionProgram();
+  bool CompileInstruction(const Instruction& instr);
+  bool CompileComparison(const Instruction& instr, OpCode op);
+  std::size_t GetOperandIndex(const std::string& var_name);
+
+  std::vector<Operation> m_operations;
+  std::vector<std::string> m_operand_names;
+  std::vector<sup::dto::AnyValue> m_operand_values;
+  std::vector<bool> m_stack;
+};
+
+}  // namespace oac_tree
+
+}  // namespace sup
+
+#endif  // SUP_OAC_TREE_PLUGIN_CONTROL_CONDITION_PROGRAM_H_
@@ -0,0 +1,117 @@
+/******************************************************************************
+* $HeadURL: $
+* $Id: $
+*
+* Project       : Supervision and Automation - oac-tree
+*
+* Description   : SUP oac-tree control plugin
+*
+* Author        : Walter Van Herck (IO)
+*
+* Copyright (c) : 2010-2026 ITER Organization,
+*                 CS 90 046
+*                 13067 St. Paul-lez-Durance Cedex
+*                 France
+* SPDX-License-Identifier: MIT
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file LICENSE located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+
+#include "condition_throttle.h"
+
+#include "control_clock.h"
+#include "control_metrics.h"
+
+#include <sup/oac-tree/instruction.h>
+
+namespace sup {
+
+namespace oac_tree {
+
+ConditionThrottle::ConditionThrottle(ControlMetrics* metrics)
+  : m_metrics{metrics}
+  , m_period{Clock::duration::zero()}
+  , m_cached{false}
+  , m_cached_status{ExecutionStatus::NOT_STARTED}
+  , m_next_evaluation{}
+  , m_evaluations{0}
+  , m_skipped{0}
+{}
+
+ConditionThrottle::~ConditionThrottle() = default;
+
+void ConditionThrottle::SetPeriod(double period_sec)
+{
+  // Also catches NaN
+  if (!(period_sec > 0.0))
+  {
+    SetPeriod(Clock::duration::zero());
+    return;
+  }
+  SetPeriod(std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(period_sec)));
+}
+
+void ConditionThrottle::SetPeriod(Clock::duration period)
+{
+  m_period = period < Clock::duration::zero() ? Clock::duration::zero() : period;
+  Reset();
+}
+
+ConditionThrottle::Clock::duration ConditionThrottle::GetPeriod() const
+{
+  return m_period;
+}
+
+ExecutionStatus ConditionThrottle::Evaluate(Instruction& condition, UserInterface& ui,
+                                            Workspace& ws)
+{
+  return Evaluate(condition, ui, ws, ControlClockNow());
+}
+
+ExecutionStatus ConditionThrottle::Evaluate(Instruction& condition, UserInterface& ui,
+                                            Workspace& ws, Clock::time_point now)
+{
+  if (m_cached && now < m_next_evaluation)
+  {
+    (void)m_skipped.fetch_add(1, std::memory_order_relaxed);
+    return m_cached_status;
+  }
+  if (IsFinishedStatus(condition.GetStatus()))
+  {
+    condition.Reset(ui);
+  }
+  ExecuteMeasuredCondition(condition, ui, ws, m_metrics);
+  (void)m_evaluations.fetch_add(1, std::memory_order_relaxed);
+  auto status = condition.GetStatus();
+  m_cached = m_period > Clock::duration::zero() && IsFinishedStatus(status);
+  if (m_cached)
+  {
+    m_cached_status = status;
+    m_next_evaluation = now + m_period;
+  }
+  return status;
+}
+
+void ConditionThrottle::Reset()
+{
+  m_cached = false;
+  m_cached_status = ExecutionStatus::NOT_STARTED;
+}
+
+std::size_t ConditionThrottle::GetEvaluationCount() const
+{
+  return m_evaluations.load(std::memory_order_relaxed);
+}
+
+std::size_t ConditionThrottle::GetSkippedEvaluationCount() const
+{
+  return m_skipped.load(std::memory_order_relaxed);
+}
+
+} // namespace oac_tree
+
+} // namespace sup
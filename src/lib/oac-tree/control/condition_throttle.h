@@ -0,0 +1,98 @@
+/******************************************************************************
+* $HeadURL: $
+* $Id: $
+*
+* Project       : Supervision and Automation - oac-tree
+*
+* Description   : SUP oac-tree control plugin
+*
+* Author        : Walter Van Herck (IO)
+*
+* Copyright (c) : 2010-2026 ITER Organization,
+*                 CS 90 046
+*                 13067 St. Paul-lez-Durance Cedex
+*                 France
+* SPDX-License-Identifier: MIT
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file LICENSE located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+
+#ifndef SUP_OAC_TREE_PLUGIN_CONTROL_CONDITION_THROTTLE_H_
+#define SUP_OAC_TREE_PLUGIN_CONTROL_CONDITION_THROTTLE_H_
+
+#include <sup/oac-tree/execution_status.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+
+namespace sup
+{
+namespace oac_tree
+{
+class ControlMetrics;
+class Instruction;
+class UserInterface;
+class Workspace;
+
+/**
+ * @brief Limits how often a condition instruction is evaluated. After a finished evaluation, its
+ * outcome is reused for the configured period instead of executing the condition again.
+ *
+ * @details A zero period disables throttling: the condition is then evaluated on every call.
+ * Unfinished (RUNNING) evaluations are never cached. The counters are cumulative and can be read
+ * from any thread. Executed evaluations are also recorded in the optional metrics.
+ */
+class ConditionThrottle
+{
+public:
+  using Clock = std::chrono::steady_clock;
+
+  explicit ConditionThrottle(ControlMetrics* metrics = nullptr);
+  ~ConditionThrottle();
+
+  /**
+   * @brief Set the minimum period between evaluations in seconds. Negative or NaN periods are
+   * treated as zero. This also discards the cached outcome.
+   */
+  void SetPeriod(double period_sec);
+  void SetPeriod(Clock::duration period);
+
+  Clock::duration GetPeriod() const;
+
+  /**
+   * @brief Return the cached outcome of the condition when it is still valid, or reset the
+   * condition if needed and execute it once otherwise. Without a time argument, the current time
+   * of the control clock is used.
+   */
+  ExecutionStatus Evaluate(Instruction& condition, UserInterface& ui, Workspace& ws);
+  ExecutionStatus Evaluate(Instruction& condition, UserInterface& ui, Workspace& ws,
+                           Clock::time_point now);
+
+  /**
+   * @brief Discard the cached outcome, so that the next call to Evaluate executes the condition.
+   */
+  void Reset();
+
+  std::size_t GetEvaluationCount() const;
+  std::size_t GetSkippedEvaluationCount() const;
+
+private:
+  ControlMetrics* m_metrics;
+  Clock::duration m_period;
+  bool m_cached;
+  ExecutionStatus m_cached_status;
+  Clock::time_point m_next_evaluation;
+  std::atomic<std::size_t> m_evaluations;
+  std::atomic<std::size_t> m_skipped;
+};
+
+}  // namespace oac_tree
+
+}  // namespace sup
+
+#endif  // SUP_OAC_TREE_PLUGIN_CONTROL_CONDITION_THROTTLE_H_
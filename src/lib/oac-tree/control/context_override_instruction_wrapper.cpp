@@ -40,20 +40,21 @@ void ContextOVerrideInstructionWrapper::SetUserInterface(UserInterface& ui)
   m_ui = std::addressof(ui);
 }
 
+UserInterface& ContextOVerrideInstructionWrapper::SelectUserInterface(UserInterface& ui)
+{
+  return m_ui == nullptr ? ui : *m_ui;
+}
+
 ExecutionStatus ContextOVerrideInstructionWrapper::ExecuteSingleImpl(
   UserInterface& ui, Workspace& ws)
 {
-  auto selected_ui = m_ui == nullptr ? std::addressof(ui)
-                                     : m_ui;
-  GetInstruction()->ExecuteSingle(*selected_ui, ws);
+  GetInstruction()->ExecuteSingle(SelectUserInterface(ui), ws);
   return GetInstruction()->GetStatus();
 }
 
 void ContextOVerrideInstructionWrapper::ResetHook(UserInterface& ui)
 {
-  auto selected_ui = m_ui == nullptr ? std::addressof(ui)
-                                     : m_ui;
-  GetInstruction()->Reset(*selected_ui);
+  GetInstruction()->Reset(SelectUserInterface(ui));
 }
 
 } // namespace oac_tree
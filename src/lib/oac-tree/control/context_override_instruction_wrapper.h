@@ -41,6 +41,12 @@ public:
 
   void SetUserInterface(UserInterface& ui);
 
+protected:
+  /**
+   * @brief Select the injected UserInterface if present, or the provided one otherwise.
+   */
+  UserInterface& SelectUserInterface(UserInterface& ui);
+
 private:
   UserInterface* m_ui;
   ExecutionStatus ExecuteSingleImpl(UserInterface& ui, Workspace& ws) override;
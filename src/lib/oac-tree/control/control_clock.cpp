@@ -0,0 +1,99 @@
+/******************************************************************************
+* $HeadURL: $
+* $Id: $
+*
+* Project       : Supervision and Automation - oac-tree
+*
+* Description   : SUP oac-tree control plugin
+*
+* Author        : Walter Van Herck (IO)
+*
+* Copyright (c) : 2010-2026 ITER Organization,
+*                 CS 90 046
+*                 13067 St. Paul-lez-Durance Cedex
+*                 France
+* SPDX-License-Identifier: MIT
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file LICENSE located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+
+#include "control_clock.h"
+
+#include <memory>
+
+namespace sup {
+
+namespace oac_tree {
+
+namespace
+{
+std::atomic<ControlClock*> g_control_clock{nullptr};
+}  // unnamed namespace
+
+ControlClock::~ControlClock() = default;
+
+ManualControlClock::ManualControlClock()
+  : ManualControlClock{Clock::now()}
+{}
+
+ManualControlClock::ManualControlClock(Clock::time_point start)
+  : ControlClock{}
+  , m_now{start.time_since_epoch().count()}
+{}
+
+ManualControlClock::~ManualControlClock() = default;
+
+ManualControlClock::Clock::time_point ManualControlClock::Now() const
+{
+  return Clock::time_point{Clock::duration{m_now.load(std::memory_order_acquire)}};
+}
+
+void ManualControlClock::Advance(Clock::duration duration)
+{
+  if (duration > Clock::duration::zero())
+  {
+    m_now.fetch_add(duration.count(), std::memory_order_acq_rel);
+  }
+}
+
+void ManualControlClock::AdvanceTo(Clock::time_point time)
+{
+  auto target = time.time_since_epoch().count();
+  auto current = m_now.load(std::memory_order_acquire);
+  while (current < target
+         && !m_now.compare_exchange_weak(current, target, std::memory_order_acq_rel))
+  {}
+}
+
+ControlClock::Clock::time_point ControlClockNow()
+{
+  auto clock = g_control_clock.load(std::memory_order_acquire);
+  return clock != nullptr ? clock->Now() : ControlClock::Clock::now();
+}
+
+void SetControlClock(ControlClock* clock)
+{
+  g_control_clock.store(clock, std::memory_order_release);
+}
+
+ControlClock* GetControlClock()
+{
+  return g_control_clock.load(std::memory_order_acquire);
+}
+
+ScopedControlClock::ScopedControlClock(ControlClock& clock)
+  : m_previous{g_control_clock.exchange(std::addressof(clock), std::memory_order_acq_rel)}
+{}
+
+ScopedControlClock::~ScopedControlClock()
+{
+  SetControlClock(m_previous);
+}
+
+} // namespace oac_tree
+
+} // namespace sup
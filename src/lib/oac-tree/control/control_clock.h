@@ -0,0 +1,119 @@
+/******************************************************************************
+* $HeadURL: $
+* $Id: $
+*
+* Project       : Supervision and Automation - oac-tree
+*
+* Description   : SUP oac-tree control plugin
+*
+* Author        : Walter Van Herck (IO)
+*
+* Copyright (c) : 2010-2026 ITER Organization,
+*                 CS 90 046
+*                 13067 St. Paul-lez-Durance Cedex
+*                 France
+* SPDX-License-Identifier: MIT
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file LICENSE located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+
+#ifndef SUP_OAC_TREE_PLUGIN_CONTROL_CONTROL_CLOCK_H_
+#define SUP_OAC_TREE_PLUGIN_CONTROL_CONTROL_CLOCK_H_
+
+#include <atomic>
+#include <chrono>
+
+namespace sup
+{
+namespace oac_tree
+{
+
+/**
+ * @brief Source of the current time for the timeout logic of the control instructions: deadlines
+ * of timeouts and retries, and the periods of throttled and debounced conditions.
+ *
+ * @details By default, the steady clock is used. Tests and simulations can install another clock,
+ * e.g. a ManualControlClock, to control the passing of time. Execution metrics and traces always
+ * measure real time.
+ */
+class ControlClock
+{
+public:
+  using Clock = std::chrono::steady_clock;
+
+  virtual ~ControlClock();
+
+  virtual Clock::time_point Now() const = 0;
+};
+
+/**
+ * @brief Clock that only advances when requested, so that timeouts can be simulated without
+ * waiting for them. It can be read and advanced from different threads.
+ */
+class ManualControlClock : public ControlClock
+{
+public:
+  /**
+   * @brief Construct a clock that starts at the current time of the steady clock.
+   */
+  ManualControlClock();
+  explicit ManualControlClock(Clock::time_point start);
+  ~ManualControlClock() override;
+
+  Clock::time_point Now() const override;
+
+  void Advance(Clock::duration duration);
+
+  /**
+   * @brief Advance the clock to the given time. Times in the past are ignored.
+   */
+  void AdvanceTo(Clock::time_point time);
+
+private:
+  std::atomic<Clock::rep> m_now;
+};
+
+/**
+ * @brief Current time of the installed control clock, or of the steady clock if no clock was
+ * installed.
+ */
+ControlClock::Clock::time_point ControlClockNow();
+
+/**
+ * @brief Install a clock for the timeout logic of all control instructions. Passing a null pointer
+ * restores the steady clock. The caller retains ownership and needs to keep the clock alive while
+ * it is installed.
+ */
+void SetControlClock(ControlClock* clock);
+
+/**
+ * @brief Retrieve the installed control clock, or a null pointer if the steady clock is used.
+ */
+ControlClock* GetControlClock();
+
+/**
+ * @brief Installs a control clock for the lifetime of this object and restores the previously
+ * installed clock afterwards.
+ */
+class ScopedControlClock
+{
+public:
+  explicit ScopedControlClock(ControlClock& clock);
+  ~ScopedControlClock();
+
+  ScopedControlClock(const ScopedControlClock&) = delete;
+  ScopedControlClock& operator=(const ScopedControlClock&) = delete;
+
+private:
+  ControlClock* m_previous;
+};
+
+}  // namespace oac_tree
+
+}  // namespace sup
+
+#endif  // SUP_OAC_TREE_PLUGIN_CONTROL_CONTROL_CLOCK_H_
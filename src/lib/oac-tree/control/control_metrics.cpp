@@ -0,0 +1,326 @@
+/******************************************************************************
+* $HeadURL: $
+* $Id: $
+*
+* Project       : Supervision and Automation - oac-tree
+*
+* Description   : SUP oac-tree control plugin
+*
+* Author        : Walter Van Herck (IO)
+*
+* Copyright (c) : 2010-2026 ITER Organization,
+*                 CS 90 046
+*                 13067 St. Paul-lez-Durance Cedex
+*                 France
+* SPDX-License-Identifier: MIT
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file LICENSE located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+
+#include "control_metrics.h"
+
+#include "control_trace.h"
+
+#include <sup/oac-tree/constants.h>
+#include <sup/oac-tree/instruction.h>
+
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <sstream>
+
+namespace sup {
+
+namespace oac_tree {
+
+const std::string CONTROL_METRICS_ENVIRONMENT_VARIABLE = "OAC_TREE_CONTROL_METRICS";
+
+namespace
+{
+std::atomic<bool>& ControlMetricsEnabledFlag()
+{
+  static std::atomic<bool> enabled{[]() {
+    auto value = std::getenv(CONTROL_METRICS_ENVIRONMENT_VARIABLE.c_str());
+    return value != nullptr && *value != '\0' && std::strcmp(value, "0") != 0;
+  }()};
+  return enabled;
+}
+
+void AddDuration(std::atomic<ControlMetrics::Clock::rep>& total,
+                 ControlMetrics::Clock::duration duration)
+{
+  (void)total.fetch_add(duration.count(), std::memory_order_relaxed);
+}
+
+void UpdateMaximum(std::atomic<ControlMetrics::Clock::rep>& maximum,
+                   ControlMetrics::Clock::duration duration)
+{
+  auto value = duration.count();
+  auto current = maximum.load(std::memory_order_relaxed);
+  while (value > current &&
+         !maximum.compare_exchange_weak(current, value, std::memory_order_relaxed))
+  {}
+}
+
+ControlMetrics::Clock::duration LoadDuration(const std::atomic<ControlMetrics::Clock::rep>& value)
+{
+  return ControlMetrics::Clock::duration(value.load(std::memory_order_relaxed));
+}
+
+std::string GetSectionName(ControlMetrics::Section section)
+{
+  switch (section)
+  {
+  case ControlMetrics::Section::kTick:
+    return "tick";
+  case ControlMetrics::Section::kCondition:
+    return "condition";
+  case ControlMetrics::Section::kAction:
+    return "action";
+  case ControlMetrics::Section::kUserDialog:
+    return "userDialog";
+  }
+  return "unknown";
+}
+
+double ToMilliseconds(ControlMetrics::Clock::duration duration)
+{
+  return std::chrono::duration<double, std::milli>(duration).count();
+}
+
+void AppendControlMetrics(const Instruction& instr, std::vector<ControlMetricsEntry>& entries)
+{
+  auto provider = dynamic_cast<const ControlMetricsProvider*>(std::addressof(instr));
+  if (provider != nullptr)
+  {
+    entries.push_back({ std::addressof(instr), provider->GetControlMetrics().GetSnapshot() });
+  }
+  for (auto child : instr.ChildInstructions())
+  {
+    AppendControlMetrics(*child, entries);
+  }
+}
+}  // unnamed namespace
+
+void SetControlMetricsEnabled(bool enabled)
+{
+  ControlMetricsEnabledFlag().store(enabled, std::memory_order_relaxed);
+}
+
+bool IsControlMetricsEnabled()
+{
+  return ControlMetricsEnabledFlag().load(std::memory_order_relaxed);
+}
+
+ControlMetrics::ControlMetrics()
+  : m_ticks{0}
+  , m_condition_evaluations{0}
+  , m_action_runs{0}
+  , m_retries{0}
+  , m_timeouts{0}
+  , m_condition_time{0}
+  , m_action_time{0}
+  , m_max_tick_latency{0}
+  , m_trace_label{}
+{}
+
+ControlMetrics::~ControlMetrics() = default;
+
+bool ControlMetrics::IsActive()
+{
+  return IsControlMetricsEnabled() || GetControlTraceSink() != nullptr;
+}
+
+void ControlMetrics::RecordTick(Clock::duration latency)
+{
+  (void)m_ticks.fetch_add(1, std::memory_order_relaxed);
+  UpdateMaximum(m_max_tick_latency, latency);
+}
+
+void ControlMetrics::RecordConditionEvaluation(Clock::duration duration)
+{
+  (void)m_condition_evaluations.fetch_add(1, std::memory_order_relaxed);
+  AddDuration(m_condition_time, duration);
+}
+
+void ControlMetrics::RecordActionTick(Clock::duration duration, bool started)
+{
+  if (started)
+  {
+    (void)m_action_runs.fetch_add(1, std::memory_order_relaxed);
+  }
+  AddDuration(m_action_time, duration);
+}
+
+void ControlMetrics::RecordRetry()
+{
+  (void)m_retries.fetch_add(1, std::memory_order_relaxed);
+}
+
+void ControlMetrics::RecordTimeout()
+{
+  (void)m_timeouts.fetch_add(1, std::memory_order_relaxed);
+  auto sink = GetControlTraceSink();
+  if (sink != nullptr)
+  {
+    sink->AddInstantEvent(m_trace_label, "timeout", Clock::now());
+  }
+}
+
+void ControlMetrics::Record(Section section, Clock::duration duration)
+{
+  switch (section)
+  {
+  case Section::kTick:
+    RecordTick(duration);
+    break;
+  case Section::kCondition:
+    RecordConditionEvaluation(duration);
+    break;
+  case Section::kAction:
+    RecordActionTick(duration, false);
+    break;
+  case Section::kUserDialog:
+    // Only traced
+    break;
+  }
+}
+
+ControlMetricsSnapshot ControlMetrics::GetSnapshot() const
+{
+  ControlMetricsSnapshot result;
+  result.m_ticks = m_ticks.load(std::memory_order_relaxed);
+  result.m_condition_evaluations = m_condition_evaluations.load(std::memory_order_relaxed);
+  result.m_action_runs = m_action_runs.load(std::memory_order_relaxed);
+  result.m_retries = m_retries.load(std::memory_order_relaxed);
+  result.m_timeouts = m_timeouts.load(std::memory_order_relaxed);
+  result.m_condition_time = LoadDuration(m_condition_time);
+  result.m_action_time = LoadDuration(m_action_time);
+  result.m_max_tick_latency = LoadDuration(m_max_tick_latency);
+  return result;
+}
+
+void ControlMetrics::SetTraceLabel(const std::string& label)
+{
+  m_trace_label = label;
+}
+
+const std::string& ControlMetrics::GetTraceLabel() const
+{
+  return m_trace_label;
+}
+
+void ControlMetrics::Trace(Section section, Clock::time_point start,
+                           Clock::duration duration) const
+{
+  auto sink = GetControlTraceSink();
+  if (sink == nullptr || (section == Section::kTick && !sink->TracesTicks()))
+  {
+    return;
+  }
+  sink->AddCompleteEvent(m_trace_label, GetSectionName(section), start, duration);
+}
+
+void ControlMetrics::Clear()
+{
+  m_ticks = 0;
+  m_condition_evaluations = 0;
+  m_action_runs = 0;
+  m_retries = 0;
+  m_timeouts = 0;
+  m_condition_time = 0;
+  m_action_time = 0;
+  m_max_tick_latency = 0;
+}
+
+ScopedMetricsTimer::ScopedMetricsTimer(ControlMetrics& metrics, ControlMetrics::Section section)
+  : m_metrics{metrics}
+  , m_section{section}
+  , m_active{ControlMetrics::IsActive()}
+  , m_start{m_active ? ControlMetrics::Clock::now() : ControlMetrics::Clock::time_point{}}
+{}
+
+ScopedMetricsTimer::~ScopedMetricsTimer()
+{
+  if (!m_active)
+  {
+    return;
+  }
+  auto duration = ControlMetrics::Clock::now() - m_start;
+  m_metrics.Record(m_section, duration);
+  m_metrics.Trace(m_section, m_start, duration);
+}
+
+ControlMetricsProvider::~ControlMetricsProvider() = default;
+
+void ExecuteMeasuredCondition(Instruction& condition, UserInterface& ui, Workspace& ws,
+                              ControlMetrics* metrics)
+{
+  if (metrics == nullptr || !ControlMetrics::IsActive())
+  {
+    condition.ExecuteSingle(ui, ws);
+    return;
+  }
+  ScopedMetricsTimer timer{*metrics, ControlMetrics::Section::kCondition};
+  condition.ExecuteSingle(ui, ws);
+}
+
+void ExecuteMeasuredAction(Instruction& action, UserInterface& ui, Workspace& ws,
+                           ControlMetrics* metrics)
+{
+  if (metrics == nullptr || !ControlMetrics::IsActive())
+  {
+    action.ExecuteSingle(ui, ws);
+    return;
+  }
+  bool started = action.GetStatus() == ExecutionStatus::NOT_STARTED;
+  auto start = ControlMetrics::Clock::now();
+  action.ExecuteSingle(ui, ws);
+  auto duration = ControlMetrics::Clock::now() - start;
+  metrics->RecordActionTick(duration, started);
+  metrics->Trace(ControlMetrics::Section::kAction, start, duration);
+}
+
+std::string GetInstructionLabel(const Instruction& instr)
+{
+  auto result = instr.GetType();
+  if (instr.HasAttribute(Constants::NAME_ATTRIBUTE_NAME))
+  {
+    result += " [" + instr.GetAttributeString(Constants::NAME_ATTRIBUTE_NAME) + "]";
+  }
+  return result;
+}
+
+std::vector<ControlMetricsEntry> CollectControlMetrics(const Instruction& root)
+{
+  std::vector<ControlMetricsEntry> result;
+  AppendControlMetrics(root, result);
+  return result;
+}
+
+std::string FormatControlMetrics(const std::vector<ControlMetricsEntry>& entries)
+{
+  std::ostringstream oss;
+  for (const auto& entry : entries)
+  {
+    const auto& metrics = entry.m_metrics;
+    oss << GetInstructionLabel(*entry.m_instruction) << ": ticks=" << metrics.m_ticks
+        << " conditionEvaluations=" << metrics.m_condition_evaluations
+        << " actionRuns=" << metrics.m_action_runs
+        << " retries=" << metrics.m_retries
+        << " timeouts=" << metrics.m_timeouts
+        << " conditionTimeMs=" << ToMilliseconds(metrics.m_condition_time)
+        << " actionTimeMs=" << ToMilliseconds(metrics.m_action_time)
+        << " maxTickLatencyMs=" << ToMilliseconds(metrics.m_max_tick_latency) << "\n";
+  }
+  return oss.str();
+}
+
+} // namespace oac_tree
+
+} // namespace sup
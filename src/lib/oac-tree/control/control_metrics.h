@@ -0,0 +1,216 @@
+/******************************************************************************
+* $HeadURL: $
+* $Id: $
+*
+* Project       : Supervision and Automation - oac-tree
+*
+* Description   : SUP oac-tree control plugin
+*
+* Author        : Walter Van Herck (IO)
+*
+* Copyright (c) : 2010-2026 ITER Organization,
+*                 CS 90 046
+*                 13067 St. Paul-lez-Durance Cedex
+*                 France
+* SPDX-License-Identifier: MIT
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file LICENSE located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+
+#ifndef SUP_OAC_TREE_PLUGIN_CONTROL_CONTROL_METRICS_H_
+#define SUP_OAC_TREE_PLUGIN_CONTROL_CONTROL_METRICS_H_
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace sup
+{
+namespace oac_tree
+{
+class Instruction;
+class UserInterface;
+class Workspace;
+
+/**
+ * @brief Name of the environment variable that enables the collection of execution metrics when
+ * the plugin is loaded. Any value other than an empty string or "0" enables it.
+ */
+extern const std::string CONTROL_METRICS_ENVIRONMENT_VARIABLE;
+
+/**
+ * @brief Enable or disable the collection of execution metrics by all control instructions. It is
+ * disabled by default, unless enabled by CONTROL_METRICS_ENVIRONMENT_VARIABLE.
+ */
+void SetControlMetricsEnabled(bool enabled);
+bool IsControlMetricsEnabled();
+
+/**
+ * @brief Snapshot of the execution metrics of a single control instruction.
+ *
+ * @details Action runs count how many times the action was started, while the action time
+ * includes all its ticks. The tick latency is the duration of a single tick of the control
+ * instruction itself.
+ */
+struct ControlMetricsSnapshot
+{
+  std::size_t m_ticks = 0;
+  std::size_t m_condition_evaluations = 0;
+  std::size_t m_action_runs = 0;
+  std::size_t m_retries = 0;
+  std::size_t m_timeouts = 0;
+  std::chrono::steady_clock::duration m_condition_time{};
+  std::chrono::steady_clock::duration m_action_time{};
+  std::chrono::steady_clock::duration m_max_tick_latency{};
+};
+
+/**
+ * @brief Lock-free execution counters of a control instruction. Recording only uses relaxed
+ * atomic operations, so it is cheap and can be done from any thread.
+ *
+ * @details Instructions only measure their ticks, condition evaluations and action ticks when
+ * IsActive returns true, so that disabled metrics do not cost any clock reads. Retries and
+ * timeouts are rare and always counted. When tracing is enabled (see
+ * GetControlTraceSink), recorded sections and timeouts are also added to the trace as events named
+ * after the trace label.
+ */
+class ControlMetrics
+{
+public:
+  using Clock = std::chrono::steady_clock;
+
+  enum class Section
+  {
+    kTick,
+    kCondition,
+    kAction,
+    kUserDialog
+  };
+
+  ControlMetrics();
+  ~ControlMetrics();
+
+  ControlMetrics(const ControlMetrics&) = delete;
+  ControlMetrics& operator=(const ControlMetrics&) = delete;
+
+  /**
+   * @brief Check if execution needs to be measured, i.e. if metrics or tracing are enabled.
+   */
+  static bool IsActive();
+
+  void RecordTick(Clock::duration latency);
+  void RecordConditionEvaluation(Clock::duration duration);
+  void RecordActionTick(Clock::duration duration, bool started);
+  void RecordRetry();
+  void RecordTimeout();
+  void Record(Section section, Clock::duration duration);
+
+  ControlMetricsSnapshot GetSnapshot() const;
+
+  /**
+   * @brief Set the name of the events in the trace, usually set during Setup of the instruction.
+   */
+  void SetTraceLabel(const std::string& label);
+  const std::string& GetTraceLabel() const;
+
+  /**
+   * @brief Add the section to the trace, if tracing is enabled. Ticks are only added when the
+   * trace sink traces ticks.
+   */
+  void Trace(Section section, Clock::time_point start, Clock::duration duration) const;
+
+  void Clear();
+
+private:
+  std::atomic<std::size_t> m_ticks;
+  std::atomic<std::size_t> m_condition_evaluations;
+  std::atomic<std::size_t> m_action_runs;
+  std::atomic<std::size_t> m_retries;
+  std::atomic<std::size_t> m_timeouts;
+  std::atomic<Clock::rep> m_condition_time;
+  std::atomic<Clock::rep> m_action_time;
+  std::atomic<Clock::rep> m_max_tick_latency;
+  std::string m_trace_label;
+};
+
+/**
+ * @brief Records the time spent in a scope as the given section of the metrics. Nothing is
+ * measured when the metrics are not active.
+ */
+class ScopedMetricsTimer
+{
+public:
+  ScopedMetricsTimer(ControlMetrics& metrics, ControlMetrics::Section section);
+  ~ScopedMetricsTimer();
+
+  ScopedMetricsTimer(const ScopedMetricsTimer&) = delete;
+  ScopedMetricsTimer& operator=(const ScopedMetricsTimer&) = delete;
+
+private:
+  ControlMetrics& m_metrics;
+  ControlMetrics::Section m_section;
+  const bool m_active;
+  ControlMetrics::Clock::time_point m_start;
+};
+
+/**
+ * @brief Interface for instructions that keep execution metrics.
+ */
+class ControlMetricsProvider
+{
+public:
+  virtual ~ControlMetricsProvider();
+
+  virtual const ControlMetrics& GetControlMetrics() const = 0;
+};
+
+/**
+ * @brief Execute a single tick of a condition and record it in the metrics, if present and active.
+ */
+void ExecuteMeasuredCondition(Instruction& condition, UserInterface& ui, Workspace& ws,
+                              ControlMetrics* metrics);
+
+/**
+ * @brief Execute a single tick of an action and record it in the metrics, if present and active.
+ * The action is counted as started when it was not started before this tick.
+ */
+void ExecuteMeasuredAction(Instruction& action, UserInterface& ui, Workspace& ws,
+                           ControlMetrics* metrics);
+
+/**
+ * @brief Human readable label of an instruction: its type, followed by its name if present.
+ */
+std::string GetInstructionLabel(const Instruction& instr);
+
+/**
+ * @brief Execution metrics of a single instruction in a tree.
+ */
+struct ControlMetricsEntry
+{
+  const Instruction* m_instruction;
+  ControlMetricsSnapshot m_metrics;
+};
+
+/**
+ * @brief Collect the metrics of all instructions in the tree that implement
+ * ControlMetricsProvider, in depth-first order.
+ */
+std::vector<ControlMetricsEntry> CollectControlMetrics(const Instruction& root);
+
+/**
+ * @brief Format collected metrics as a human readable table, one line per instruction, e.g. to
+ * dump them when a procedure has finished.
+ */
+std::string FormatControlMetrics(const std::vector<ControlMetricsEntry>& entries);
+
+}  // namespace oac_tree
+
+}  // namespace sup
+
+#endif  // SUP_OAC_TREE_PLUGIN_CONTROL_CONTROL_METRICS_H_
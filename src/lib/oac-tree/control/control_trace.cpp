@@ -0,0 +1,237 @@
+/******************************************************************************
+* $HeadURL: $
+* $Id: $
+*
+* Project       : Supervision and Automation - oac-tree
+*
+* Description   : SUP oac-tree control plugin
+*
+* Author        : Walter Van Herck (IO)
+*
+* Copyright (c) : 2010-2026 ITER Organization,
+*                 CS 90 046
+*                 13067 St. Paul-lez-Durance Cedex
+*                 France
+* SPDX-License-Identifier: MIT
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file LICENSE located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+
+#include "control_trace.h"
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+
+namespace sup {
+
+namespace oac_tree {
+
+const std::string CONTROL_TRACE_FILE_ENVIRONMENT_VARIABLE = "OAC_TREE_CONTROL_TRACE_FILE";
+const std::string CONTROL_TRACE_TICKS_ENVIRONMENT_VARIABLE = "OAC_TREE_CONTROL_TRACE_TICKS";
+
+const std::size_t ControlTraceSink::kChunkSize = 1024;
+
+namespace
+{
+// Written after the events, so that the file is complete after each write. It is overwritten by
+// the next chunk of events.
+const std::string kTraceTrailer = "\n],\"displayTimeUnit\":\"ms\"}\n";
+
+const ControlTraceSink::Clock::duration kMaxBufferAge = std::chrono::seconds(1);
+
+// Chrome trace thread ids are numbers: use small sequential ids that are unique per thread
+std::size_t GetTraceThreadId()
+{
+  static std::atomic<std::size_t> next_thread_id{1};
+  thread_local const std::size_t thread_id =
+    next_thread_id.fetch_add(1, std::memory_order_relaxed);
+  return thread_id;
+}
+
+bool IsTickTracingRequested()
+{
+  auto value = std::getenv(CONTROL_TRACE_TICKS_ENVIRONMENT_VARIABLE.c_str());
+  return value != nullptr && *value != '\0' && std::strcmp(value, "0") != 0;
+}
+
+std::string EscapeJsonString(const std::string& str)
+{
+  std::string result;
+  result.reserve(str.size());
+  for (auto c : str)
+  {
+    switch (c)
+    {
+    case '"':
+      result += "\\\"";
+      break;
+    case '\\':
+      result += "\\\\";
+      break;
+    default:
+      if (static_cast<unsigned char>(c) < 0x20)
+      {
+        char buffer[8];
+        (void)std::snprintf(buffer, sizeof(buffer), "\\u%04x", static_cast<unsigned>(c));
+        result += buffer;
+      }
+      else
+      {
+        result += c;
+      }
+      break;
+    }
+  }
+  return result;
+}
+
+double ToMicroseconds(ControlTraceSink::Clock::duration duration)
+{
+  return std::chrono::duration<double, std::micro>(duration).count();
+}
+
+void FlushControlTraceSink()
+{
+  (void)GetControlTraceSink()->Flush();
+}
+
+ControlTraceSink* CreateControlTraceSink()
+{
+  auto filename = std::getenv(CONTROL_TRACE_FILE_ENVIRONMENT_VARIABLE.c_str());
+  if (filename == nullptr || *filename == '\0')
+  {
+    return nullptr;
+  }
+  // The sink is never destroyed, since instructions on other threads (e.g. the worker pool) may
+  // still add events during static destruction. It is flushed at exit instead.
+  auto result = new ControlTraceSink(filename, IsTickTracingRequested());
+  (void)std::atexit(FlushControlTraceSink);
+  return result;
+}
+}  // unnamed namespace
+
+ControlTraceSink::ControlTraceSink(const std::string& filename, bool trace_ticks)
+  : m_trace_ticks{trace_ticks}
+  , m_origin{Clock::now()}
+  , m_mtx{}
+  , m_out{filename, std::ios::trunc}
+  , m_first_event{true}
+  , m_buffer{}
+  , m_buffer_start{}
+  , m_event_count{0}
+{
+  m_buffer.reserve(kChunkSize);
+  // Microsecond timestamps with nanosecond resolution
+  m_out << std::fixed << std::setprecision(3);
+  m_out << "{\"traceEvents\":[";
+  (void)WriteBuffer();
+}
+
+ControlTraceSink::~ControlTraceSink()
+{
+  (void)Flush();
+}
+
+bool ControlTraceSink::TracesTicks() const
+{
+  return m_trace_ticks;
+}
+
+void ControlTraceSink::AddCompleteEvent(const std::string& name, const std::string& category,
+                                        Clock::time_point start, Clock::duration duration)
+{
+  AddEvent({ name, category, 'X', start - m_origin, duration, 0 });
+}
+
+void ControlTraceSink::AddInstantEvent(const std::string& name, const std::string& category,
+                                       Clock::time_point time)
+{
+  AddEvent({ name, category, 'i', time - m_origin, Clock::duration::zero(), 0 });
+}
+
+std::size_t ControlTraceSink::GetEventCount() const
+{
+  std::lock_guard<std::mutex> lk{m_mtx};
+  return m_event_count;
+}
+
+std::size_t ControlTraceSink::GetBufferedEventCount() const
+{
+  std::lock_guard<std::mutex> lk{m_mtx};
+  return m_buffer.size();
+}
+
+bool ControlTraceSink::Flush()
+{
+  std::lock_guard<std::mutex> lk{m_mtx};
+  return WriteBuffer();
+}
+
+void ControlTraceSink::AddEvent(TraceEvent event)
+{
+  event.m_thread_id = GetTraceThreadId();
+  std::lock_guard<std::mutex> lk{m_mtx};
+  if (m_buffer.empty())
+  {
+    m_buffer_start = event.m_timestamp;
+  }
+  auto age = event.m_timestamp - m_buffer_start;
+  m_buffer.push_back(std::move(event));
+  ++m_event_count;
+  if (m_buffer.size() >= kChunkSize || age >= kMaxBufferAge)
+  {
+    (void)WriteBuffer();
+  }
+}
+
+bool ControlTraceSink::WriteBuffer()
+{
+  if (!m_out)
+  {
+    // Events are dropped, so that memory usage stays bounded
+    m_buffer.clear();
+    return false;
+  }
+  for (const auto& event : m_buffer)
+  {
+    m_out << (m_first_event ? "\n" : ",\n");
+    m_first_event = false;
+    m_out << "{\"name\":\"" << EscapeJsonString(event.m_name)
+          << "\",\"cat\":\"" << EscapeJsonString(event.m_category)
+          << "\",\"ph\":\"" << event.m_phase
+          << "\",\"ts\":" << ToMicroseconds(event.m_timestamp);
+    if (event.m_phase == 'X')
+    {
+      m_out << ",\"dur\":" << ToMicroseconds(event.m_duration);
+    }
+    else
+    {
+      // Instant events are scoped to their thread
+      m_out << ",\"s\":\"t\"";
+    }
+    m_out << ",\"pid\":1,\"tid\":" << event.m_thread_id << "}";
+  }
+  m_buffer.clear();
+  auto trailer_position = m_out.tellp();
+  m_out << kTraceTrailer;
+  m_out.flush();
+  (void)m_out.seekp(trailer_position);
+  return static_cast<bool>(m_out);
+}
+
+ControlTraceSink* GetControlTraceSink()
+{
+  static ControlTraceSink* sink = CreateControlTraceSink();
+  return sink;
+}
+
+} // namespace oac_tree
+
+} // namespace sup
@@ -0,0 +1,143 @@
+/******************************************************************************
+* $HeadURL: $
+* $Id: $
+*
+* Project       : Supervision and Automation - oac-tree
+*
+* Description   : SUP oac-tree control plugin
+*
+* Author        : Walter Van Herck (IO)
+*
+* Copyright (c) : 2010-2026 ITER Organization,
+*                 CS 90 046
+*                 13067 St. Paul-lez-Durance Cedex
+*                 France
+* SPDX-License-Identifier: MIT
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file LICENSE located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+
+#ifndef SUP_OAC_TREE_PLUGIN_CONTROL_CONTROL_TRACE_H_
+#define SUP_OAC_TREE_PLUGIN_CONTROL_CONTROL_TRACE_H_
+
+#include <chrono>
+#include <cstddef>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace sup
+{
+namespace oac_tree
+{
+
+/**
+ * @brief Name of the environment variable that enables tracing of the control instructions. Its
+ * value is the path of the trace file to write.
+ */
+extern const std::string CONTROL_TRACE_FILE_ENVIRONMENT_VARIABLE;
+
+/**
+ * @brief Name of the environment variable that additionally enables an event for every tick of a
+ * control instruction. Any value other than an empty string or "0" enables it.
+ */
+extern const std::string CONTROL_TRACE_TICKS_ENVIRONMENT_VARIABLE;
+
+/**
+ * @brief Collects timeline events of the control instructions and writes them as a JSON file in
+ * the Chrome trace event format, which can be opened with chrome://tracing or Perfetto.
+ *
+ * @details Events are buffered in chunks of bounded size. A chunk is appended to the trace file
+ * when it is full, when its oldest event is more than a second old or on Flush, so memory usage
+ * stays bounded and a trace of a crashed or killed process only misses its last chunk. The file is
+ * a complete JSON document after every write. Timestamps are relative to the creation of the sink.
+ * Adding events is thread safe.
+ */
+class ControlTraceSink
+{
+public:
+  using Clock = std::chrono::steady_clock;
+
+  static const std::size_t kChunkSize;
+
+  explicit ControlTraceSink(const std::string& filename, bool trace_ticks = false);
+  ~ControlTraceSink();
+
+  ControlTraceSink(const ControlTraceSink&) = delete;
+  ControlTraceSink& operator=(const ControlTraceSink&) = delete;
+
+  /**
+   * @brief Check if an event needs to be added for every tick of a control instruction.
+   */
+  bool TracesTicks() const;
+
+  /**
+   * @brief Add an event with a begin time and a duration, e.g. a condition evaluation.
+   */
+  void AddCompleteEvent(const std::string& name, const std::string& category,
+                        Clock::time_point start, Clock::duration duration);
+
+  /**
+   * @brief Add an event without duration, e.g. the expiry of a timeout.
+   */
+  void AddInstantEvent(const std::string& name, const std::string& category,
+                       Clock::time_point time);
+
+  /**
+   * @brief Total number of events added, including the ones already written.
+   */
+  std::size_t GetEventCount() const;
+
+  /**
+   * @brief Number of events that are buffered and not written yet.
+   */
+  std::size_t GetBufferedEventCount() const;
+
+  /**
+   * @brief Write all buffered events to the trace file.
+   *
+   * @return false if the file could not be written.
+   */
+  bool Flush();
+
+private:
+  struct TraceEvent
+  {
+    std::string m_name;
+    std::string m_category;
+    char m_phase;
+    Clock::duration m_timestamp;
+    Clock::duration m_duration;
+    std::size_t m_thread_id;
+  };
+  const bool m_trace_ticks;
+  Clock::time_point m_origin;
+  mutable std::mutex m_mtx;
+  std::ofstream m_out;
+  bool m_first_event;
+  std::vector<TraceEvent> m_buffer;
+  Clock::duration m_buffer_start;
+  std::size_t m_event_count;
+
+  void AddEvent(TraceEvent event);
+  bool WriteBuffer();
+};
+
+/**
+ * @brief Retrieve the trace sink of this plugin. It is created on first use when the environment
+ * variable CONTROL_TRACE_FILE_ENVIRONMENT_VARIABLE is set and nullptr is returned otherwise, so
+ * that disabled tracing only costs a pointer check. Remaining buffered events are written at
+ * program exit.
+ */
+ControlTraceSink* GetControlTraceSink();
+
+}  // namespace oac_tree
+
+}  // namespace sup
+
+#endif  // SUP_OAC_TREE_PLUGIN_CONTROL_CONTROL_TRACE_H_
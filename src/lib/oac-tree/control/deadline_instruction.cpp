@@ -0,0 +1,73 @@
+/******************************************************************************
+* $HeadURL: $
+* $Id: $
+*
+* Project       : Supervision and Automation - oac-tree
+*
+* Description   : SUP oac-tree control plugin
+*
+* Author        : Walter Van Herck (IO)
+*
+* Copyright (c) : 2010-2026 ITER Organization,
+*                 CS 90 046
+*                 13067 St. Paul-lez-Durance Cedex
+*                 France
+* SPDX-License-Identifier: MIT
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file LICENSE located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+
+#include "deadline_instruction.h"
+
+namespace sup {
+
+namespace oac_tree {
+
+const std::string DeadlineInstruction::Type = "Deadline";
+
+DeadlineInstruction::DeadlineInstruction(Instruction& owner, const std::string& timeout_attr_name)
+  : Instruction(Type)
+  , m_owner{owner}
+  , m_timeout_attr_name{timeout_attr_name}
+  , m_timer{}
+{}
+
+DeadlineInstruction::~DeadlineInstruction() = default;
+
+const DeadlineTimer& DeadlineInstruction::GetTimer() const
+{
+  return m_timer;
+}
+
+DeadlineTimer& DeadlineInstruction::GetTimer()
+{
+  return m_timer;
+}
+
+ExecutionStatus DeadlineInstruction::ExecuteSingleImpl(UserInterface& ui, Workspace& ws)
+{
+  if (!m_timer.IsStarted())
+  {
+    double timeout_sec = 0.0;
+    if (!m_owner.GetAttributeValueAs(m_timeout_attr_name, ws, ui, timeout_sec))
+    {
+      return ExecutionStatus::FAILURE;
+    }
+    m_timer.Start(timeout_sec);
+  }
+  return m_timer.IsExpired() ? ExecutionStatus::FAILURE : ExecutionStatus::RUNNING;
+}
+
+void DeadlineInstruction::ResetHook(UserInterface& ui)
+{
+  (void)ui;
+  m_timer.Stop();
+}
+
+} // namespace oac_tree
+
+} // namespace sup
@@ -0,0 +1,68 @@
+/******************************************************************************
+* $HeadURL: $
+* $Id: $
+*
+* Project       : Supervision and Automation - oac-tree
+*
+* Description   : SUP oac-tree control plugin
+*
+* Author        : Walter Van Herck (IO)
+*
+* Copyright (c) : 2010-2026 ITER Organization,
+*                 CS 90 046
+*                 13067 St. Paul-lez-Durance Cedex
+*                 France
+* SPDX-License-Identifier: MIT
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file LICENSE located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+
+#ifndef SUP_OAC_TREE_PLUGIN_CONTROL_DEADLINE_INSTRUCTION_H_
+#define SUP_OAC_TREE_PLUGIN_CONTROL_DEADLINE_INSTRUCTION_H_
+
+#include "deadline_timer.h"
+
+#include <sup/oac-tree/instruction.h>
+
+namespace sup
+{
+namespace oac_tree
+{
+
+/**
+ * @brief Internal instruction that returns RUNNING until a timeout has passed and FAILURE
+ * afterwards. The timeout is read from an attribute of the owning instruction when the
+ * instruction is first ticked after a reset.
+ *
+ * @details This instruction is not registered and is only used inside private instruction trees.
+ * It avoids creating a registry instruction with a copy of the timeout attribute.
+ */
+class DeadlineInstruction : public Instruction
+{
+public:
+  DeadlineInstruction(Instruction& owner, const std::string& timeout_attr_name);
+  ~DeadlineInstruction() override;
+
+  static const std::string Type;
+
+  const DeadlineTimer& GetTimer() const;
+  DeadlineTimer& GetTimer();
+
+private:
+  ExecutionStatus ExecuteSingleImpl(UserInterface& ui, Workspace& ws) override;
+  void ResetHook(UserInterface& ui) override;
+
+  Instruction& m_owner;
+  const std::string m_timeout_attr_name;
+  DeadlineTimer m_timer;
+};
+
+}  // namespace oac_tree
+
+}  // namespace sup
+
+#endif  // SUP_OAC_TREE_PLUGIN_CONTROL_DEADLINE_INSTRUCTION_H_
@@ -0,0 +1,147 @@
+/******************************************************************************
+* $HeadURL: $
+* $Id: $
+*
+* Project       : Supervision and Automation - oac-tree
+*
+* Description   : SUP oac-tree control plugin
+*
+* Author        : Walter Van Herck (IO)
+*
+* Copyright (c) : 2010-2026 ITER Organization,
+*                 CS 90 046
+*                 13067 St. Paul-lez-Durance Cedex
+*                 France
+* SPDX-License-Identifier: MIT
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file LICENSE located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+
+#include "deadline_timer.h"
+
+#include "control_clock.h"
+
+namespace sup {
+
+namespace oac_tree {
+
+DeadlineTimer::DeadlineTimer()
+  : m_started{false}
+  , m_expired{false}
+  , m_deadline{}
+  , m_expiry_latency{Clock::duration::zero()}
+{}
+
+DeadlineTimer::~DeadlineTimer() = default;
+
+void DeadlineTimer::Start(double timeout_sec)
+{
+  // Also catches NaN
+  if (!(timeout_sec > 0.0))
+  {
+    Start(Clock::duration::zero());
+    return;
+  }
+  // Timeouts that do not fit in the clock's duration, including infinity, never expire
+  const std::chrono::duration<double, Clock::period> timeout{
+    std::chrono::duration<double>(timeout_sec)};
+  if (timeout.count() >= static_cast<double>(Clock::duration::max().count()))
+  {
+    Start(Clock::duration::max());
+    return;
+  }
+  Start(std::chrono::duration_cast<Clock::duration>(timeout));
+}
+
+void DeadlineTimer::Start(Clock::duration timeout)
+{
+  if (timeout < Clock::duration::zero())
+  {
+    timeout = Clock::duration::zero();
+  }
+  const auto now = ControlClockNow();
+  // Clamp to the latest representable time point to avoid overflow
+  if (timeout > Clock::time_point::max() - now)
+  {
+    timeout = Clock::time_point::max() - now;
+  }
+  m_deadline = now + timeout;
+  m_started = true;
+  m_expired = false;
+  m_expiry_latency = Clock::duration::zero();
+}
+
+void DeadlineTimer::Stop()
+{
+  m_started = false;
+  m_expired = false;
+}
+
+bool DeadlineTimer::IsStarted() const
+{
+  return m_started;
+}
+
+bool DeadlineTimer::IsExpired()
+{
+  if (!m_started)
+  {
+    return false;
+  }
+  return IsExpired(ControlClockNow());
+}
+
+bool DeadlineTimer::IsExpired(Clock::time_point now)
+{
+  if (!m_started)
+  {
+    return false;
+  }
+  if (m_expired)
+  {
+    return true;
+  }
+  if (now < m_deadline)
+  {
+    return false;
+  }
+  m_expired = true;
+  m_expiry_latency = now - m_deadline;
+  return true;
+}
+
+DeadlineTimer::Clock::time_point DeadlineTimer::GetDeadline() const
+{
+  return m_deadline;
+}
+
+DeadlineTimer::Clock::duration DeadlineTimer::GetTimeRemaining() const
+{
+  if (!m_started || m_expired)
+  {
+    return Clock::duration::zero();
+  }
+  return GetTimeRemaining(ControlClockNow());
+}
+
+DeadlineTimer::Clock::duration DeadlineTimer::GetTimeRemaining(Clock::time_point now) const
+{
+  if (!m_started || m_expired || now >= m_deadline)
+  {
+    return Clock::duration::zero();
+  }
+  return m_deadline - now;
+}
+
+DeadlineTimer::Clock::duration DeadlineTimer::GetExpiryLatency() const
+{
+  return m_expiry_latency;
+}
+
+} // namespace oac_tree
+
+} // namespace sup
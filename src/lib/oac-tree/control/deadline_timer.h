@@ -0,0 +1,99 @@
+/******************************************************************************
+* $HeadURL: $
+* $Id: $
+*
+* Project       : Supervision and Automation - oac-tree
+*
+* Description   : SUP oac-tree control plugin
+*
+* Author        : Walter Van Herck (IO)
+*
+* Copyright (c) : 2010-2026 ITER Organization,
+*                 CS 90 046
+*                 13067 St. Paul-lez-Durance Cedex
+*                 France
+* SPDX-License-Identifier: MIT
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file LICENSE located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+
+#ifndef SUP_OAC_TREE_PLUGIN_CONTROL_DEADLINE_TIMER_H_
+#define SUP_OAC_TREE_PLUGIN_CONTROL_DEADLINE_TIMER_H_
+
+#include <chrono>
+
+namespace sup
+{
+namespace oac_tree
+{
+
+/**
+ * @brief Timeout based on an absolute deadline of the monotonic steady clock. The deadline is
+ * computed once when the timer is started, so that checking for expiration only requires a clock
+ * read and a comparison.
+ *
+ * @details The timer records how late the expiration was first observed, which allows to measure
+ * the jitter of timeouts.
+ *
+ * The methods without a time argument read the control clock (see ControlClockNow), so that
+ * timeouts follow a manual clock when one is installed.
+ */
+class DeadlineTimer
+{
+public:
+  using Clock = std::chrono::steady_clock;
+
+  DeadlineTimer();
+  ~DeadlineTimer();
+
+  /**
+   * @brief Start the timer with a timeout in seconds. Negative timeouts are treated as zero.
+   * Timeouts beyond the range of the clock, e.g. infinity, are clamped to the latest representable
+   * deadline.
+   */
+  void Start(double timeout_sec);
+  void Start(Clock::duration timeout);
+
+  /**
+   * @brief Stop the timer. A stopped timer never expires.
+   */
+  void Stop();
+
+  bool IsStarted() const;
+
+  /**
+   * @brief Check if the deadline has passed. The first positive check records the expiry latency.
+   */
+  bool IsExpired();
+  bool IsExpired(Clock::time_point now);
+
+  Clock::time_point GetDeadline() const;
+
+  /**
+   * @brief Time remaining until the deadline, or zero when expired or not started.
+   */
+  Clock::duration GetTimeRemaining() const;
+  Clock::duration GetTimeRemaining(Clock::time_point now) const;
+
+  /**
+   * @brief Time between the deadline and the first check that observed the expiration. This is
+   * zero if the expiration was not yet observed.
+   */
+  Clock::duration GetExpiryLatency() const;
+
+private:
+  bool m_started;
+  bool m_expired;
+  Clock::time_point m_deadline;
+  Clock::duration m_expiry_latency;
+};
+
+}  // namespace oac_tree
+
+}  // namespace sup
+
+#endif  // SUP_OAC_TREE_PLUGIN_CONTROL_DEADLINE_TIMER_H_
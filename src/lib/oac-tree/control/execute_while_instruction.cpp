@@ -22,6 +22,11 @@
 
 #include "execute_while_instruction.h"
 
+#include "building_block_factory.h"
+#include "instruction_attribute_utils.h"
+#include "log_forwarding_options.h"
+#include "pooled_instruction_ticker.h"
+#include "worker_pool.h"
 #include "wrapped_user_interface.h"
 
 #include <sup/oac-tree/constants.h>
@@ -38,24 +43,90 @@ static bool _execute_while_initialised_flag = RegisterGlobalInstruction<ExecuteW
 const std::string LOG_MESSAGE_PREFIX =
   "Forwarded log message from internal instruction of ExecuteWhile: ";
 
+const std::string EXECUTION_MODE_ATTRIBUTE = "executionMode";
+const std::string ASYNC_EXECUTION_MODE = "async";
+const std::string WORKER_POOL_EXECUTION_MODE = "workerPool";
+const std::string INTERLEAVED_EXECUTION_MODE = "interleaved";
+const std::string CONDITION_PERIOD_ATTRIBUTE = "conditionPeriod";
 
 ExecuteWhileInstruction::ExecuteWhileInstruction()
   : CompoundInstruction(Type)
+  , m_metrics{}
   , m_internal_instruction_tree{}
   , m_instr_manager{}
-{}
+  , m_condition{nullptr}
+  , m_action{nullptr}
+  , m_action_ticker{}
+  , m_halting_action{false}
+  , m_condition_throttle{std::addressof(m_metrics)}
+  , m_condition_debouncer{}
+  , m_lazy_setup{}
+{
+  (void)AddAttributeDefinition(EXECUTION_MODE_ATTRIBUTE);
+  (void)AddAttributeDefinition(LAZY_SETUP_ATTRIBUTE, sup::dto::BooleanType);
+  (void)AddAttributeDefinition(CONDITION_PERIOD_ATTRIBUTE, sup::dto::Float64Type);
+  (void)AddAttributeDefinition(STABLE_FOR_ATTRIBUTE, sup::dto::Float64Type);
+  (void)AddAttributeDefinition(STABLE_COUNT_ATTRIBUTE, sup::dto::UnsignedInteger32Type);
+  (void)AddAttributeDefinition(LOG_QUEUE_SIZE_ATTRIBUTE, sup::dto::UnsignedInteger32Type);
+  (void)AddAttributeDefinition(LOG_OVERFLOW_POLICY_ATTRIBUTE);
+  (void)AddAttributeDefinition(LOG_DEDUP_WINDOW_ATTRIBUTE, sup::dto::Float64Type);
+}
 
 ExecuteWhileInstruction::~ExecuteWhileInstruction() = default;
 
 void ExecuteWhileInstruction::SetupImpl(const Procedure& proc)
 {
-  auto instr_tree = CreateWrappedInstructionTree();
-  std::swap(m_internal_instruction_tree, instr_tree);
-  m_internal_instruction_tree->Setup(proc);
+  m_metrics.SetTraceLabel(GetInstructionLabel(*this));
+  m_internal_instruction_tree.reset();
+  m_action_ticker.reset();
+  m_condition = nullptr;
+  m_action = nullptr;
+  m_instr_manager.SetLogForwardingOptions(GetLogForwardingOptions(*this));
+  if (ChildInstructions().size() != 2)
+  {
+    std::string error_message = InstructionErrorProlog(*this) +
+      "This compound instruction requires exactly two child instructions";
+    throw InstructionSetupException(error_message);
+  }
+  auto condition_period = GetFloatAttribute(*this, CONDITION_PERIOD_ATTRIBUTE, 0.0);
+  if (condition_period < 0.0)
+  {
+    std::string error_message = InstructionErrorProlog(*this) +
+      "Attribute [" + CONDITION_PERIOD_ATTRIBUTE + "] must not be negative";
+    throw InstructionSetupException(error_message);
+  }
+  m_condition_throttle.SetPeriod(condition_period);
+  ConfigureConditionDebouncer(*this, m_condition_debouncer);
+  auto execution_mode = GetStringAttribute(*this, EXECUTION_MODE_ATTRIBUTE, ASYNC_EXECUTION_MODE);
+  if (execution_mode == WORKER_POOL_EXECUTION_MODE || execution_mode == INTERLEAVED_EXECUTION_MODE)
+  {
+    const bool use_worker_pool = execution_mode == WORKER_POOL_EXECUTION_MODE;
+    m_lazy_setup.Setup(*this, proc, [this, use_worker_pool](const Procedure& p) {
+      SetupNative(p, use_worker_pool);
+    });
+    return;
+  }
+  if (execution_mode != ASYNC_EXECUTION_MODE)
+  {
+    std::string error_message = InstructionErrorProlog(*this) +
+      "Unknown execution mode [" + execution_mode + "], expected [" + ASYNC_EXECUTION_MODE +
+      "], [" + WORKER_POOL_EXECUTION_MODE + "] or [" + INTERLEAVED_EXECUTION_MODE + "]";
+    throw InstructionSetupException(error_message);
+  }
+  m_lazy_setup.Setup(*this, proc, [this](const Procedure& p) { SetupAsync(p); });
 }
 
 ExecutionStatus ExecuteWhileInstruction::ExecuteSingleImpl(UserInterface& ui, Workspace& ws)
 {
+  ScopedMetricsTimer tick_timer{m_metrics, ControlMetrics::Section::kTick};
+  if (!m_lazy_setup.Complete(ui))
+  {
+    return ExecutionStatus::FAILURE;
+  }
+  if (m_condition != nullptr)
+  {
+    return ExecuteNative(ui, ws);
+  }
   auto& wrapped_ui = m_instr_manager.GetWrappedUI(ui, LOG_MESSAGE_PREFIX);
   m_internal_instruction_tree->ExecuteSingle(wrapped_ui, ws);
   return m_internal_instruction_tree->GetStatus();
@@ -63,6 +134,11 @@ ExecutionStatus ExecuteWhileInstruction::ExecuteSingleImpl(UserInterface& ui, Wo
 
 void ExecuteWhileInstruction::HaltImpl(UserInterface& ui)
 {
+  if (m_condition != nullptr)
+  {
+    m_condition->Halt(ui);
+    HaltAction(ui);
+  }
   if (m_internal_instruction_tree)
   {
     auto& wrapped_ui = m_instr_manager.GetWrappedUI(ui, LOG_MESSAGE_PREFIX);
@@ -70,12 +146,40 @@ void ExecuteWhileInstruction::HaltImpl(UserInterface& ui)
   }
 }
 
+std::size_t ExecuteWhileInstruction::GetConditionEvaluationCount() const
+{
+  return m_condition_throttle.GetEvaluationCount();
+}
+
+std::size_t ExecuteWhileInstruction::GetSkippedConditionEvaluationCount() const
+{
+  return m_condition_throttle.GetSkippedEvaluationCount();
+}
+
+const ControlMetrics& ExecuteWhileInstruction::GetControlMetrics() const
+{
+  return m_metrics;
+}
+
 void ExecuteWhileInstruction::ResetHook(UserInterface& ui)
 {
+  m_condition_throttle.Reset();
+  m_condition_debouncer.Reset();
+  m_halting_action = false;
+  if (m_condition != nullptr)
+  {
+    if (m_action_ticker)
+    {
+      m_action_ticker->Wait();
+      m_action_ticker->ClearFailure();
+    }
+    ResetChildren(ui);
+  }
   if (m_internal_instruction_tree)
   {
     auto& wrapped_ui = m_instr_manager.GetWrappedUI(ui, LOG_MESSAGE_PREFIX);
     m_internal_instruction_tree->Reset(wrapped_ui);
+    m_instr_manager.ReleaseRetiredUIs();
   }
 }
 
@@ -90,24 +194,116 @@ std::unique_ptr<Instruction> ExecuteWhileInstruction::CreateWrappedInstructionTr
     throw InstructionSetupException(error_message);
   }
 
-  // Wrapped condition
-  auto condition_wrapper = m_instr_manager.CreateInstructionWrapper(*children[1]);
+  // Wrapped condition, which is also counted, throttled and debounced
+  auto condition_wrapper = m_instr_manager.CreateThrottledWrapper(
+    *children[1], m_condition_throttle, std::addressof(m_condition_debouncer));
 
   // Wrapped action tree
-  auto tree_wrapper = m_instr_manager.CreateInstructionWrapper(*children[0]);
+  auto tree_wrapper = m_instr_manager.CreateMeasuredWrapper(*children[0], m_metrics,
+                                                            ControlMetrics::Section::kAction);
 
   // Make action asynchronous
-  auto async_action = GlobalInstructionRegistry().Create("Async");
+  auto async_action = CreateBuildingBlock(BuildingBlock::kAsync);
   (void)async_action->InsertInstruction(std::move(tree_wrapper), 0);
 
   // Reactive sequence combining the condition and the action
-  auto reactive_sequence = GlobalInstructionRegistry().Create("ReactiveSequence");
+  auto reactive_sequence = CreateBuildingBlock(BuildingBlock::kReactiveSequence);
   (void)reactive_sequence->InsertInstruction(std::move(condition_wrapper), 0);
   (void)reactive_sequence->InsertInstruction(std::move(async_action), 1);
 
   return reactive_sequence;
 }
 
+void ExecuteWhileInstruction::SetupAsync(const Procedure& proc)
+{
+  auto instr_tree = CreateWrappedInstructionTree();
+  std::swap(m_internal_instruction_tree, instr_tree);
+  m_internal_instruction_tree->Setup(proc);
+}
+
+void ExecuteWhileInstruction::SetupNative(const Procedure& proc, bool use_worker_pool)
+{
+  auto children = ChildInstructions();
+  SetupChildren(proc);
+  m_action = children[0];
+  m_condition = children[1];
+  if (use_worker_pool)
+  {
+    m_action_ticker =
+      std::make_unique<PooledInstructionTicker>(GetControlWorkerPool(), *m_action,
+                                                std::addressof(m_metrics));
+  }
+}
+
+ExecutionStatus ExecuteWhileInstruction::ExecuteNative(UserInterface& ui, Workspace& ws)
+{
+  // The job in flight of an interrupted action is awaited without blocking
+  if (m_halting_action)
+  {
+    return m_action_ticker->IsBusy() ? ExecutionStatus::RUNNING : ExecutionStatus::FAILURE;
+  }
+  // The condition is re-evaluated on every tick, as in a ReactiveSequence, unless throttled.
+  auto condition_status =
+    m_condition_debouncer.Update(m_condition_throttle.Evaluate(*m_condition, ui, ws));
+  if (condition_status == ExecutionStatus::FAILURE)
+  {
+    HaltAction(ui);
+    if (m_action_ticker && m_action_ticker->IsBusy())
+    {
+      m_halting_action = true;
+      return ExecutionStatus::RUNNING;
+    }
+    return ExecutionStatus::FAILURE;
+  }
+  if (condition_status != ExecutionStatus::SUCCESS)
+  {
+    return condition_status;
+  }
+  if (!m_action_ticker)
+  {
+    return TickActionInterleaved(ui, ws);
+  }
+  // A job of the action is in flight: its status cannot be read safely
+  if (m_action_ticker->IsBusy())
+  {
+    return ExecutionStatus::RUNNING;
+  }
+  // The error was already logged by the job
+  if (m_action_ticker->HasFailed())
+  {
+    return ExecutionStatus::FAILURE;
+  }
+  auto action_status = m_action->GetStatus();
+  if (IsFinishedStatus(action_status))
+  {
+    return action_status;
+  }
+  // When the pool queue is full, the job is submitted again on the next tick
+  (void)m_action_ticker->SubmitTicks(ui, ws);
+  return ExecutionStatus::RUNNING;
+}
+
+ExecutionStatus ExecuteWhileInstruction::TickActionInterleaved(UserInterface& ui, Workspace& ws)
+{
+  auto action_status = m_action->GetStatus();
+  if (NeedsExecute(action_status))
+  {
+    ExecuteMeasuredAction(*m_action, ui, ws, std::addressof(m_metrics));
+    action_status = m_action->GetStatus();
+  }
+  return IsFinishedStatus(action_status) ? action_status : ExecutionStatus::RUNNING;
+}
+
+void ExecuteWhileInstruction::HaltAction(UserInterface& ui)
+{
+  // Does not wait for a job in flight: this only happens on Reset
+  m_action->Halt(ui);
+  if (m_action_ticker)
+  {
+    m_action_ticker->Halt();
+  }
+}
+
 } // namespace oac_tree
 
 } // namespace sup
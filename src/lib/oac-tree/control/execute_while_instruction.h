@@ -23,6 +23,10 @@
 #ifndef SUP_OAC_TREE_PLUGIN_CONTROL_EXECUTE_WHILE_INSTRUCTION_H_
 #define SUP_OAC_TREE_PLUGIN_CONTROL_EXECUTE_WHILE_INSTRUCTION_H_
 
+#include "condition_debouncer.h"
+#include "condition_throttle.h"
+#include "control_metrics.h"
+#include "lazy_setup.h"
 #include "wrapped_instruction_manager.h"
 
 #include <sup/oac-tree/compound_instruction.h>
@@ -33,6 +37,7 @@ namespace sup
 {
 namespace oac_tree
 {
+class PooledInstructionTicker;
 
 /**
  * @brief Executes an instruction while continuously checking a condition still holds. It interrupts
@@ -42,8 +47,24 @@ namespace oac_tree
  * @details This compound instruction expects exactly two child instructions: the first one is the
  * instruction (or tree) to execute while the condition holds and the second one is the condition
  * to check.
+ *
+ * By default, the action is executed asynchronously in its own thread. In worker pool execution
+ * mode, the action is ticked by jobs on the worker pool shared by this plugin instead, without
+ * blocking the tick of this instruction. In interleaved execution mode, the action is ticked on
+ * the calling thread, right after the condition, which suits actions that do not block and return
+ * RUNNING instead.
+ *
+ * The optional 'conditionPeriod' attribute (in seconds) limits how often the condition is
+ * evaluated: in between evaluations, its last outcome is reused.
+ *
+ * The optional 'stableFor' (in seconds) and 'stableCount' (in ticks) attributes debounce a noisy
+ * condition: a change of its outcome is only taken into account when it persists. The action only
+ * starts when the condition held and is only interrupted when the condition failed for that long.
+ *
+ * With the 'lazySetup' attribute, the child instructions and the internal instruction tree are
+ * only set up on the first tick.
  */
-class ExecuteWhileInstruction : public CompoundInstruction
+class ExecuteWhileInstruction : public CompoundInstruction, public ControlMetricsProvider
 {
 public:
   ExecuteWhileInstruction();
@@ -51,15 +72,37 @@ public:
 
   static const std::string Type;
 
+  /**
+   * @brief Number of times the condition was executed and number of times its cached outcome was
+   * used instead, since construction of this instruction.
+   */
+  std::size_t GetConditionEvaluationCount() const;
+  std::size_t GetSkippedConditionEvaluationCount() const;
+
+  const ControlMetrics& GetControlMetrics() const override;
+
 private:
   void SetupImpl(const Procedure& proc) override;
   ExecutionStatus ExecuteSingleImpl(UserInterface& ui, Workspace& ws) override;
   void HaltImpl(UserInterface& ui) override;
   void ResetHook(UserInterface& ui) override;
   std::unique_ptr<Instruction> CreateWrappedInstructionTree();
+  void SetupAsync(const Procedure& proc);
+  void SetupNative(const Procedure& proc, bool use_worker_pool);
+  ExecutionStatus ExecuteNative(UserInterface& ui, Workspace& ws);
+  ExecutionStatus TickActionInterleaved(UserInterface& ui, Workspace& ws);
+  void HaltAction(UserInterface& ui);
 
+  ControlMetrics m_metrics;
   std::unique_ptr<Instruction> m_internal_instruction_tree;
   WrappedInstructionManager m_instr_manager;
+  Instruction* m_condition;
+  Instruction* m_action;
+  std::unique_ptr<PooledInstructionTicker> m_action_ticker;
+  bool m_halting_action;
+  ConditionThrottle m_condition_throttle;
+  ConditionDebouncer m_condition_debouncer;
+  LazySetup m_lazy_setup;
 };
 
 }  // namespace oac_tree
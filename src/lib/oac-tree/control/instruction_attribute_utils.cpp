@@ -0,0 +1,120 @@
+/******************************************************************************
+* $HeadURL: $
+* $Id: $
+*
+* Project       : Supervision and Automation - oac-tree
+*
+* Description   : SUP oac-tree control plugin
+*
+* Author        : Walter Van Herck (IO)
+*
+* Copyright (c) : 2010-2026 ITER Organization,
+*                 CS 90 046
+*                 13067 St. Paul-lez-Durance Cedex
+*                 France
+* SPDX-License-Identifier: MIT
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file LICENSE located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+#include "instruction_attribute_utils.h"
+
+#include <sup/oac-tree/exceptions.h>
+#include <sup/oac-tree/instruction.h>
+#include <sup/oac-tree/instruction_utils.h>
+
+#include <stdexcept>
+
+namespace sup {
+
+namespace oac_tree {
+
+bool GetBooleanAttribute(const Instruction& instr, const std::string& attr_name,
+                         bool default_value)
+{
+  if (!instr.HasAttribute(attr_name))
+  {
+    return default_value;
+  }
+  auto attr_str = instr.GetAttributeString(attr_name);
+  if (attr_str == "true")
+  {
+    return true;
+  }
+  if (attr_str == "false")
+  {
+    return false;
+  }
+  return default_value;
+}
+
+std::size_t GetUnsignedIntegerAttribute(const Instruction& instr, const std::string& attr_name,
+                                        std::size_t default_value)
+{
+  if (!instr.HasAttribute(attr_name))
+  {
+    return default_value;
+  }
+  auto attr_str = instr.GetAttributeString(attr_name);
+  try
+  {
+    std::size_t pos = 0;
+    auto result = std::stoull(attr_str, &pos);
+    if (pos == attr_str.size() && attr_str.find('-') == std::string::npos)
+    {
+      return static_cast<std::size_t>(result);
+    }
+  }
+  catch (const std::logic_error&)
+  {
+    // Handled below
+  }
+  std::string error_message = InstructionErrorProlog(instr) +
+    "Could not parse attribute [" + attr_name + "] with value [" + attr_str +
+    "] as an unsigned integer";
+  throw InstructionSetupException(error_message);
+}
+
+double GetFloatAttribute(const Instruction& instr, const std::string& attr_name,
+                         double default_value)
+{
+  if (!instr.HasAttribute(attr_name))
+  {
+    return default_value;
+  }
+  auto attr_str = instr.GetAttributeString(attr_name);
+  try
+  {
+    std::size_t pos = 0;
+    auto result = std::stod(attr_str, &pos);
+    if (pos == attr_str.size())
+    {
+      return result;
+    }
+  }
+  catch (const std::logic_error&)
+  {
+    // Handled below
+  }
+  std::string error_message = InstructionErrorProlog(instr) +
+    "Could not parse attribute [" + attr_name + "] with value [" + attr_str +
+    "] as a floating point number";
+  throw InstructionSetupException(error_message);
+}
+
+std::string GetStringAttribute(const Instruction& instr, const std::string& attr_name,
+                               const std::string& default_value)
+{
+  if (!instr.HasAttribute(attr_name))
+  {
+    return default_value;
+  }
+  return instr.GetAttributeString(attr_name);
+}
+
+} // namespace oac_tree
+
+} // namespace sup
@@ -0,0 +1,77 @@
+/******************************************************************************
+* $HeadURL: $
+* $Id: $
+*
+* Project       : Supervision and Automation - oac-tree
+*
+* Description   : SUP oac-tree control plugin
+*
+* Author        : Walter Van Herck (IO)
+*
+* Copyright (c) : 2010-2026 ITER Organization,
+*                 CS 90 046
+*                 13067 St. Paul-lez-Durance Cedex
+*                 France
+* SPDX-License-Identifier: MIT
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file LICENSE located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+#ifndef SUP_OAC_TREE_PLUGIN_CONTROL_INSTRUCTION_ATTRIBUTE_UTILS_H_
+#define SUP_OAC_TREE_PLUGIN_CONTROL_INSTRUCTION_ATTRIBUTE_UTILS_H_
+
+#include <cstddef>
+#include <string>
+
+namespace sup
+{
+namespace oac_tree
+{
+class Instruction;
+
+/**
+ * @brief Retrieve the value of a literal boolean attribute that is used to configure the
+ * instruction during Setup.
+ *
+ * @return Parsed value or the provided default value if the attribute is not present.
+ */
+bool GetBooleanAttribute(const Instruction& instr, const std::string& attr_name,
+                         bool default_value);
+
+/**
+ * @brief Retrieve the value of a literal unsigned integer attribute that is used to configure the
+ * instruction during Setup.
+ *
+ * @return Parsed value or the provided default value if the attribute is not present.
+ * @throws InstructionSetupException when the attribute value cannot be parsed.
+ */
+std::size_t GetUnsignedIntegerAttribute(const Instruction& instr, const std::string& attr_name,
+                                        std::size_t default_value);
+
+/**
+ * @brief Retrieve the value of a literal floating point attribute that is used to configure the
+ * instruction during Setup.
+ *
+ * @return Parsed value or the provided default value if the attribute is not present.
+ * @throws InstructionSetupException when the attribute value cannot be parsed.
+ */
+double GetFloatAttribute(const Instruction& instr, const std::string& attr_name,
+                         double default_value);
+
+/**
+ * @brief Retrieve the value of a literal string attribute that is used to configure the
+ * instruction during Setup.
+ *
+ * @return Attribute value or the provided default value if the attribute is not present.
+ */
+std::string GetStringAttribute(const Instruction& instr, const std::string& attr_name,
+                               const std::string& default_value);
+
+}  // namespace oac_tree
+
+}  // namespace sup
+
+#endif  // SUP_OAC_TREE_PLUGIN_CONTROL_INSTRUCTION_ATTRIBUTE_UTILS_H_
@@ -0,0 +1,106 @@
+/******************************************************************************
+* $HeadURL: $
+* $Id: $
+*
+* Project       : Supervision and Automation - oac-tree
+*
+* Description   : SUP oac-tree control plugin
+*
+* Author        : Walter Van Herck (IO)
+*
+* Copyright (c) : 2010-2026 ITER Organization,
+*                 CS 90 046
+*                 13067 St. Paul-lez-Durance Cedex
+*                 France
+* SPDX-License-Identifier: MIT
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file LICENSE located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+
+#include "lazy_setup.h"
+
+#include "instruction_attribute_utils.h"
+
+#include <sup/oac-tree/exceptions.h>
+#include <sup/oac-tree/instruction.h>
+#include <sup/oac-tree/instruction_utils.h>
+#include <sup/oac-tree/user_interface.h>
+
+#include <exception>
+#include <memory>
+#include <utility>
+
+namespace sup {
+
+namespace oac_tree {
+
+const std::string LAZY_SETUP_ATTRIBUTE = "lazySetup";
+
+LazySetup::LazySetup()
+  : m_instruction{nullptr}
+  , m_procedure{nullptr}
+  , m_setup{}
+  , m_failed{false}
+{}
+
+LazySetup::~LazySetup() = default;
+
+void LazySetup::Setup(const Instruction& instr, const Procedure& proc, SetupFunction setup)
+{
+  m_instruction = nullptr;
+  m_procedure = nullptr;
+  m_setup = nullptr;
+  m_failed = false;
+  if (!GetBooleanAttribute(instr, LAZY_SETUP_ATTRIBUTE, false))
+  {
+    setup(proc);
+    return;
+  }
+  m_instruction = std::addressof(instr);
+  m_procedure = std::addressof(proc);
+  m_setup = std::move(setup);
+}
+
+bool LazySetup::IsPending() const
+{
+  return m_procedure != nullptr;
+}
+
+bool LazySetup::Complete(UserInterface& ui)
+{
+  if (m_procedure != nullptr)
+  {
+    const auto& proc = *m_procedure;
+    m_procedure = nullptr;
+    try
+    {
+      m_setup(proc);
+    }
+    catch (const InstructionSetupException& e)
+    {
+      LogError(ui, e.what());
+      m_failed = true;
+    }
+    catch (const std::exception& e)
+    {
+      LogError(ui, InstructionErrorProlog(*m_instruction) + "Deferred setup failed: " + e.what());
+      m_failed = true;
+    }
+    catch (...)
+    {
+      LogError(ui, InstructionErrorProlog(*m_instruction) +
+                   "Deferred setup failed with an unknown exception");
+      m_failed = true;
+    }
+    m_setup = nullptr;
+  }
+  return !m_failed;
+}
+
+} // namespace oac_tree
+
+} // namespace sup
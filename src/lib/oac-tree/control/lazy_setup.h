@@ -0,0 +1,91 @@
+/******************************************************************************
+* $HeadURL: $
+* $Id: $
+*
+* Project       : Supervision and Automation - oac-tree
+*
+* Description   : SUP oac-tree control plugin
+*
+* Author        : Walter Van Herck (IO)
+*
+* Copyright (c) : 2010-2026 ITER Organization,
+*                 CS 90 046
+*                 13067 St. Paul-lez-Durance Cedex
+*                 France
+* SPDX-License-Identifier: MIT
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file LICENSE located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+
+#ifndef SUP_OAC_TREE_PLUGIN_CONTROL_LAZY_SETUP_H_
+#define SUP_OAC_TREE_PLUGIN_CONTROL_LAZY_SETUP_H_
+
+#include <functional>
+#include <string>
+
+namespace sup
+{
+namespace oac_tree
+{
+class Instruction;
+class Procedure;
+class UserInterface;
+
+extern const std::string LAZY_SETUP_ATTRIBUTE;
+
+/**
+ * @brief Setup of the child instructions and internal instruction tree of a control instruction,
+ * which is optionally deferred until the instruction is executed for the first time.
+ *
+ * @details When the lazySetup attribute of the instruction is true, the setup function is stored
+ * and only called on the first tick. Instructions in branches that never execute then do not
+ * create their internal instruction trees. Only the setup of the children and the construction of
+ * internal trees should be deferred: cheap structural validation, like the number of children,
+ * belongs in SetupImpl, so that malformed procedures are still rejected when they are set up.
+ * Errors of the deferred setup, including any exception thrown by a child's Setup, are logged to
+ * the user interface and make the instruction fail.
+ */
+class LazySetup
+{
+public:
+  using SetupFunction = std::function<void(const Procedure&)>;
+
+  LazySetup();
+  ~LazySetup();
+
+  /**
+   * @brief Call the setup function, or store it when lazy setup is enabled for the instruction.
+   *
+   * @throws InstructionSetupException when the lazySetup attribute is invalid or the setup
+   * function throws.
+   */
+  void Setup(const Instruction& instr, const Procedure& proc, SetupFunction setup);
+
+  /**
+   * @brief Check if the setup was deferred and was not completed yet.
+   */
+  bool IsPending() const;
+
+  /**
+   * @brief Call the deferred setup function, if any.
+   *
+   * @return false when the deferred setup failed now or before.
+   */
+  bool Complete(UserInterface& ui);
+
+private:
+  const Instruction* m_instruction;
+  const Procedure* m_procedure;
+  SetupFunction m_setup;
+  bool m_failed;
+};
+
+}  // namespace oac_tree
+
+}  // namespace sup
+
+#endif  // SUP_OAC_TREE_PLUGIN_CONTROL_LAZY_SETUP_H_
@@ -0,0 +1,76 @@
+/******************************************************************************
+* $HeadURL: $
+* $Id: $
+*
+* Project       : Supervision and Automation - oac-tree
+*
+* Description   : SUP oac-tree control plugin
+*
+* Author        : Walter Van Herck (IO)
+*
+* Copyright (c) : 2010-2026 ITER Organization,
+*                 CS 90 046
+*                 13067 St. Paul-lez-Durance Cedex
+*                 France
+* SPDX-License-Identifier: MIT
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file LICENSE located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+
+#include "log_deduplicator.h"
+
+namespace sup {
+
+namespace oac_tree {
+
+LogDeduplicator::LogDeduplicator(Clock::duration window)
+  : m_window{window}
+  , m_has_last{false}
+  , m_last_severity{0}
+  , m_last_message{}
+  , m_window_end{}
+  , m_repeat_count{0}
+{}
+
+LogDeduplicator::~LogDeduplicator() = default;
+
+bool LogDeduplicator::Register(int severity, const std::string& message, Clock::time_point now,
+                               LogRepeatSummary& summary)
+{
+  summary.m_count = 0;
+  if (m_has_last && severity == m_last_severity && now < m_window_end
+      && message == m_last_message)
+  {
+    ++m_repeat_count;
+    return false;
+  }
+  (void)TakeSummary(summary);
+  m_has_last = true;
+  m_last_severity = severity;
+  // Assignment reuses the capacity of the stored message
+  (void)m_last_message.assign(message);
+  m_window_end = now + m_window;
+  return true;
+}
+
+bool LogDeduplicator::TakeSummary(LogRepeatSummary& summary)
+{
+  if (m_repeat_count == 0)
+  {
+    summary.m_count = 0;
+    return false;
+  }
+  summary.m_severity = m_last_severity;
+  summary.m_count = m_repeat_count;
+  (void)summary.m_message.assign(m_last_message);
+  m_repeat_count = 0;
+  return true;
+}
+
+} // namespace oac_tree
+
+} // namespace sup
@@ -0,0 +1,92 @@
+/******************************************************************************
+* $HeadURL: $
+* $Id: $
+*
+* Project       : Supervision and Automation - oac-tree
+*
+* Description   : SUP oac-tree control plugin
+*
+* Author        : Walter Van Herck (IO)
+*
+* Copyright (c) : 2010-2026 ITER Organization,
+*                 CS 90 046
+*                 13067 St. Paul-lez-Durance Cedex
+*                 France
+* SPDX-License-Identifier: MIT
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file LICENSE located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+
+#ifndef SUP_OAC_TREE_PLUGIN_CONTROL_LOG_DEDUPLICATOR_H_
+#define SUP_OAC_TREE_PLUGIN_CONTROL_LOG_DEDUPLICATOR_H_
+
+#include <chrono>
+#include <cstddef>
+#include <string>
+
+namespace sup
+{
+namespace oac_tree
+{
+
+/**
+ * @brief Summary of identical log messages that were suppressed.
+ */
+struct LogRepeatSummary
+{
+  int m_severity = 0;
+  std::size_t m_count = 0;
+  std::string m_message;
+};
+
+/**
+ * @brief Collapses identical log messages (same severity and text) that follow each other within
+ * a time window. The first message of a window is passed, while identical messages inside the
+ * window are only counted. The count is returned as a summary when a different message arrives,
+ * when the window has expired or when the summary is explicitly taken.
+ *
+ * @note This class is not thread safe.
+ */
+class LogDeduplicator
+{
+public:
+  using Clock = std::chrono::steady_clock;
+
+  explicit LogDeduplicator(Clock::duration window);
+  ~LogDeduplicator();
+
+  /**
+   * @brief Register a new message.
+   *
+   * @param summary Filled with the suppressed repetitions of the previous message, if any. These
+   * need to be reported before the new message.
+   * @return true if the message needs to be forwarded, false if it was suppressed.
+   */
+  bool Register(int severity, const std::string& message, Clock::time_point now,
+                LogRepeatSummary& summary);
+
+  /**
+   * @brief Take the summary of suppressed repetitions of the last message.
+   *
+   * @return true if there were suppressed repetitions.
+   */
+  bool TakeSummary(LogRepeatSummary& summary);
+
+private:
+  const Clock::duration m_window;
+  bool m_has_last;
+  int m_last_severity;
+  std::string m_last_message;
+  Clock::time_point m_window_end;
+  std::size_t m_repeat_count;
+};
+
+}  // namespace oac_tree
+
+}  // namespace sup
+
+#endif  // SUP_OAC_TREE_PLUGIN_CONTROL_LOG_DEDUPLICATOR_H_
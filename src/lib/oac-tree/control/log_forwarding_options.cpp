@@ -0,0 +1,85 @@
+/******************************************************************************
+* $HeadURL: $
+* $Id: $
+*
+* Project       : Supervision and Automation - oac-tree
+*
+* Description   : SUP oac-tree control plugin
+*
+* Author        : Walter Van Herck (IO)
+*
+* Copyright (c) : 2010-2026 ITER Organization,
+*                 CS 90 046
+*                 13067 St. Paul-lez-Durance Cedex
+*                 France
+* SPDX-License-Identifier: MIT
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file LICENSE located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+#include "log_forwarding_options.h"
+
+#include "instruction_attribute_utils.h"
+
+#include <sup/oac-tree/exceptions.h>
+#include <sup/oac-tree/instruction.h>
+#include <sup/oac-tree/instruction_utils.h>
+
+namespace
+{
+const std::string DROP_NEWEST_POLICY = "dropNewest";
+const std::string DROP_OLDEST_POLICY = "dropOldest";
+}  // unnamed namespace
+
+namespace sup {
+
+namespace oac_tree {
+
+const std::string LOG_QUEUE_SIZE_ATTRIBUTE = "logQueueSize";
+const std::string LOG_OVERFLOW_POLICY_ATTRIBUTE = "logOverflowPolicy";
+const std::string LOG_DEDUP_WINDOW_ATTRIBUTE = "logDedupWindow";
+
+bool operator==(const LogForwardingOptions& left, const LogForwardingOptions& right)
+{
+  return left.m_queue_size == right.m_queue_size
+         && left.m_overflow_policy == right.m_overflow_policy
+         && left.m_dedup_window == right.m_dedup_window;
+}
+
+bool operator!=(const LogForwardingOptions& left, const LogForwardingOptions& right)
+{
+  return !(left == right);
+}
+
+LogForwardingOptions GetLogForwardingOptions(const Instruction& instr)
+{
+  LogForwardingOptions result;
+  result.m_queue_size = GetUnsignedIntegerAttribute(instr, LOG_QUEUE_SIZE_ATTRIBUTE, 0);
+  auto policy = GetStringAttribute(instr, LOG_OVERFLOW_POLICY_ATTRIBUTE, DROP_NEWEST_POLICY);
+  if (policy == DROP_OLDEST_POLICY)
+  {
+    result.m_overflow_policy = LogOverflowPolicy::kDropOldest;
+  }
+  else if (policy != DROP_NEWEST_POLICY)
+  {
+    std::string error_message = InstructionErrorProlog(instr) +
+      "Unknown log overflow policy [" + policy + "], expected [" + DROP_NEWEST_POLICY +
+      "] or [" + DROP_OLDEST_POLICY + "]";
+    throw InstructionSetupException(error_message);
+  }
+  result.m_dedup_window = GetFloatAttribute(instr, LOG_DEDUP_WINDOW_ATTRIBUTE, 0.0);
+  if (result.m_dedup_window < 0.0)
+  {
+    std::string error_message = InstructionErrorProlog(instr) +
+      "Attribute [" + LOG_DEDUP_WINDOW_ATTRIBUTE + "] must not be negative";
+    throw InstructionSetupException(error_message);
+  }
+  return result;
+}
+
+} // namespace oac_tree
+
+} // namespace sup
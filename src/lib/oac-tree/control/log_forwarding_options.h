@@ -0,0 +1,75 @@
+/******************************************************************************
+* $HeadURL: $
+* $Id: $
+*
+* Project       : Supervision and Automation - oac-tree
+*
+* Description   : SUP oac-tree control plugin
+*
+* Author        : Walter Van Herck (IO)
+*
+* Copyright (c) : 2010-2026 ITER Organization,
+*                 CS 90 046
+*                 13067 St. Paul-lez-Durance Cedex
+*                 France
+* SPDX-License-Identifier: MIT
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file LICENSE located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+#ifndef SUP_OAC_TREE_PLUGIN_CONTROL_LOG_FORWARDING_OPTIONS_H_
+#define SUP_OAC_TREE_PLUGIN_CONTROL_LOG_FORWARDING_OPTIONS_H_
+
+#include <cstddef>
+#include <string>
+
+namespace sup
+{
+namespace oac_tree
+{
+class Instruction;
+
+extern const std::string LOG_QUEUE_SIZE_ATTRIBUTE;
+extern const std::string LOG_OVERFLOW_POLICY_ATTRIBUTE;
+extern const std::string LOG_DEDUP_WINDOW_ATTRIBUTE;
+
+/**
+ * @brief Policy for asynchronous log forwarding when the message queue is full.
+ */
+enum class LogOverflowPolicy
+{
+  kDropNewest,
+  kDropOldest
+};
+
+/**
+ * @brief Options for forwarding log messages of internal instructions to the UserInterface.
+ *
+ * @details A queue size of zero means that messages are forwarded synchronously. A deduplication
+ * window of zero (seconds) disables the collapsing of repeated identical messages.
+ */
+struct LogForwardingOptions
+{
+  std::size_t m_queue_size = 0;
+  LogOverflowPolicy m_overflow_policy = LogOverflowPolicy::kDropNewest;
+  double m_dedup_window = 0.0;
+};
+
+bool operator==(const LogForwardingOptions& left, const LogForwardingOptions& right);
+bool operator!=(const LogForwardingOptions& left, const LogForwardingOptions& right);
+
+/**
+ * @brief Parse the log forwarding options from the attributes of an instruction.
+ *
+ * @throws InstructionSetupException when an attribute value is invalid.
+ */
+LogForwardingOptions GetLogForwardingOptions(const Instruction& instr);
+
+}  // namespace oac_tree
+
+}  // namespace sup
+
+#endif  // SUP_OAC_TREE_PLUGIN_CONTROL_LOG_FORWARDING_OPTIONS_H_
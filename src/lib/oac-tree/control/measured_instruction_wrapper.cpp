@@ -0,0 +1,56 @@
+/******************************************************************************
+* $HeadURL: $
+* $Id: $
+*
+* Project       : Supervision and Automation - oac-tree
+*
+* Description   : SUP oac-tree control plugin
+*
+* Author        : Walter Van Herck (IO)
+*
+* Copyright (c) : 2010-2026 ITER Organization,
+*                 CS 90 046
+*                 13067 St. Paul-lez-Durance Cedex
+*                 France
+* SPDX-License-Identifier: MIT
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file LICENSE located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+
+#include "measured_instruction_wrapper.h"
+
+namespace sup {
+
+namespace oac_tree {
+
+MeasuredInstructionWrapper::MeasuredInstructionWrapper(Instruction* instr,
+                                                       ControlMetrics& metrics,
+                                                       ControlMetrics::Section section)
+  : ContextOVerrideInstructionWrapper(instr)
+  , m_metrics{metrics}
+  , m_section{section}
+{}
+
+MeasuredInstructionWrapper::~MeasuredInstructionWrapper() = default;
+
+ExecutionStatus MeasuredInstructionWrapper::ExecuteSingleImpl(UserInterface& ui, Workspace& ws)
+{
+  auto instr = GetInstruction();
+  if (m_section == ControlMetrics::Section::kAction)
+  {
+    ExecuteMeasuredAction(*instr, SelectUserInterface(ui), ws, std::addressof(m_metrics));
+  }
+  else
+  {
+    ExecuteMeasuredCondition(*instr, SelectUserInterface(ui), ws, std::addressof(m_metrics));
+  }
+  return instr->GetStatus();
+}
+
+} // namespace oac_tree
+
+} // namespace sup
@@ -0,0 +1,56 @@
+/******************************************************************************
+* $HeadURL: $
+* $Id: $
+*
+* Project       : Supervision and Automation - oac-tree
+*
+* Description   : SUP oac-tree control plugin
+*
+* Author        : Walter Van Herck (IO)
+*
+* Copyright (c) : 2010-2026 ITER Organization,
+*                 CS 90 046
+*                 13067 St. Paul-lez-Durance Cedex
+*                 France
+* SPDX-License-Identifier: MIT
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file LICENSE located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+
+#ifndef SUP_OAC_TREE_PLUGIN_CONTROL_MEASURED_INSTRUCTION_WRAPPER_H_
+#define SUP_OAC_TREE_PLUGIN_CONTROL_MEASURED_INSTRUCTION_WRAPPER_H_
+
+#include "context_override_instruction_wrapper.h"
+#include "control_metrics.h"
+
+namespace sup
+{
+namespace oac_tree
+{
+
+/**
+ * @brief Instruction wrapper that records the execution of the wrapped instruction as either a
+ * condition evaluation or an action tick in the given metrics.
+ */
+class MeasuredInstructionWrapper : public ContextOVerrideInstructionWrapper
+{
+public:
+  MeasuredInstructionWrapper(Instruction* instr, ControlMetrics& metrics,
+                             ControlMetrics::Section section);
+  ~MeasuredInstructionWrapper() override;
+
+private:
+  ControlMetrics& m_metrics;
+  ControlMetrics::Section m_section;
+  ExecutionStatus ExecuteSingleImpl(UserInterface& ui, Workspace& ws) override;
+};
+
+}  // namespace oac_tree
+
+}  // namespace sup
+
+#endif  // SUP_OAC_TREE_PLUGIN_CONTROL_MEASURED_INSTRUCTION_WRAPPER_H_
@@ -0,0 +1,154 @@
+/******************************************************************************
+* $HeadURL: $
+* $Id: $
+*
+* Project       : Supervision and Automation - oac-tree
+*
+* Description   : SUP oac-tree control plugin
+*
+* Author        : Walter Van Herck (IO)
+*
+* Copyright (c) : 2010-2026 ITER Organization,
+*                 CS 90 046
+*                 13067 St. Paul-lez-Durance Cedex
+*                 France
+* SPDX-License-Identifier: MIT
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file LICENSE located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+
+#include "memoized_condition_instruction.h"
+
+#include "condition_memo_table.h"
+#include "variable_change_monitor.h"
+
+#include <sup/oac-tree/instruction_registry.h>
+#include <sup/oac-tree/instruction_utils.h>
+#include <sup/oac-tree/procedure.h>
+
+namespace sup {
+
+namespace oac_tree {
+
+const std::string MemoizedConditionInstruction::Type = "MemoizedCondition";
+static bool _memoized_condition_initialised_flag =
+  RegisterGlobalInstruction<MemoizedConditionInstruction>();
+
+MemoizedConditionInstruction::MemoizedConditionInstruction()
+  : DecoratorInstruction(Type)
+  , m_condition{nullptr}
+  , m_memo_table{}
+  , m_signature{}
+  , m_var_names{}
+  , m_versions{}
+  , m_cache_hits{0}
+{}
+
+MemoizedConditionInstruction::~MemoizedConditionInstruction() = default;
+
+std::size_t MemoizedConditionInstruction::GetCacheHitCount() const
+{
+  return m_cache_hits;
+}
+
+std::shared_ptr<ConditionMemoTable> MemoizedConditionInstruction::GetMemoTable() const
+{
+  return m_memo_table;
+}
+
+void MemoizedConditionInstruction::SetupImpl(const Procedure& proc)
+{
+  m_condition = nullptr;
+  m_memo_table.reset();
+  auto children = ChildInstructions();
+  if (children.size() != 1)
+  {
+    std::string error_message = InstructionErrorProlog(*this) +
+      "Trying to setup decorator without a child";
+    throw InstructionSetupException(error_message);
+  }
+  if (!IsMemoizableCondition(*children[0]))
+  {
+    std::string error_message = InstructionErrorProlog(*this) +
+      "Child condition contains instructions whose outcome cannot be memoized";
+    throw InstructionSetupException(error_message);
+  }
+  m_condition = children[0];
+  m_condition->Setup(proc);
+  m_signature = GetConditionSignature(*m_condition);
+  auto var_names = GetReferencedVariableNames(*m_condition);
+  m_var_names.assign(var_names.begin(), var_names.end());
+  m_versions.reserve(m_var_names.size());
+  // Share the table with the memoized conditions that were already set up
+  auto root = proc.RootInstruction();
+  m_memo_table = root != nullptr ? FindConditionMemoTable(*root) : nullptr;
+  if (!m_memo_table)
+  {
+    m_memo_table = std::make_shared<ConditionMemoTable>();
+  }
+}
+
+ExecutionStatus MemoizedConditionInstruction::ExecuteSingleImpl(UserInterface& ui, Workspace& ws)
+{
+  // Versions are retrieved before evaluation, so that changes during evaluation are not missed
+  bool memoizable = m_memo_table->GetVersions(ws, m_var_names, m_versions);
+  ExecutionStatus status = ExecutionStatus::NOT_STARTED;
+  if (memoizable && m_memo_table->Lookup(m_signature, m_versions, status))
+  {
+    ++m_cache_hits;
+    return status;
+  }
+  if (IsFinishedStatus(m_condition->GetStatus()))
+  {
+    m_condition->Reset(ui);
+  }
+  m_condition->ExecuteSingle(ui, ws);
+  status = m_condition->GetStatus();
+  if (memoizable && IsFinishedStatus(status))
+  {
+    m_memo_table->Store(m_signature, m_versions, status);
+  }
+  return status;
+}
+
+void MemoizedConditionInstruction::HaltImpl(UserInterface& ui)
+{
+  if (m_condition != nullptr)
+  {
+    m_condition->Halt(ui);
+  }
+}
+
+void MemoizedConditionInstruction::ResetHook(UserInterface& ui)
+{
+  if (m_condition != nullptr)
+  {
+    m_condition->Reset(ui);
+  }
+}
+
+std::shared_ptr<ConditionMemoTable> FindConditionMemoTable(const Instruction& root)
+{
+  auto memoized = dynamic_cast<const MemoizedConditionInstruction*>(std::addressof(root));
+  if (memoized != nullptr && memoized->GetMemoTable())
+  {
+    return memoized->GetMemoTable();
+  }
+  for (auto child : root.ChildInstructions())
+  {
+    auto result = FindConditionMemoTable(*child);
+    if (result)
+    {
+      return result;
+    }
+  }
+  return nullptr;
+}
+
+} // namespace oac_tree
+
+} // namespace sup
@@ -0,0 +1,96 @@
+/******************************************************************************
+* $HeadURL: $
+* $Id: $
+*
+* Project       : Supervision and Automation - oac-tree
+*
+* Description   : SUP oac-tree control plugin
+*
+* Author        : Walter Van Herck (IO)
+*
+* Copyright (c) : 2010-2026 ITER Organization,
+*                 CS 90 046
+*                 13067 St. Paul-lez-Durance Cedex
+*                 France
+* SPDX-License-Identifier: MIT
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file LICENSE located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+
+#ifndef SUP_OAC_TREE_PLUGIN_CONTROL_MEMOIZED_CONDITION_INSTRUCTION_H_
+#define SUP_OAC_TREE_PLUGIN_CONTROL_MEMOIZED_CONDITION_INSTRUCTION_H_
+
+#include <sup/oac-tree/decorator_instruction.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace sup
+{
+namespace oac_tree
+{
+class ConditionMemoTable;
+
+/**
+ * @brief Evaluates its child condition only when one of the workspace variables it reads has
+ * changed since the last evaluation. Otherwise, the previous outcome is returned.
+ *
+ * @details Outcomes are shared by all memoized conditions in the tree of the procedure's root
+ * instruction that have the same condition tree, i.e. the same instruction types and attributes.
+ * Only conditions whose outcome solely depends on the values of the variables they reference can
+ * be memoized, which is checked during Setup.
+ *
+ * @note A memoized outcome is returned without executing the child, so messages that the child
+ * would log, e.g. about a missing variable, are only logged on the evaluation that stored the
+ * outcome.
+ */
+class MemoizedConditionInstruction : public DecoratorInstruction
+{
+public:
+  MemoizedConditionInstruction();
+  ~MemoizedConditionInstruction() override;
+
+  static const std::string Type;
+
+  /**
+   * @brief Number of ticks where the memoized outcome was returned without evaluating the child.
+   */
+  std::size_t GetCacheHitCount() const;
+
+  /**
+   * @brief Retrieve the memo table used by this instruction, or nullptr before Setup.
+   */
+  std::shared_ptr<ConditionMemoTable> GetMemoTable() const;
+
+private:
+  void SetupImpl(const Procedure& proc) override;
+  ExecutionStatus ExecuteSingleImpl(UserInterface& ui, Workspace& ws) override;
+  void HaltImpl(UserInterface& ui) override;
+  void ResetHook(UserInterface& ui) override;
+
+  Instruction* m_condition;
+  std::shared_ptr<ConditionMemoTable> m_memo_table;
+  std::string m_signature;
+  std::vector<std::string> m_var_names;
+  std::vector<std::uint64_t> m_versions;
+  std::size_t m_cache_hits;
+};
+
+/**
+ * @brief Find the memo table of the first memoized condition in the given instruction tree that
+ * was set up, or nullptr if there is none.
+ */
+std::shared_ptr<ConditionMemoTable> FindConditionMemoTable(const Instruction& root);
+
+}  // namespace oac_tree
+
+}  // namespace sup
+
+#endif  // SUP_OAC_TREE_PLUGIN_CONTROL_MEMOIZED_CONDITION_INSTRUCTION_H_
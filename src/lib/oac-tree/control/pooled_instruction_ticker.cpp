@@ -0,0 +1,182 @@
+/******************************************************************************
+* $HeadURL: $
+* $Id: $
+*
+* Project       : Supervision and Automation - oac-tree
+*
+* Description   : SUP oac-tree control plugin
+*
+* Author        : Walter Van Herck (IO)
+*
+* Copyright (c) : 2010-2026 ITER Organization,
+*                 CS 90 046
+*                 13067 St. Paul-lez-Durance Cedex
+*                 France
+* SPDX-License-Identifier: MIT
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file LICENSE located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+
+#include "pooled_instruction_ticker.h"
+
+#include "control_metrics.h"
+#include "worker_pool.h"
+
+#include <sup/oac-tree/instruction.h>
+#include <sup/oac-tree/instruction_utils.h>
+#include <sup/oac-tree/user_interface.h>
+
+#include <exception>
+#include <memory>
+
+namespace sup {
+
+namespace oac_tree {
+
+const std::size_t PooledInstructionTicker::kMaxTicksPerJob = 64;
+
+PooledInstructionTicker::PooledInstructionTicker(WorkerPool& pool, Instruction& instr,
+                                                 ControlMetrics* metrics)
+  : m_pool{pool}
+  , m_state{new TickState{}}
+{
+  m_state->m_instr = std::addressof(instr);
+  m_state->m_metrics = metrics;
+}
+
+PooledInstructionTicker::~PooledInstructionTicker()
+{
+  Wait();
+  ReleaseState(m_state);
+}
+
+bool PooledInstructionTicker::IsBusy() const
+{
+  std::lock_guard<std::mutex> lk{m_state->m_mtx};
+  return m_state->m_busy;
+}
+
+bool PooledInstructionTicker::HasFailed() const
+{
+  std::lock_guard<std::mutex> lk{m_state->m_mtx};
+  return m_state->m_failed;
+}
+
+void PooledInstructionTicker::ClearFailure()
+{
+  std::lock_guard<std::mutex> lk{m_state->m_mtx};
+  m_state->m_failed = false;
+}
+
+bool PooledInstructionTicker::SubmitTicks(UserInterface& ui, Workspace& ws)
+{
+  {
+    std::lock_guard<std::mutex> lk{m_state->m_mtx};
+    if (m_state->m_busy)
+    {
+      return false;
+    }
+    m_state->m_busy = true;
+    m_state->m_claimed = false;
+    m_state->m_ui = std::addressof(ui);
+    m_state->m_ws = std::addressof(ws);
+    m_state->m_halt_requested = false;
+  }
+  (void)m_state->m_references.fetch_add(1, std::memory_order_relaxed);
+  // Only captures a raw pointer, so that the task fits in the small buffer of std::function
+  auto state = m_state;
+  auto job = [state]()
+  {
+    RunJob(*state);
+    ReleaseState(state);
+  };
+  if (!m_pool.Submit(job))
+  {
+    ReleaseState(m_state);
+    std::lock_guard<std::mutex> lk{m_state->m_mtx};
+    m_state->m_busy = false;
+    return false;
+  }
+  return true;
+}
+
+void PooledInstructionTicker::Halt()
+{
+  m_state->m_halt_requested = true;
+}
+
+void PooledInstructionTicker::Wait()
+{
+  std::unique_lock<std::mutex> lk{m_state->m_mtx};
+  if (m_state->m_busy && !m_state->m_claimed)
+  {
+    lk.unlock();
+    RunJob(*m_state);
+    lk.lock();
+  }
+  m_state->m_cv.wait(lk, [this]{ return !m_state->m_busy; });
+}
+
+void PooledInstructionTicker::RunJob(TickState& state)
+{
+  {
+    std::lock_guard<std::mutex> lk{state.m_mtx};
+    if (!state.m_busy || state.m_claimed)
+    {
+      return;
+    }
+    state.m_claimed = true;
+  }
+  bool failed = false;
+  try
+  {
+    TickInstruction(state);
+  }
+  catch (const std::exception& e)
+  {
+    failed = true;
+    LogError(*state.m_ui, InstructionErrorProlog(*state.m_instr) +
+                          "Exception thrown while ticking instruction: " + e.what());
+  }
+  catch (...)
+  {
+    failed = true;
+    LogError(*state.m_ui, InstructionErrorProlog(*state.m_instr) +
+                          "Unknown exception thrown while ticking instruction");
+  }
+  {
+    std::lock_guard<std::mutex> lk{state.m_mtx};
+    state.m_failed = state.m_failed || failed;
+    state.m_busy = false;
+    state.m_claimed = false;
+  }
+  state.m_cv.notify_all();
+}
+
+void PooledInstructionTicker::TickInstruction(TickState& state)
+{
+  for (std::size_t idx = 0; idx < kMaxTicksPerJob; ++idx)
+  {
+    ExecuteMeasuredAction(*state.m_instr, *state.m_ui, *state.m_ws, state.m_metrics);
+    if (state.m_instr->GetStatus() != ExecutionStatus::NOT_FINISHED || state.m_halt_requested)
+    {
+      break;
+    }
+  }
+}
+
+void PooledInstructionTicker::ReleaseState(TickState* state)
+{
+  if (state->m_references.fetch_sub(1, std::memory_order_acq_rel) == 1u)
+  {
+    delete state;
+  }
+}
+
+} // namespace oac_tree
+
+} // namespace sup
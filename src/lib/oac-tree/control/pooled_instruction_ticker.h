@@ -0,0 +1,129 @@
+/******************************************************************************
+* $HeadURL: $
+* $Id: $
+*
+* Project       : Supervision and Automation - oac-tree
+*
+* Description   : SUP oac-tree control plugin
+*
+* Author        : Walter Van Herck (IO)
+*
+* Copyright (c) : 2010-2026 ITER Organization,
+*                 CS 90 046
+*                 13067 St. Paul-lez-Durance Cedex
+*                 France
+* SPDX-License-Identifier: MIT
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file LICENSE located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+
+#ifndef SUP_OAC_TREE_PLUGIN_CONTROL_POOLED_INSTRUCTION_TICKER_H_
+#define SUP_OAC_TREE_PLUGIN_CONTROL_POOLED_INSTRUCTION_TICKER_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+
+namespace sup
+{
+namespace oac_tree
+{
+class ControlMetrics;
+class Instruction;
+class UserInterface;
+class WorkerPool;
+class Workspace;
+
+/**
+ * @brief Executes jobs that tick an instruction on a WorkerPool. At most one job is in flight at
+ * any time.
+ *
+ * @details A job ticks the instruction until it finished, until it needs to wait for something
+ * (its status is RUNNING) or until a maximum number of ticks, so that it advances as far as
+ * possible without blocking a worker. Submitting a job does not allocate memory.
+ *
+ * Wait executes a job that was not started yet on the calling thread, so that nested tickers on
+ * the same pool cannot deadlock when all workers are waiting. The destructor waits for a job in
+ * flight, so the instruction, UserInterface and Workspace only need to outlive this object. The
+ * same holds for the optional metrics, in which the ticks are recorded as action ticks.
+ */
+class PooledInstructionTicker
+{
+public:
+  static const std::size_t kMaxTicksPerJob;
+
+  PooledInstructionTicker(WorkerPool& pool, Instruction& instr,
+                          ControlMetrics* metrics = nullptr);
+  ~PooledInstructionTicker();
+
+  PooledInstructionTicker(const PooledInstructionTicker&) = delete;
+  PooledInstructionTicker& operator=(const PooledInstructionTicker&) = delete;
+
+  /**
+   * @brief Check if a job was submitted and did not finish yet.
+   */
+  bool IsBusy() const;
+
+  /**
+   * @brief Check if the last job was aborted because ticking the instruction threw an exception.
+   * The exception is logged to the UserInterface of the job. This stays set until ClearFailure is
+   * called.
+   */
+  bool HasFailed() const;
+
+  void ClearFailure();
+
+  /**
+   * @brief Submit a job that ticks the instruction, unless one is already in flight.
+   *
+   * @return false if the pool rejected the job or a job was already in flight.
+   */
+  bool SubmitTicks(UserInterface& ui, Workspace& ws);
+
+  /**
+   * @brief Request the job in flight, if any, to stop after its current tick. This does not
+   * block.
+   */
+  void Halt();
+
+  /**
+   * @brief Wait until the job in flight, if any, has finished. A job that was not started yet is
+   * executed on the calling thread.
+   */
+  void Wait();
+
+private:
+  struct TickState
+  {
+    std::mutex m_mtx;
+    std::condition_variable m_cv;
+    bool m_busy = false;
+    bool m_claimed = false;
+    bool m_failed = false;
+    std::atomic<bool> m_halt_requested{false};
+    std::atomic<std::size_t> m_references{1};
+    Instruction* m_instr = nullptr;
+    ControlMetrics* m_metrics = nullptr;
+    UserInterface* m_ui = nullptr;
+    Workspace* m_ws = nullptr;
+  };
+  static void RunJob(TickState& state);
+  static void TickInstruction(TickState& state);
+  static void ReleaseState(TickState* state);
+
+  WorkerPool& m_pool;
+  // Shared with the queued jobs through a reference count, since a job that was executed by Wait
+  // may still be in the queue of the pool.
+  TickState* m_state;
+};
+
+}  // namespace oac_tree
+
+}  // namespace sup
+
+#endif  // SUP_OAC_TREE_PLUGIN_CONTROL_POOLED_INSTRUCTION_TICKER_H_
@@ -0,0 +1,58 @@
+/******************************************************************************
+* $HeadURL: $
+* $Id: $
+*
+* Project       : Supervision and Automation - oac-tree
+*
+* Description   : SUP oac-tree control plugin
+*
+* Author        : Walter Van Herck (IO)
+*
+* Copyright (c) : 2010-2026 ITER Organization,
+*                 CS 90 046
+*                 13067 St. Paul-lez-Durance Cedex
+*                 France
+* SPDX-License-Identifier: MIT
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file LICENSE located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+#include "recheck_instruction_wrapper.h"
+
+namespace sup {
+
+namespace oac_tree {
+
+RecheckInstructionWrapper::RecheckInstructionWrapper(Instruction* instr)
+  : ContextOVerrideInstructionWrapper(instr)
+{}
+
+RecheckInstructionWrapper::~RecheckInstructionWrapper() = default;
+
+void RecheckInstructionWrapper::SetupImpl(const Procedure& proc)
+{
+  (void)proc;
+}
+
+ExecutionStatus RecheckInstructionWrapper::ExecuteSingleImpl(UserInterface& ui, Workspace& ws)
+{
+  auto status = GetInstruction()->GetStatus();
+  if (IsFinishedStatus(status))
+  {
+    return status;
+  }
+  GetInstruction()->ExecuteSingle(SelectUserInterface(ui), ws);
+  return GetInstruction()->GetStatus();
+}
+
+void RecheckInstructionWrapper::ResetHook(UserInterface& ui)
+{
+  (void)ui;
+}
+
+} // namespace oac_tree
+
+} // namespace sup
@@ -0,0 +1,57 @@
+/******************************************************************************
+* $HeadURL: $
+* $Id: $
+*
+* Project       : Supervision and Automation - oac-tree
+*
+* Description   : SUP oac-tree control plugin
+*
+* Author        : Walter Van Herck (IO)
+*
+* Copyright (c) : 2010-2026 ITER Organization,
+*                 CS 90 046
+*                 13067 St. Paul-lez-Durance Cedex
+*                 France
+* SPDX-License-Identifier: MIT
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file LICENSE located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+#ifndef SUP_OAC_TREE_PLUGIN_CONTROL_RECHECK_INSTRUCTION_WRAPPER_H_
+#define SUP_OAC_TREE_PLUGIN_CONTROL_RECHECK_INSTRUCTION_WRAPPER_H_
+
+#include "context_override_instruction_wrapper.h"
+
+namespace sup
+{
+namespace oac_tree
+{
+
+/**
+ * @brief Instruction wrapper that allows the same (condition) instruction to appear a second time
+ * in a private instruction tree. When the wrapped instruction already finished, its status is
+ * reused instead of executing it again.
+ *
+ * @details Setup and Reset are not forwarded, since these are handled by the primary wrapper of
+ * the same instruction.
+ */
+class RecheckInstructionWrapper : public ContextOVerrideInstructionWrapper
+{
+public:
+  explicit RecheckInstructionWrapper(Instruction* instr);
+  ~RecheckInstructionWrapper() override;
+
+private:
+  void SetupImpl(const Procedure& proc) override;
+  ExecutionStatus ExecuteSingleImpl(UserInterface& ui, Workspace& ws) override;
+  void ResetHook(UserInterface& ui) override;
+};
+
+}  // namespace oac_tree
+
+}  // namespace sup
+
+#endif  // SUP_OAC_TREE_PLUGIN_CONTROL_RECHECK_INSTRUCTION_WRAPPER_H_
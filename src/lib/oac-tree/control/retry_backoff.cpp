@@ -0,0 +1,112 @@
+/******************************************************************************
+* $HeadURL: $
+* $Id: $
+*
+* Project       : Supervision and Automation - oac-tree
+*
+* Description   : SUP oac-tree control plugin
+*
+* Author        : Walter Van Herck (IO)
+*
+* Copyright (c) : 2010-2026 ITER Organization,
+*                 CS 90 046
+*                 13067 St. Paul-lez-Durance Cedex
+*                 France
+* SPDX-License-Identifier: MIT
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file LICENSE located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+
+#include "retry_backoff.h"
+
+#include "instruction_attribute_utils.h"
+
+#include <sup/oac-tree/exceptions.h>
+#include <sup/oac-tree/instruction.h>
+#include <sup/oac-tree/instruction_utils.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace
+{
+void ThrowIfOutOfRange(const sup::oac_tree::Instruction& instr, const std::string& attr_name,
+                       double value, double min_value, double max_value,
+                       const std::string& range_text);
+}  // unnamed namespace
+
+namespace sup {
+
+namespace oac_tree {
+
+const std::string MAX_ATTEMPTS_ATTRIBUTE = "maxAttempts";
+const std::string INITIAL_DELAY_ATTRIBUTE = "initialDelay";
+const std::string BACKOFF_FACTOR_ATTRIBUTE = "backoffFactor";
+const std::string MAX_DELAY_ATTRIBUTE = "maxDelay";
+const std::string JITTER_ATTRIBUTE = "jitter";
+
+// Large enough to be unlimited in practice, while a deadline can still be computed from it
+const double MAX_RETRY_DELAY = 1.0e9;
+
+RetryBackoffOptions GetRetryBackoffOptions(const Instruction& instr)
+{
+  RetryBackoffOptions result;
+  result.m_max_attempts = GetUnsignedIntegerAttribute(instr, MAX_ATTEMPTS_ATTRIBUTE, 1);
+  if (result.m_max_attempts == 0)
+  {
+    std::string error_message = InstructionErrorProlog(instr) +
+      "Attribute [" + MAX_ATTEMPTS_ATTRIBUTE + "] must be positive";
+    throw InstructionSetupException(error_message);
+  }
+  result.m_initial_delay = GetFloatAttribute(instr, INITIAL_DELAY_ATTRIBUTE, 0.0);
+  ThrowIfOutOfRange(instr, INITIAL_DELAY_ATTRIBUTE, result.m_initial_delay, 0.0,
+                    std::numeric_limits<double>::max(), "must not be negative");
+  result.m_backoff_factor = GetFloatAttribute(instr, BACKOFF_FACTOR_ATTRIBUTE, 2.0);
+  ThrowIfOutOfRange(instr, BACKOFF_FACTOR_ATTRIBUTE, result.m_backoff_factor, 1.0,
+                    std::numeric_limits<double>::max(), "must be at least 1");
+  result.m_max_delay = GetFloatAttribute(instr, MAX_DELAY_ATTRIBUTE, MAX_RETRY_DELAY);
+  ThrowIfOutOfRange(instr, MAX_DELAY_ATTRIBUTE, result.m_max_delay, 0.0,
+                    std::numeric_limits<double>::max(), "must not be negative");
+  result.m_max_delay = std::min(result.m_max_delay, MAX_RETRY_DELAY);
+  result.m_jitter = GetFloatAttribute(instr, JITTER_ATTRIBUTE, 0.0);
+  ThrowIfOutOfRange(instr, JITTER_ATTRIBUTE, result.m_jitter, 0.0, 1.0,
+                    "must be between 0 and 1");
+  return result;
+}
+
+double GetRetryDelay(const RetryBackoffOptions& options, std::size_t retry_index,
+                     double random_unit)
+{
+  double delay = options.m_initial_delay *
+                 std::pow(options.m_backoff_factor, static_cast<double>(retry_index));
+  delay = std::min(delay, options.m_max_delay);
+  const double jitter_scale = 1.0 + options.m_jitter * (2.0 * random_unit - 1.0);
+  delay = std::min(delay * jitter_scale, options.m_max_delay);
+  // Also catches NaN
+  return delay > 0.0 ? delay : 0.0;
+}
+
+} // namespace oac_tree
+
+} // namespace sup
+
+namespace
+{
+void ThrowIfOutOfRange(const sup::oac_tree::Instruction& instr, const std::string& attr_name,
+                       double value, double min_value, double max_value,
+                       const std::string& range_text)
+{
+  // Also catches NaN
+  if (!(value >= min_value && value <= max_value))
+  {
+    std::string error_message = sup::oac_tree::InstructionErrorProlog(instr) +
+      "Attribute [" + attr_name + "] " + range_text;
+    throw sup::oac_tree::InstructionSetupException(error_message);
+  }
+}
+}  // unnamed namespace
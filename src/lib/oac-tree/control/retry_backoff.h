@@ -0,0 +1,83 @@
+/******************************************************************************
+* $HeadURL: $
+* $Id: $
+*
+* Project       : Supervision and Automation - oac-tree
+*
+* Description   : SUP oac-tree control plugin
+*
+* Author        : Walter Van Herck (IO)
+*
+* Copyright (c) : 2010-2026 ITER Organization,
+*                 CS 90 046
+*                 13067 St. Paul-lez-Durance Cedex
+*                 France
+* SPDX-License-Identifier: MIT
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file LICENSE located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+
+#ifndef SUP_OAC_TREE_PLUGIN_CONTROL_RETRY_BACKOFF_H_
+#define SUP_OAC_TREE_PLUGIN_CONTROL_RETRY_BACKOFF_H_
+
+#include <cstddef>
+#include <string>
+
+namespace sup
+{
+namespace oac_tree
+{
+class Instruction;
+
+extern const std::string MAX_ATTEMPTS_ATTRIBUTE;
+extern const std::string INITIAL_DELAY_ATTRIBUTE;
+extern const std::string BACKOFF_FACTOR_ATTRIBUTE;
+extern const std::string MAX_DELAY_ATTRIBUTE;
+extern const std::string JITTER_ATTRIBUTE;
+
+/**
+ * @brief Largest delay in seconds between two attempts, used when no maximum delay is configured.
+ */
+extern const double MAX_RETRY_DELAY;
+
+/**
+ * @brief Options for the delays between retries of an action. The delay before retry n (starting
+ * from zero) is the initial delay multiplied n times by the backoff factor and limited to the
+ * maximum delay. It is then randomly scaled by a factor in [1 - jitter, 1 + jitter] and limited
+ * to the maximum delay again.
+ */
+struct RetryBackoffOptions
+{
+  std::size_t m_max_attempts = 1;
+  double m_initial_delay = 0.0;
+  double m_backoff_factor = 2.0;
+  double m_max_delay = MAX_RETRY_DELAY;
+  double m_jitter = 0.0;
+};
+
+/**
+ * @brief Parse the retry options from the attributes of an instruction.
+ *
+ * @throws InstructionSetupException when an attribute value is invalid.
+ */
+RetryBackoffOptions GetRetryBackoffOptions(const Instruction& instr);
+
+/**
+ * @brief Compute the delay in seconds before a retry.
+ *
+ * @param options Retry options.
+ * @param retry_index Index of the retry, starting from zero for the first retry.
+ * @param random_unit Random number in [0, 1] used for the jitter.
+ */
+double GetRetryDelay(const RetryBackoffOptions& options, std::size_t retry_index,
+                     double random_unit);
+
+}  // namespace oac_tree
+
+}  // namespace sup
+
+#endif  // SUP_OAC_TREE_PLUGIN_CONTROL_RETRY_BACKOFF_H_
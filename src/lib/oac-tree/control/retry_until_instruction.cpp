@@ -0,0 +1,187 @@
+/******************************************************************************
+* $HeadURL: $
+* $Id: $
+*
+* Project       : Supervision and Automation - oac-tree
+*
+* Description   : SUP oac-tree control plugin
+*
+* Author        : Walter Van Herck (IO)
+*
+* Copyright (c) : 2010-2026 ITER Organization,
+*                 CS 90 046
+*                 13067 St. Paul-lez-Durance Cedex
+*                 France
+* SPDX-License-Identifier: MIT
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file LICENSE located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+
+#include "retry_until_instruction.h"
+
+#include "achieve_condition_instruction.h"
+#include "log_forwarding_options.h"
+
+#include <sup/oac-tree/instruction_registry.h>
+#include <sup/oac-tree/instruction_utils.h>
+
+namespace sup {
+
+namespace oac_tree {
+
+const std::string RetryUntilInstruction::Type = "RetryUntil";
+static bool _retry_until_initialised_flag = RegisterGlobalInstruction<RetryUntilInstruction>();
+
+const std::string LOG_MESSAGE_PREFIX =
+  "Forwarded log message from internal instruction of RetryUntil: ";
+
+RetryUntilInstruction::RetryUntilInstruction()
+  : CompoundInstruction(Type)
+  , m_metrics{}
+  , m_internal_instruction_tree{}
+  , m_instr_manager{}
+  , m_options{}
+  , m_attempts{0}
+  , m_retry_timer{}
+  , m_random_engine{std::random_device{}()}
+  , m_lazy_setup{}
+{
+  (void)AddAttributeDefinition(MAX_ATTEMPTS_ATTRIBUTE, sup::dto::UnsignedInteger32Type)
+    .SetMandatory();
+  (void)AddAttributeDefinition(INITIAL_DELAY_ATTRIBUTE, sup::dto::Float64Type);
+  (void)AddAttributeDefinition(BACKOFF_FACTOR_ATTRIBUTE, sup::dto::Float64Type);
+  (void)AddAttributeDefinition(MAX_DELAY_ATTRIBUTE, sup::dto::Float64Type);
+  (void)AddAttributeDefinition(JITTER_ATTRIBUTE, sup::dto::Float64Type);
+  (void)AddAttributeDefinition(LAZY_SETUP_ATTRIBUTE, sup::dto::BooleanType);
+  (void)AddAttributeDefinition(LOG_QUEUE_SIZE_ATTRIBUTE, sup::dto::UnsignedInteger32Type);
+  (void)AddAttributeDefinition(LOG_OVERFLOW_POLICY_ATTRIBUTE);
+  (void)AddAttributeDefinition(LOG_DEDUP_WINDOW_ATTRIBUTE, sup::dto::Float64Type);
+}
+
+RetryUntilInstruction::~RetryUntilInstruction() = default;
+
+std::size_t RetryUntilInstruction::GetAttemptCount() const
+{
+  return m_attempts;
+}
+
+WakeUpHint RetryUntilInstruction::GetWakeUpHint() const
+{
+  if (m_retry_timer.IsStarted())
+  {
+    WakeUpHint result;
+    result.m_deadline = m_retry_timer.GetDeadline();
+    return result;
+  }
+  if (m_internal_instruction_tree)
+  {
+    return oac_tree::GetWakeUpHint(*m_internal_instruction_tree);
+  }
+  return ImmediateWakeUpHint();
+}
+
+const ControlMetrics& RetryUntilInstruction::GetControlMetrics() const
+{
+  return m_metrics;
+}
+
+void RetryUntilInstruction::SetupImpl(const Procedure& proc)
+{
+  m_metrics.SetTraceLabel(GetInstructionLabel(*this));
+  m_attempts = 0;
+  m_retry_timer.Stop();
+  m_options = GetRetryBackoffOptions(*this);
+  m_instr_manager.SetLogForwardingOptions(GetLogForwardingOptions(*this));
+  m_internal_instruction_tree.reset();
+  if (ChildInstructions().size() != 2)
+  {
+    std::string error_message = InstructionErrorProlog(*this) +
+      "This compound instruction requires exactly two child instructions";
+    throw InstructionSetupException(error_message);
+  }
+  m_lazy_setup.Setup(*this, proc, [this](const Procedure& p) { SetupInternalTree(p); });
+}
+
+ExecutionStatus RetryUntilInstruction::ExecuteSingleImpl(UserInterface& ui, Workspace& ws)
+{
+  ScopedMetricsTimer tick_timer{m_metrics, ControlMetrics::Section::kTick};
+  if (!m_lazy_setup.Complete(ui))
+  {
+    return ExecutionStatus::FAILURE;
+  }
+  auto& wrapped_ui = m_instr_manager.GetWrappedUI(ui, LOG_MESSAGE_PREFIX);
+  if (m_retry_timer.IsStarted())
+  {
+    if (!m_retry_timer.IsExpired())
+    {
+      return ExecutionStatus::RUNNING;
+    }
+    // Start the next attempt with the same internal tree
+    m_retry_timer.Stop();
+    m_internal_instruction_tree->Reset(wrapped_ui);
+    m_metrics.RecordRetry();
+  }
+  if (m_internal_instruction_tree->GetStatus() == ExecutionStatus::NOT_STARTED)
+  {
+    ++m_attempts;
+  }
+  m_internal_instruction_tree->ExecuteSingle(wrapped_ui, ws);
+  auto status = m_internal_instruction_tree->GetStatus();
+  if (status != ExecutionStatus::FAILURE || m_attempts >= m_options.m_max_attempts)
+  {
+    return status;
+  }
+  std::uniform_real_distribution<double> distribution{0.0, 1.0};
+  m_retry_timer.Start(GetRetryDelay(m_options, m_attempts - 1, distribution(m_random_engine)));
+  return ExecutionStatus::RUNNING;
+}
+
+void RetryUntilInstruction::HaltImpl(UserInterface& ui)
+{
+  m_retry_timer.Stop();
+  if (m_internal_instruction_tree)
+  {
+    auto& wrapped_ui = m_instr_manager.GetWrappedUI(ui, LOG_MESSAGE_PREFIX);
+    m_internal_instruction_tree->Halt(wrapped_ui);
+  }
+}
+
+void RetryUntilInstruction::ResetHook(UserInterface& ui)
+{
+  m_attempts = 0;
+  m_retry_timer.Stop();
+  if (m_internal_instruction_tree)
+  {
+    auto& wrapped_ui = m_instr_manager.GetWrappedUI(ui, LOG_MESSAGE_PREFIX);
+    m_internal_instruction_tree->Reset(wrapped_ui);
+    m_instr_manager.ReleaseRetiredUIs();
+  }
+}
+
+void RetryUntilInstruction::SetupInternalTree(const Procedure& proc)
+{
+  auto instr_tree = CreateWrappedInstructionTree();
+  std::swap(m_internal_instruction_tree, instr_tree);
+  m_internal_instruction_tree->Setup(proc);
+}
+
+std::unique_ptr<Instruction> RetryUntilInstruction::CreateWrappedInstructionTree()
+{
+  m_instr_manager.ClearWrappers();
+  auto children = ChildInstructions();
+  if (children.size() != 2)
+  {
+    std::string error_message = InstructionErrorProlog(*this) +
+      "This compound instruction requires exactly two child instructions";
+    throw InstructionSetupException(error_message);
+  }
+  return CreateAchieveConditionTree(m_instr_manager, *children[0], *children[1], m_metrics);
+}
+
+} // namespace oac_tree
+
+} // namespace sup
@@ -0,0 +1,106 @@
+/******************************************************************************
+* $HeadURL: $
+* $Id: $
+*
+* Project       : Supervision and Automation - oac-tree
+*
+* Description   : SUP oac-tree control plugin
+*
+* Author        : Walter Van Herck (IO)
+*
+* Copyright (c) : 2010-2026 ITER Organization,
+*                 CS 90 046
+*                 13067 St. Paul-lez-Durance Cedex
+*                 France
+* SPDX-License-Identifier: MIT
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file LICENSE located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+
+#ifndef SUP_OAC_TREE_PLUGIN_CONTROL_RETRY_UNTIL_INSTRUCTION_H_
+#define SUP_OAC_TREE_PLUGIN_CONTROL_RETRY_UNTIL_INSTRUCTION_H_
+
+#include "control_metrics.h"
+#include "deadline_timer.h"
+#include "lazy_setup.h"
+#include "retry_backoff.h"
+#include "wake_up_hint.h"
+#include "wrapped_instruction_manager.h"
+
+#include <sup/oac-tree/compound_instruction.h>
+
+#include <cstddef>
+#include <memory>
+#include <random>
+
+namespace sup
+{
+namespace oac_tree
+{
+
+/**
+ * @brief Try to achieve a condition by repeatedly executing an action. Each attempt behaves as
+ * AchieveCondition: if the condition is satisfied, the instruction returns SUCCESS. Otherwise,
+ * the action is executed and the condition is checked again. When the condition still fails, the
+ * next attempt starts after a delay that grows exponentially, until the maximum number of attempts
+ * is reached and the instruction exits with FAILURE.
+ *
+ * @details This compound instruction expects exactly two child instructions: the first one is the
+ * condition to achieve and the second one is the instruction (or tree) to execute when the
+ * condition is not (yet) satisfied.
+ *
+ * A single internal instruction tree, with the same structure as the one of AchieveCondition, is
+ * created during Setup and reset for each attempt. While waiting for the next attempt, no child
+ * instruction is ticked and the wake-up hint contains the time of the next attempt.
+ *
+ * With the 'lazySetup' attribute, the internal instruction tree is only created and set up on
+ * the first tick.
+ *
+ * Every retry is recorded in the execution metrics.
+ */
+class RetryUntilInstruction : public CompoundInstruction,
+                              public WakeUpHintProvider,
+                              public ControlMetricsProvider
+{
+public:
+  RetryUntilInstruction();
+  ~RetryUntilInstruction() override;
+
+  static const std::string Type;
+
+  /**
+   * @brief Number of attempts that were started since the last reset.
+   */
+  std::size_t GetAttemptCount() const;
+
+  WakeUpHint GetWakeUpHint() const override;
+
+  const ControlMetrics& GetControlMetrics() const override;
+
+private:
+  void SetupImpl(const Procedure& proc) override;
+  ExecutionStatus ExecuteSingleImpl(UserInterface& ui, Workspace& ws) override;
+  void HaltImpl(UserInterface& ui) override;
+  void ResetHook(UserInterface& ui) override;
+  void SetupInternalTree(const Procedure& proc);
+  std::unique_ptr<Instruction> CreateWrappedInstructionTree();
+
+  ControlMetrics m_metrics;
+  std::unique_ptr<Instruction> m_internal_instruction_tree;
+  WrappedInstructionManager m_instr_manager;
+  RetryBackoffOptions m_options;
+  std::size_t m_attempts;
+  DeadlineTimer m_retry_timer;
+  std::minstd_rand m_random_engine;
+  LazySetup m_lazy_setup;
+};
+
+}  // namespace oac_tree
+
+}  // namespace sup
+
+#endif  // SUP_OAC_TREE_PLUGIN_CONTROL_RETRY_UNTIL_INSTRUCTION_H_
@@ -0,0 +1,51 @@
+/******************************************************************************
+* $HeadURL: $
+* $Id: $
+*
+* Project       : Supervision and Automation - oac-tree
+*
+* Description   : SUP oac-tree control plugin
+*
+* Author        : Walter Van Herck (IO)
+*
+* Copyright (c) : 2010-2026 ITER Organization,
+*                 CS 90 046
+*                 13067 St. Paul-lez-Durance Cedex
+*                 France
+* SPDX-License-Identifier: MIT
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file LICENSE located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+
+#include "throttled_instruction_wrapper.h"
+
+#include "condition_debouncer.h"
+#include "condition_throttle.h"
+
+namespace sup {
+
+namespace oac_tree {
+
+ThrottledInstructionWrapper::ThrottledInstructionWrapper(Instruction* instr,
+                                                         ConditionThrottle& throttle,
+                                                         ConditionDebouncer* debouncer)
+  : ContextOVerrideInstructionWrapper(instr)
+  , m_throttle{throttle}
+  , m_debouncer{debouncer}
+{}
+
+ThrottledInstructionWrapper::~ThrottledInstructionWrapper() = default;
+
+ExecutionStatus ThrottledInstructionWrapper::ExecuteSingleImpl(UserInterface& ui, Workspace& ws)
+{
+  auto status = m_throttle.Evaluate(*GetInstruction(), SelectUserInterface(ui), ws);
+  return m_debouncer == nullptr ? status : m_debouncer->Update(status);
+}
+
+} // namespace oac_tree
+
+} // namespace sup
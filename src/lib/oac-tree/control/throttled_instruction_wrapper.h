@@ -0,0 +1,58 @@
+/******************************************************************************
+* $HeadURL: $
+* $Id: $
+*
+* Project       : Supervision and Automation - oac-tree
+*
+* Description   : SUP oac-tree control plugin
+*
+* Author        : Walter Van Herck (IO)
+*
+* Copyright (c) : 2010-2026 ITER Organization,
+*                 CS 90 046
+*                 13067 St. Paul-lez-Durance Cedex
+*                 France
+* SPDX-License-Identifier: MIT
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file LICENSE located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+
+#ifndef SUP_OAC_TREE_PLUGIN_CONTROL_THROTTLED_INSTRUCTION_WRAPPER_H_
+#define SUP_OAC_TREE_PLUGIN_CONTROL_THROTTLED_INSTRUCTION_WRAPPER_H_
+
+#include "context_override_instruction_wrapper.h"
+
+namespace sup
+{
+namespace oac_tree
+{
+class ConditionDebouncer;
+class ConditionThrottle;
+
+/**
+ * @brief Instruction wrapper that only executes the wrapped condition when allowed by the given
+ * throttle and returns its cached outcome otherwise. The outcome is passed through the optional
+ * debouncer.
+ */
+class ThrottledInstructionWrapper : public ContextOVerrideInstructionWrapper
+{
+public:
+  ThrottledInstructionWrapper(Instruction* instr, ConditionThrottle& throttle,
+                              ConditionDebouncer* debouncer = nullptr);
+  ~ThrottledInstructionWrapper() override;
+
+private:
+  ConditionThrottle& m_throttle;
+  ConditionDebouncer* m_debouncer;
+  ExecutionStatus ExecuteSingleImpl(UserInterface& ui, Workspace& ws) override;
+};
+
+}  // namespace oac_tree
+
+}  // namespace sup
+
+#endif  // SUP_OAC_TREE_PLUGIN_CONTROL_THROTTLED_INSTRUCTION_WRAPPER_H_
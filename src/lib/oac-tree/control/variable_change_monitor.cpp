@@ -0,0 +1,188 @@
+/******************************************************************************
+* $HeadURL: $
+* $Id: $
+*
+* Project       : Supervision and Automation - oac-tree
+*
+* Description   : SUP oac-tree control plugin
+*
+* Author        : Walter Van Herck (IO)
+*
+* Copyright (c) : 2010-2026 ITER Organization,
+*                 CS 90 046
+*                 13067 St. Paul-lez-Durance Cedex
+*                 France
+* SPDX-License-Identifier: MIT
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file LICENSE located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+#include "variable_change_monitor.h"
+
+#include <sup/oac-tree/constants.h>
+#include <sup/oac-tree/instruction.h>
+#include <sup/oac-tree/workspace.h>
+
+#include <utility>
+
+namespace
+{
+const std::string kVariableAttributeSuffix = "Var";
+const std::string kVariableNameAttribute = "varName";
+const char kVariableReferencePrefix = '@';
+
+bool IsVariableAttributeName(const std::string& attr_name);
+bool IsVariableReference(const std::string& attr_value);
+std::string StripFieldName(const std::string& var_field_name);
+void AddReferencedVariableNames(const sup::oac_tree::Instruction& instr,
+                                std::set<std::string>& var_names);
+bool AreAllAttributesClassified(const sup::oac_tree::Instruction& instr);
+}  // unnamed namespace
+
+namespace sup {
+
+namespace oac_tree {
+
+std::set<std::string> GetReferencedVariableNames(const Instruction& instr)
+{
+  std::set<std::string> result;
+  AddReferencedVariableNames(instr, result);
+  return result;
+}
+
+bool AreReferencedVariableNamesComplete(const Instruction& instr)
+{
+  return AreAllAttributesClassified(instr);
+}
+
+VariableChangeMonitor::MonitorState::MonitorState(std::set<std::string> names)
+  : m_var_names{std::move(names)}
+  , m_changed{false}
+{}
+
+VariableChangeMonitor::VariableChangeMonitor(std::set<std::string> var_names)
+  : m_state{std::make_shared<MonitorState>(std::move(var_names))}
+  , m_ws{nullptr}
+{}
+
+VariableChangeMonitor::~VariableChangeMonitor()
+{
+  Stop();
+}
+
+bool VariableChangeMonitor::IsEmpty() const
+{
+  return m_state->m_var_names.empty();
+}
+
+void VariableChangeMonitor::Start(Workspace& ws)
+{
+  if (m_ws != nullptr)
+  {
+    return;
+  }
+  m_ws = std::addressof(ws);
+  auto state = m_state;
+  auto callback = [state](const std::string& name, const sup::dto::AnyValue&, bool)
+  {
+    if (state->m_var_names.find(name) != state->m_var_names.end())
+    {
+      state->m_changed.store(true, std::memory_order_release);
+    }
+  };
+  (void)m_ws->RegisterGenericCallback(callback, m_state.get());
+}
+
+void VariableChangeMonitor::Stop()
+{
+  if (m_ws != nullptr)
+  {
+    m_ws->UnregisterListener(m_state.get());
+    m_ws = nullptr;
+  }
+  m_state->m_changed.store(false, std::memory_order_release);
+}
+
+bool VariableChangeMonitor::ConsumeChange()
+{
+  return m_state->m_changed.exchange(false, std::memory_order_acq_rel);
+}
+
+bool VariableChangeMonitor::HasPendingChange() const
+{
+  return m_state->m_changed.load(std::memory_order_acquire);
+}
+
+} // namespace oac_tree
+
+} // namespace sup
+
+namespace
+{
+using sup::oac_tree::Instruction;
+
+bool IsVariableAttributeName(const std::string& attr_name)
+{
+  if (attr_name == kVariableNameAttribute)
+  {
+    return true;
+  }
+  auto suffix_size = kVariableAttributeSuffix.size();
+  return attr_name.size() > suffix_size &&
+         attr_name.compare(attr_name.size() - suffix_size, suffix_size,
+                           kVariableAttributeSuffix) == 0;
+}
+
+bool IsVariableReference(const std::string& attr_value)
+{
+  return !attr_value.empty() && attr_value.front() == kVariableReferencePrefix;
+}
+
+std::string StripFieldName(const std::string& var_field_name)
+{
+  auto pos = var_field_name.find_first_of(".[");
+  return var_field_name.substr(0, pos);
+}
+
+void AddReferencedVariableNames(const Instruction& instr, std::set<std::string>& var_names)
+{
+  for (const auto& [attr_name, attr_value] : instr.GetStringAttributes())
+  {
+    if (IsVariableReference(attr_value))
+    {
+      (void)var_names.insert(StripFieldName(attr_value.substr(1)));
+    }
+    else if (IsVariableAttributeName(attr_name) && !attr_value.empty())
+    {
+      (void)var_names.insert(StripFieldName(attr_value));
+    }
+  }
+  for (auto child : instr.ChildInstructions())
+  {
+    AddReferencedVariableNames(*child, var_names);
+  }
+}
+
+bool AreAllAttributesClassified(const Instruction& instr)
+{
+  for (const auto& [attr_name, attr_value] : instr.GetStringAttributes())
+  {
+    if (!IsVariableReference(attr_value) && !IsVariableAttributeName(attr_name) &&
+        attr_name != sup::oac_tree::Constants::NAME_ATTRIBUTE_NAME)
+    {
+      return false;
+    }
+  }
+  for (auto child : instr.ChildInstructions())
+  {
+    if (!AreAllAttributesClassified(*child))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+}  // unnamed namespace
@@ -0,0 +1,114 @@
+/******************************************************************************
+* $HeadURL: $
+* $Id: $
+*
+* Project       : Supervision and Automation - oac-tree
+*
+* Description   : SUP oac-tree control plugin
+*
+* Author        : Walter Van Herck (IO)
+*
+* Copyright (c) : 2010-2026 ITER Organization,
+*                 CS 90 046
+*                 13067 St. Paul-lez-Durance Cedex
+*                 France
+* SPDX-License-Identifier: MIT
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file LICENSE located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+#ifndef SUP_OAC_TREE_PLUGIN_CONTROL_VARIABLE_CHANGE_MONITOR_H_
+#define SUP_OAC_TREE_PLUGIN_CONTROL_VARIABLE_CHANGE_MONITOR_H_
+
+#include <atomic>
+#include <memory>
+#include <set>
+#include <string>
+
+namespace sup
+{
+namespace oac_tree
+{
+class Instruction;
+class Workspace;
+
+/**
+ * @brief Retrieve the names of all workspace variables that are referenced by the attributes of
+ * the given instruction tree.
+ *
+ * @details Attributes are considered to reference a variable when their name ends with 'Var' or
+ * equals 'varName' (e.g. leftVar, inputVar) or when their value starts with '@'. Field
+ * accessors are removed, so that 'var.field' results in 'var'.
+ */
+std::set<std::string> GetReferencedVariableNames(const Instruction& instr);
+
+/**
+ * @brief Check if every attribute of the given instruction tree was classified: it either
+ * references a variable according to the rules of GetReferencedVariableNames or it is the name
+ * attribute. Only then the referenced variable names are known to be complete. Instructions that
+ * read variables without referencing them in their attributes cannot be detected.
+ */
+bool AreReferencedVariableNamesComplete(const Instruction& instr);
+
+/**
+ * @brief Tracks changes of a given set of workspace variables through workspace callbacks. This
+ * allows an instruction to only re-evaluate a condition when one of the variables it reads has
+ * changed.
+ *
+ * @note The registered callback only holds shared state, so it remains safe when it is called
+ * while the monitor is destroyed. The workspace must however outlive any call to Stop, including
+ * the one in the destructor when monitoring was started.
+ */
+class VariableChangeMonitor
+{
+public:
+  explicit VariableChangeMonitor(std::set<std::string> var_names);
+  ~VariableChangeMonitor();
+
+  /**
+   * @brief Check if the monitor has any variables to track.
+   */
+  bool IsEmpty() const;
+
+  /**
+   * @brief Start monitoring the variables in the given workspace. This is a no-op if monitoring
+   * was already started.
+   */
+  void Start(Workspace& ws);
+
+  /**
+   * @brief Stop monitoring and clear any pending change.
+   */
+  void Stop();
+
+  /**
+   * @brief Returns true if any of the monitored variables changed since the last call and clears
+   * the pending change.
+   */
+  bool ConsumeChange();
+
+  /**
+   * @brief Returns true if any of the monitored variables changed since the last call to
+   * ConsumeChange, without clearing the pending change.
+   */
+  bool HasPendingChange() const;
+
+private:
+  struct MonitorState
+  {
+    explicit MonitorState(std::set<std::string> names);
+    const std::set<std::string> m_var_names;
+    std::atomic<bool> m_changed;
+  };
+  std::shared_ptr<MonitorState> m_state;
+  Workspace* m_ws;
+};
+
+}  // namespace oac_tree
+
+}  // namespace sup
+
+#endif  // SUP_OAC_TREE_PLUGIN_CONTROL_VARIABLE_CHANGE_MONITOR_H_
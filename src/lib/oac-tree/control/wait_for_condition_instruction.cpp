@@ -22,7 +22,9 @@
 
 #include "wait_for_condition_instruction.h"
 
-#include "wrapped_user_interface.h"
+#include "condition_memo_table.h"
+#include "instruction_attribute_utils.h"
+#include "variable_change_monitor.h"
 
 #include <sup/oac-tree/constants.h>
 #include <sup/oac-tree/instruction_registry.h>
@@ -37,55 +39,85 @@ const std::string WaitForConditionInstruction::Type = "WaitForCondition";
 static bool _wait_for_condition_initialised_flag =
   RegisterGlobalInstruction<WaitForConditionInstruction>();
 
-const std::string LOG_MESSAGE_PREFIX =
-  "Forwarded log message from internal instruction of WaitForCondition: ";
+const std::string EVENT_DRIVEN_ATTRIBUTE = "eventDriven";
+const std::string COMPILE_CONDITION_ATTRIBUTE = "compileCondition";
 
 WaitForConditionInstruction::WaitForConditionInstruction()
   : DecoratorInstruction(Type)
-  , m_internal_instruction_tree{}
-  , m_instr_manager{}
+  , m_metrics{}
+  , m_condition{nullptr}
+  , m_program{}
+  , m_condition_status{ExecutionStatus::NOT_STARTED}
+  , m_monitor{}
+  , m_timer{}
+  , m_lazy_setup{}
 {
   (void)AddAttributeDefinition(Constants::TIMEOUT_SEC_ATTRIBUTE_NAME, sup::dto::Float64Type)
     .SetCategory(AttributeCategory::kBoth).SetMandatory();
+  (void)AddAttributeDefinition(EVENT_DRIVEN_ATTRIBUTE, sup::dto::BooleanType);
+  (void)AddAttributeDefinition(COMPILE_CONDITION_ATTRIBUTE, sup::dto::BooleanType);
+  (void)AddAttributeDefinition(LAZY_SETUP_ATTRIBUTE, sup::dto::BooleanType);
 }
 
 WaitForConditionInstruction::~WaitForConditionInstruction() = default;
 
-void WaitForConditionInstruction::SetupImpl(const Procedure& proc)
+DeadlineTimer::Clock::duration WaitForConditionInstruction::GetTimeRemaining() const
 {
-  auto instr_tree = CreateWrappedInstructionTree();
-  std::swap(m_internal_instruction_tree, instr_tree);
-  m_internal_instruction_tree->Setup(proc);
+  return m_timer.GetTimeRemaining();
 }
 
-ExecutionStatus WaitForConditionInstruction::ExecuteSingleImpl(UserInterface& ui, Workspace& ws)
+bool WaitForConditionInstruction::IsConditionCompiled() const
 {
-  auto& wrapped_ui = m_instr_manager.GetWrappedUI(ui, LOG_MESSAGE_PREFIX);
-  m_internal_instruction_tree->ExecuteSingle(wrapped_ui, ws);
-  return m_internal_instruction_tree->GetStatus();
+  return static_cast<bool>(m_program);
 }
 
-void WaitForConditionInstruction::HaltImpl(UserInterface& ui)
+WakeUpHint WaitForConditionInstruction::GetWakeUpHint() const
 {
-  if (m_internal_instruction_tree)
+  if (m_condition == nullptr || !m_timer.IsStarted())
+  {
+    return ImmediateWakeUpHint();
+  }
+  auto condition_status = m_condition_status;
+  if (condition_status == ExecutionStatus::RUNNING)
+  {
+    return oac_tree::GetWakeUpHint(*m_condition);
+  }
+  if (condition_status != ExecutionStatus::FAILURE)
   {
-    auto& wrapped_ui = m_instr_manager.GetWrappedUI(ui, LOG_MESSAGE_PREFIX);
-    m_internal_instruction_tree->Halt(wrapped_ui);
+    return ImmediateWakeUpHint();
   }
+  WakeUpHint result;
+  result.m_deadline = m_timer.GetDeadline();
+  if (!m_monitor || m_monitor->IsEmpty())
+  {
+    result.m_polling = true;
+    return result;
+  }
+  if (m_monitor->HasPendingChange())
+  {
+    return ImmediateWakeUpHint();
+  }
+  result.m_on_variable_change = true;
+  return result;
 }
 
-void WaitForConditionInstruction::ResetHook(UserInterface& ui)
+const ControlMetrics& WaitForConditionInstruction::GetControlMetrics() const
 {
-  if (m_internal_instruction_tree)
-  {
-    auto& wrapped_ui = m_instr_manager.GetWrappedUI(ui, LOG_MESSAGE_PREFIX);
-    m_internal_instruction_tree->Reset(wrapped_ui);
-  }
+  return m_metrics;
 }
 
-std::unique_ptr<Instruction> WaitForConditionInstruction::CreateWrappedInstructionTree()
+void WaitForConditionInstruction::SetupImpl(const Procedure& proc)
 {
-  m_instr_manager.ClearWrappers();
+  m_metrics.SetTraceLabel(GetInstructionLabel(*this));
+  m_condition = nullptr;
+  m_program.reset();
+  m_condition_status = ExecutionStatus::NOT_STARTED;
+  if (m_monitor)
+  {
+    m_monitor->Stop();
+  }
+  m_monitor.reset();
+  m_timer.Stop();
   auto children = ChildInstructions();
   if (children.size() != 1)
   {
@@ -93,21 +125,125 @@ std::unique_ptr<Instruction> WaitForConditionInstruction::CreateWrappedInstructi
       "Trying to setup decorator without a child";
     throw InstructionSetupException(error_message);
   }
+  m_lazy_setup.Setup(*this, proc, [this](const Procedure& p) { SetupCondition(p); });
+}
+
+void WaitForConditionInstruction::SetupCondition(const Procedure& proc)
+{
+  m_condition = ChildInstructions()[0];
+  m_condition->Setup(proc);
+  if (GetBooleanAttribute(*this, COMPILE_CONDITION_ATTRIBUTE, false))
+  {
+    m_program = ConditionProgram::Compile(*m_condition);
+  }
+  // When the outcome may depend on more than the referenced variables, e.g. on time, or when not
+  // all referenced variables are known, changes could be missed: poll instead
+  if (GetBooleanAttribute(*this, EVENT_DRIVEN_ATTRIBUTE, false) &&
+      IsMemoizableCondition(*m_condition) && AreReferencedVariableNamesComplete(*m_condition))
+  {
+    m_monitor = std::make_unique<VariableChangeMonitor>(GetReferencedVariableNames(*m_condition));
+  }
+}
+
+ExecutionStatus WaitForConditionInstruction::ExecuteSingleImpl(UserInterface& ui, Workspace& ws)
+{
+  ScopedMetricsTimer tick_timer{m_metrics, ControlMetrics::Section::kTick};
+  if (!m_lazy_setup.Complete(ui))
+  {
+    return ExecutionStatus::FAILURE;
+  }
+  if (!m_timer.IsStarted())
+  {
+    double timeout_sec = 0.0;
+    if (!GetAttributeValueAs(Constants::TIMEOUT_SEC_ATTRIBUTE_NAME, ws, ui, timeout_sec))
+    {
+      return ExecutionStatus::FAILURE;
+    }
+    m_timer.Start(timeout_sec);
+    if (m_monitor)
+    {
+      m_monitor->Start(ws);
+    }
+  }
+  auto condition_status = m_condition_status;
+  if (NeedsExecute(condition_status) || NeedsReevaluation())
+  {
+    condition_status = EvaluateCondition(ui, ws);
+    m_condition_status = condition_status;
+  }
+  if (condition_status == ExecutionStatus::SUCCESS)
+  {
+    return ExecutionStatus::SUCCESS;
+  }
+  if (condition_status == ExecutionStatus::FAILURE && m_timer.IsExpired())
+  {
+    m_metrics.RecordTimeout();
+    return ExecutionStatus::FAILURE;
+  }
+  return ExecutionStatus::RUNNING;
+}
 
-  // Wrapped condition
-  auto cond_wrapper = m_instr_manager.CreateInstructionWrapper(*children[0]);
+void WaitForConditionInstruction::HaltImpl(UserInterface& ui)
+{
+  if (m_condition != nullptr)
+  {
+    m_condition->Halt(ui);
+  }
+}
 
-  // Fail with timeout
-  auto fail = GlobalInstructionRegistry().Create("Fail");
-  (void)fail->AddAttribute(Constants::TIMEOUT_SEC_ATTRIBUTE_NAME,
-                     GetAttributeString(Constants::TIMEOUT_SEC_ATTRIBUTE_NAME));
+void WaitForConditionInstruction::ResetHook(UserInterface& ui)
+{
+  m_timer.Stop();
+  m_condition_status = ExecutionStatus::NOT_STARTED;
+  if (m_monitor)
+  {
+    m_monitor->Stop();
+  }
+  if (m_condition != nullptr)
+  {
+    m_condition->Reset(ui);
+  }
+}
 
-  // Reactive fallback combining the condition and the sequence
-  auto fallback = GlobalInstructionRegistry().Create("ReactiveFallback");
-  (void)fallback->InsertInstruction(std::move(cond_wrapper), 0);
-  (void)fallback->InsertInstruction(std::move(fail), 1);
+bool WaitForConditionInstruction::NeedsReevaluation()
+{
+  // Without a monitor or without any variables to monitor, the condition is polled on every tick.
+  // Pending changes are consumed before evaluation, so that changes during evaluation are not
+  // lost.
+  if (!m_monitor)
+  {
+    return true;
+  }
+  return m_monitor->ConsumeChange() || m_monitor->IsEmpty();
+}
 
-  return fallback;
+ExecutionStatus WaitForConditionInstruction::EvaluateCondition(UserInterface& ui, Workspace& ws)
+{
+  if (m_program)
+  {
+    bool active = ControlMetrics::IsActive();
+    auto start = active ? ControlMetrics::Clock::now() : ControlMetrics::Clock::time_point{};
+    bool result = false;
+    if (m_program->Evaluate(ws, result))
+    {
+      if (active)
+      {
+        auto duration = ControlMetrics::Clock::now() - start;
+        m_metrics.Record(ControlMetrics::Section::kCondition, duration);
+        m_metrics.Trace(ControlMetrics::Section::kCondition, start, duration);
+      }
+      return result ? ExecutionStatus::SUCCESS : ExecutionStatus::FAILURE;
+    }
+  }
+  // Not compiled or a variable could not be read: execute the condition tree, which also takes
+  // care of reporting errors.
+  auto condition_status = m_condition->GetStatus();
+  if (IsFinishedStatus(condition_status))
+  {
+    m_condition->Reset(ui);
+  }
+  ExecuteMeasuredCondition(*m_condition, ui, ws, std::addressof(m_metrics));
+  return m_condition->GetStatus();
 }
 
 } // namespace oac_tree
@@ -23,7 +23,11 @@
 #ifndef SUP_OAC_TREE_PLUGIN_CONTROL_WAIT_FOR_CONDITION_INSTRUCTION_H_
 #define SUP_OAC_TREE_PLUGIN_CONTROL_WAIT_FOR_CONDITION_INSTRUCTION_H_
 
-#include "wrapped_instruction_manager.h"
+#include "condition_program.h"
+#include "control_metrics.h"
+#include "deadline_timer.h"
+#include "lazy_setup.h"
+#include "wake_up_hint.h"
 
 #include <sup/oac-tree/decorator_instruction.h>
 
@@ -33,12 +37,32 @@ namespace sup
 {
 namespace oac_tree
 {
+class VariableChangeMonitor;
 
 /**
  * @brief Waits with a timeout for a condition to be satisfied. The instruction fails if the timeout
  * was reached before the condition became true.
+ *
+ * @details The timeout is measured against an absolute deadline of the steady clock, which is
+ * computed on the first tick. In event driven mode, the condition is only re-evaluated when one of
+ * the workspace variables it references has changed, instead of on every tick. If not all
+ * referenced variables can be determined, or if the condition contains instructions whose outcome
+ * may depend on more than those variables (see IsMemoizableCondition), it falls back to polling.
+ *
+ * While waiting, the instruction provides a wake-up hint with its deadline and whether a tick is
+ * only needed on variable changes or on every poll.
+ *
+ * When the compileCondition attribute is set, a pure condition tree is compiled during setup into
+ * a flat expression program that is evaluated directly against the workspace values. Conditions
+ * that cannot be compiled are executed as usual.
+ *
+ * With the 'lazySetup' attribute, the condition is only set up (and compiled) on the first tick.
+ *
+ * Condition evaluations and timeouts are recorded in the execution metrics.
  */
-class WaitForConditionInstruction : public DecoratorInstruction
+class WaitForConditionInstruction : public DecoratorInstruction,
+                                    public WakeUpHintProvider,
+                                    public ControlMetricsProvider
 {
 public:
   WaitForConditionInstruction();
@@ -46,15 +70,36 @@ public:
 
   static const std::string Type;
 
+  /**
+   * @brief Time remaining before the timeout, or zero when not running.
+   */
+  DeadlineTimer::Clock::duration GetTimeRemaining() const;
+
+  /**
+   * @brief Check if the condition was compiled into an expression program during setup.
+   */
+  bool IsConditionCompiled() const;
+
+  WakeUpHint GetWakeUpHint() const override;
+
+  const ControlMetrics& GetControlMetrics() const override;
+
 private:
   void SetupImpl(const Procedure& proc) override;
   ExecutionStatus ExecuteSingleImpl(UserInterface& ui, Workspace& ws) override;
   void HaltImpl(UserInterface& ui) override;
   void ResetHook(UserInterface& ui) override;
-  std::unique_ptr<Instruction> CreateWrappedInstructionTree();
+  void SetupCondition(const Procedure& proc);
+  bool NeedsReevaluation();
+  ExecutionStatus EvaluateCondition(UserInterface& ui, Workspace& ws);
 
-  std::unique_ptr<Instruction> m_internal_instruction_tree;
-  WrappedInstructionManager m_instr_manager;
+  ControlMetrics m_metrics;
+  Instruction* m_condition;
+  std::unique_ptr<ConditionProgram> m_program;
+  ExecutionStatus m_condition_status;
+  std::unique_ptr<VariableChangeMonitor> m_monitor;
+  DeadlineTimer m_timer;
+  LazySetup m_lazy_setup;
 };
 
 }  // namespace oac_tree
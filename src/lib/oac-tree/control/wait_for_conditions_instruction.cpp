@@ -0,0 +1,274 @@
+/******************************************************************************
+* $HeadURL: $
+* $Id: $
+*
+* Project       : Supervision and Automation - oac-tree
+*
+* Description   : SUP oac-tree control plugin
+*
+* Author        : Walter Van Herck (IO)
+*
+* Copyright (c) : 2010-2026 ITER Organization,
+*                 CS 90 046
+*                 13067 St. Paul-lez-Durance Cedex
+*                 France
+* SPDX-License-Identifier: MIT
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file LICENSE located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+
+#include "wait_for_conditions_instruction.h"
+
+#include "instruction_attribute_utils.h"
+
+#include <sup/oac-tree/constants.h>
+#include <sup/oac-tree/instruction_registry.h>
+#include <sup/oac-tree/instruction_utils.h>
+
+#include <iterator>
+#include <memory>
+#include <string>
+
+namespace sup {
+
+namespace oac_tree {
+
+const std::string WaitForConditionsInstruction::Type = "WaitForConditions";
+static bool _wait_for_conditions_initialised_flag =
+  RegisterGlobalInstruction<WaitForConditionsInstruction>();
+
+const std::string WaitForAllConditionsInstruction::Type = "WaitForAllConditions";
+static bool _wait_for_all_conditions_initialised_flag =
+  RegisterGlobalInstruction<WaitForAllConditionsInstruction>();
+
+const std::string WaitForAnyConditionInstruction::Type = "WaitForAnyCondition";
+static bool _wait_for_any_condition_initialised_flag =
+  RegisterGlobalInstruction<WaitForAnyConditionInstruction>();
+
+const std::string THRESHOLD_ATTRIBUTE = "threshold";
+
+WaitForConditionsInstruction::WaitForConditionsInstruction()
+  : WaitForConditionsInstruction(Type, Quorum::kThreshold)
+{}
+
+WaitForConditionsInstruction::WaitForConditionsInstruction(const std::string& type, Quorum quorum)
+  : CompoundInstruction(type)
+  , m_metrics{}
+  , m_quorum{quorum}
+  , m_conditions{}
+  , m_pending{}
+  , m_required{0}
+  , m_satisfied{0}
+  , m_running{false}
+  , m_timer{}
+{
+  (void)AddAttributeDefinition(Constants::TIMEOUT_SEC_ATTRIBUTE_NAME, sup::dto::Float64Type)
+    .SetCategory(AttributeCategory::kBoth).SetMandatory();
+  if (m_quorum == Quorum::kThreshold)
+  {
+    (void)AddAttributeDefinition(THRESHOLD_ATTRIBUTE, sup::dto::UnsignedInteger32Type)
+      .SetMandatory();
+  }
+}
+
+WaitForConditionsInstruction::~WaitForConditionsInstruction() = default;
+
+std::size_t WaitForConditionsInstruction::GetRequiredCount() const
+{
+  return m_required;
+}
+
+std::size_t WaitForConditionsInstruction::GetSatisfiedCount() const
+{
+  return m_satisfied;
+}
+
+DeadlineTimer::Clock::duration WaitForConditionsInstruction::GetTimeRemaining() const
+{
+  return m_timer.GetTimeRemaining();
+}
+
+WakeUpHint WaitForConditionsInstruction::GetWakeUpHint() const
+{
+  if (!m_timer.IsStarted())
+  {
+    return ImmediateWakeUpHint();
+  }
+  WakeUpHint result;
+  result.m_deadline = m_timer.GetDeadline();
+  result.m_polling = true;
+  if (m_running)
+  {
+    for (const auto condition : m_pending)
+    {
+      if (condition->GetStatus() == ExecutionStatus::RUNNING)
+      {
+        result = CombineWakeUpHints(result, oac_tree::GetWakeUpHint(*condition));
+      }
+    }
+  }
+  return result;
+}
+
+const ControlMetrics& WaitForConditionsInstruction::GetControlMetrics() const
+{
+  return m_metrics;
+}
+
+void WaitForConditionsInstruction::SetupImpl(const Procedure& proc)
+{
+  m_metrics.SetTraceLabel(GetInstructionLabel(*this));
+  m_timer.Stop();
+  m_satisfied = 0;
+  m_running = false;
+  m_conditions = ChildInstructions();
+  if (m_conditions.empty())
+  {
+    std::string error_message = InstructionErrorProlog(*this) +
+      "This compound instruction requires at least one child instruction";
+    throw InstructionSetupException(error_message);
+  }
+  m_required = GetRequiredCountFromAttributes(m_conditions.size());
+  for (auto condition : m_conditions)
+  {
+    condition->Setup(proc);
+  }
+  m_pending = m_conditions;
+}
+
+ExecutionStatus WaitForConditionsInstruction::ExecuteSingleImpl(UserInterface& ui, Workspace& ws)
+{
+  ScopedMetricsTimer tick_timer{m_metrics, ControlMetrics::Section::kTick};
+  if (!m_timer.IsStarted())
+  {
+    double timeout_sec = 0.0;
+    if (!GetAttributeValueAs(Constants::TIMEOUT_SEC_ATTRIBUTE_NAME, ws, ui, timeout_sec))
+    {
+      return ExecutionStatus::FAILURE;
+    }
+    m_timer.Start(timeout_sec);
+  }
+  if (EvaluatePendingConditions(ui, ws))
+  {
+    return ExecutionStatus::SUCCESS;
+  }
+  if (!m_running && m_timer.IsExpired())
+  {
+    m_metrics.RecordTimeout();
+    return ExecutionStatus::FAILURE;
+  }
+  return ExecutionStatus::RUNNING;
+}
+
+void WaitForConditionsInstruction::HaltImpl(UserInterface& ui)
+{
+  for (auto condition : m_pending)
+  {
+    condition->Halt(ui);
+  }
+}
+
+void WaitForConditionsInstruction::ResetHook(UserInterface& ui)
+{
+  m_timer.Stop();
+  m_satisfied = 0;
+  m_running = false;
+  m_pending = m_conditions;
+  for (auto condition : m_conditions)
+  {
+    condition->Reset(ui);
+  }
+}
+
+std::size_t WaitForConditionsInstruction::GetRequiredCountFromAttributes(
+  std::size_t n_conditions) const
+{
+  switch (m_quorum)
+  {
+  case Quorum::kAll:
+    return n_conditions;
+  case Quorum::kAny:
+    return 1;
+  default:
+    break;
+  }
+  auto threshold = GetUnsignedIntegerAttribute(*this, THRESHOLD_ATTRIBUTE, 0);
+  if (threshold == 0 || threshold > n_conditions)
+  {
+    std::string error_message = InstructionErrorProlog(*this) +
+      "Attribute [" + THRESHOLD_ATTRIBUTE + "] must be between 1 and the number of child " +
+      "instructions (" + std::to_string(n_conditions) + ")";
+    throw InstructionSetupException(error_message);
+  }
+  return threshold;
+}
+
+bool WaitForConditionsInstruction::EvaluatePendingConditions(UserInterface& ui, Workspace& ws)
+{
+  // Satisfied conditions are removed from the pending list, while the order of the remaining
+  // conditions is preserved.
+  m_running = false;
+  auto next = m_pending.begin();
+  for (auto it = m_pending.begin(); it != m_pending.end(); ++it)
+  {
+    auto condition = *it;
+    if (IsFinishedStatus(condition->GetStatus()))
+    {
+      condition->Reset(ui);
+    }
+    ExecuteMeasuredCondition(*condition, ui, ws, std::addressof(m_metrics));
+    auto condition_status = condition->GetStatus();
+    if (condition_status == ExecutionStatus::SUCCESS)
+    {
+      if (++m_satisfied >= m_required)
+      {
+        // Conditions that are still running are not needed anymore
+        HaltRunningConditions(ui, m_pending.begin(), next);
+        HaltRunningConditions(ui, std::next(it), m_pending.end());
+        m_running = false;
+        return true;
+      }
+      continue;
+    }
+    if (condition_status == ExecutionStatus::RUNNING)
+    {
+      m_running = true;
+    }
+    *next++ = condition;
+  }
+  m_pending.erase(next, m_pending.end());
+  return false;
+}
+
+void WaitForConditionsInstruction::HaltRunningConditions(
+  UserInterface& ui, std::vector<Instruction*>::iterator first,
+  std::vector<Instruction*>::iterator last)
+{
+  for (auto it = first; it != last; ++it)
+  {
+    if ((*it)->GetStatus() == ExecutionStatus::RUNNING)
+    {
+      (*it)->Halt(ui);
+    }
+  }
+}
+
+WaitForAllConditionsInstruction::WaitForAllConditionsInstruction()
+  : WaitForConditionsInstruction(Type, Quorum::kAll)
+{}
+
+WaitForAllConditionsInstruction::~WaitForAllConditionsInstruction() = default;
+
+WaitForAnyConditionInstruction::WaitForAnyConditionInstruction()
+  : WaitForConditionsInstruction(Type, Quorum::kAny)
+{}
+
+WaitForAnyConditionInstruction::~WaitForAnyConditionInstruction() = default;
+
+} // namespace oac_tree
+
+} // namespace sup
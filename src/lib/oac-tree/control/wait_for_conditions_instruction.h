@@ -0,0 +1,143 @@
+/******************************************************************************
+* $HeadURL: $
+* $Id: $
+*
+* Project       : Supervision and Automation - oac-tree
+*
+* Description   : SUP oac-tree control plugin
+*
+* Author        : Walter Van Herck (IO)
+*
+* Copyright (c) : 2010-2026 ITER Organization,
+*                 CS 90 046
+*                 13067 St. Paul-lez-Durance Cedex
+*                 France
+* SPDX-License-Identifier: MIT
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file LICENSE located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+
+#ifndef SUP_OAC_TREE_PLUGIN_CONTROL_WAIT_FOR_CONDITIONS_INSTRUCTION_H_
+#define SUP_OAC_TREE_PLUGIN_CONTROL_WAIT_FOR_CONDITIONS_INSTRUCTION_H_
+
+#include "control_metrics.h"
+#include "deadline_timer.h"
+#include "wake_up_hint.h"
+
+#include <sup/oac-tree/compound_instruction.h>
+
+#include <vector>
+
+namespace sup
+{
+namespace oac_tree
+{
+
+/**
+ * @brief Waits with a single timeout until a given number of its condition children were
+ * satisfied. The instruction fails if the timeout was reached before enough conditions became
+ * true.
+ *
+ * @details A condition that returned SUCCESS is considered settled and is not evaluated anymore
+ * until the instruction is reset. On each tick, only the remaining conditions are evaluated, in
+ * the order of the child instructions, and the evaluation stops as soon as enough conditions are
+ * satisfied. All conditions share one deadline of the steady clock, which is computed on the first
+ * tick.
+ *
+ * The required number of conditions is given by the threshold attribute. WaitForAllConditions and
+ * WaitForAnyCondition are the special cases that require all conditions or a single one.
+ *
+ * Condition evaluations and timeouts are recorded in the execution metrics.
+ */
+class WaitForConditionsInstruction : public CompoundInstruction,
+                                     public WakeUpHintProvider,
+                                     public ControlMetricsProvider
+{
+public:
+  WaitForConditionsInstruction();
+  ~WaitForConditionsInstruction() override;
+
+  static const std::string Type;
+
+  /**
+   * @brief Number of conditions that need to be satisfied, as determined during setup.
+   */
+  std::size_t GetRequiredCount() const;
+
+  /**
+   * @brief Number of conditions that were satisfied since the last reset.
+   */
+  std::size_t GetSatisfiedCount() const;
+
+  /**
+   * @brief Time remaining before the timeout, or zero when not running.
+   */
+  DeadlineTimer::Clock::duration GetTimeRemaining() const;
+
+  WakeUpHint GetWakeUpHint() const override;
+
+  const ControlMetrics& GetControlMetrics() const override;
+
+protected:
+  enum class Quorum
+  {
+    kAll,
+    kAny,
+    kThreshold
+  };
+
+  WaitForConditionsInstruction(const std::string& type, Quorum quorum);
+
+private:
+  void SetupImpl(const Procedure& proc) override;
+  ExecutionStatus ExecuteSingleImpl(UserInterface& ui, Workspace& ws) override;
+  void HaltImpl(UserInterface& ui) override;
+  void ResetHook(UserInterface& ui) override;
+  std::size_t GetRequiredCountFromAttributes(std::size_t n_conditions) const;
+  bool EvaluatePendingConditions(UserInterface& ui, Workspace& ws);
+  void HaltRunningConditions(UserInterface& ui, std::vector<Instruction*>::iterator first,
+                             std::vector<Instruction*>::iterator last);
+
+  ControlMetrics m_metrics;
+  Quorum m_quorum;
+  std::vector<Instruction*> m_conditions;
+  std::vector<Instruction*> m_pending;
+  std::size_t m_required;
+  std::size_t m_satisfied;
+  bool m_running;
+  DeadlineTimer m_timer;
+};
+
+/**
+ * @brief Waits with a timeout until all of its condition children were satisfied.
+ */
+class WaitForAllConditionsInstruction : public WaitForConditionsInstruction
+{
+public:
+  WaitForAllConditionsInstruction();
+  ~WaitForAllConditionsInstruction() override;
+
+  static const std::string Type;
+};
+
+/**
+ * @brief Waits with a timeout until one of its condition children was satisfied.
+ */
+class WaitForAnyConditionInstruction : public WaitForConditionsInstruction
+{
+public:
+  WaitForAnyConditionInstruction();
+  ~WaitForAnyConditionInstruction() override;
+
+  static const std::string Type;
+};
+
+}  // namespace oac_tree
+
+}  // namespace sup
+
+#endif  // SUP_OAC_TREE_PLUGIN_CONTROL_WAIT_FOR_CONDITIONS_INSTRUCTION_H_
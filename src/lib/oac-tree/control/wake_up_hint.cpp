@@ -0,0 +1,109 @@
+/******************************************************************************
+* $HeadURL: $
+* $Id: $
+*
+* Project       : Supervision and Automation - oac-tree
+*
+* Description   : SUP oac-tree control plugin
+*
+* Author        : Walter Van Herck (IO)
+*
+* Copyright (c) : 2010-2026 ITER Organization,
+*                 CS 90 046
+*                 13067 St. Paul-lez-Durance Cedex
+*                 France
+* SPDX-License-Identifier: MIT
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file LICENSE located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+
+#include "wake_up_hint.h"
+
+#include <sup/oac-tree/instruction.h>
+
+#include <algorithm>
+
+namespace sup {
+
+namespace oac_tree {
+
+WakeUpHintProvider::~WakeUpHintProvider() = default;
+
+WakeUpHint ImmediateWakeUpHint()
+{
+  WakeUpHint result;
+  result.m_deadline = WakeUpHint::Clock::time_point::min();
+  return result;
+}
+
+WakeUpHint PollingWakeUpHint()
+{
+  WakeUpHint result;
+  result.m_polling = true;
+  return result;
+}
+
+WakeUpHint CombineWakeUpHints(const WakeUpHint& left, const WakeUpHint& right)
+{
+  WakeUpHint result;
+  result.m_deadline = std::min(left.m_deadline, right.m_deadline);
+  result.m_on_variable_change = left.m_on_variable_change || right.m_on_variable_change;
+  result.m_polling = left.m_polling || right.m_polling;
+  return result;
+}
+
+WakeUpHint GetWakeUpHint(const Instruction& instr)
+{
+  auto provider = dynamic_cast<const WakeUpHintProvider*>(std::addressof(instr));
+  if (provider != nullptr)
+  {
+    return provider->GetWakeUpHint();
+  }
+  auto children = instr.ChildInstructions();
+  if (children.empty())
+  {
+    return PollingWakeUpHint();
+  }
+  bool child_running = false;
+  WakeUpHint result;
+  for (auto child : children)
+  {
+    if (child->GetStatus() == ExecutionStatus::RUNNING)
+    {
+      result = CombineWakeUpHints(result, GetWakeUpHint(*child));
+      child_running = true;
+    }
+  }
+  // Without running children, the next tick will start or finish a child
+  return child_running ? result : ImmediateWakeUpHint();
+}
+
+WakeUpHint::Clock::time_point GetNextWakeUpTime(const WakeUpHint& hint,
+                                                WakeUpHint::Clock::time_point now,
+                                                WakeUpHint::Clock::duration poll_period)
+{
+  if (hint.m_deadline <= now)
+  {
+    return now;
+  }
+  bool bounded = !hint.m_polling && !hint.m_on_variable_change &&
+                 hint.m_deadline != WakeUpHint::Clock::time_point::max();
+  if (bounded)
+  {
+    return hint.m_deadline;
+  }
+  // Avoid overflow for deadlines far in the future
+  if (hint.m_deadline - now < poll_period)
+  {
+    return hint.m_deadline;
+  }
+  return now + poll_period;
+}
+
+} // namespace oac_tree
+
+} // namespace sup
@@ -0,0 +1,104 @@
+/******************************************************************************
+* $HeadURL: $
+* $Id: $
+*
+* Project       : Supervision and Automation - oac-tree
+*
+* Description   : SUP oac-tree control plugin
+*
+* Author        : Walter Van Herck (IO)
+*
+* Copyright (c) : 2010-2026 ITER Organization,
+*                 CS 90 046
+*                 13067 St. Paul-lez-Durance Cedex
+*                 France
+* SPDX-License-Identifier: MIT
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file LICENSE located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+
+#ifndef SUP_OAC_TREE_PLUGIN_CONTROL_WAKE_UP_HINT_H_
+#define SUP_OAC_TREE_PLUGIN_CONTROL_WAKE_UP_HINT_H_
+
+#include <chrono>
+
+namespace sup
+{
+namespace oac_tree
+{
+class Instruction;
+
+/**
+ * @brief Hint for a runner about when a running instruction (tree) needs to be ticked again.
+ *
+ * @details The runner needs to tick again at the latest at the deadline. When polling is
+ * requested, regular ticks before the deadline are needed, with a period chosen by the runner.
+ * When only a variable change is requested, a runner that is notified of workspace changes can
+ * sleep until the deadline or until such a change.
+ *
+ * Deadlines refer to the control clock (see ControlClockNow), which is the steady clock unless
+ * another clock was installed.
+ */
+struct WakeUpHint
+{
+  using Clock = std::chrono::steady_clock;
+
+  Clock::time_point m_deadline = Clock::time_point::max();
+  bool m_on_variable_change = false;
+  bool m_polling = false;
+};
+
+/**
+ * @brief Interface for instructions that can provide a wake-up hint while they are running.
+ */
+class WakeUpHintProvider
+{
+public:
+  virtual ~WakeUpHintProvider();
+
+  virtual WakeUpHint GetWakeUpHint() const = 0;
+};
+
+/**
+ * @brief Hint that requests to tick again immediately.
+ */
+WakeUpHint ImmediateWakeUpHint();
+
+/**
+ * @brief Hint that requests regular ticks, without a known deadline.
+ */
+WakeUpHint PollingWakeUpHint();
+
+/**
+ * @brief Combine two hints into one that satisfies both.
+ */
+WakeUpHint CombineWakeUpHints(const WakeUpHint& left, const WakeUpHint& right);
+
+/**
+ * @brief Retrieve the wake-up hint of an instruction tree. Instructions that implement
+ * WakeUpHintProvider provide their own hint, while the hints of the running children of other
+ * instructions are combined. Leaf instructions without a hint are assumed to need polling.
+ */
+WakeUpHint GetWakeUpHint(const Instruction& instr);
+
+/**
+ * @brief Time until which a runner, that is not notified of workspace changes, can sleep before
+ * the next tick.
+ *
+ * @param hint Wake-up hint of the running instruction tree.
+ * @param now Current time.
+ * @param poll_period Maximum sleep time when polling or waiting for a variable change.
+ */
+WakeUpHint::Clock::time_point GetNextWakeUpTime(const WakeUpHint& hint,
+                                                WakeUpHint::Clock::time_point now,
+                                                WakeUpHint::Clock::duration poll_period);
+
+}  // namespace oac_tree
+
+}  // namespace sup
+
+#endif  // SUP_OAC_TREE_PLUGIN_CONTROL_WAKE_UP_HINT_H_
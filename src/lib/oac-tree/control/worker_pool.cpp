@@ -0,0 +1,139 @@
+/******************************************************************************
+* $HeadURL: $
+* $Id: $
+*
+* Project       : Supervision and Automation - oac-tree
+*
+* Description   : SUP oac-tree control plugin
+*
+* Author        : Walter Van Herck (IO)
+*
+* Copyright (c) : 2010-2026 ITER Organization,
+*                 CS 90 046
+*                 13067 St. Paul-lez-Durance Cedex
+*                 France
+* SPDX-License-Identifier: MIT
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file LICENSE located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+
+#include "worker_pool.h"
+
+#include <algorithm>
+
+namespace
+{
+const std::size_t kMinControlWorkers = 2;
+const std::size_t kMaxControlWorkers = 8;
+const std::size_t kControlQueueSize = 1024;
+}  // unnamed namespace
+
+namespace sup {
+
+namespace oac_tree {
+
+WorkerPool::WorkerPool(std::size_t n_workers, std::size_t max_queue_size)
+  : m_max_queue_size{max_queue_size}
+  , m_mtx{}
+  , m_cv{}
+  , m_queue{}
+  , m_metrics{}
+  , m_halt{false}
+  , m_workers{}
+{
+  n_workers = std::max<std::size_t>(n_workers, 1u);
+  m_workers.reserve(n_workers);
+  for (std::size_t idx = 0; idx < n_workers; ++idx)
+  {
+    m_workers.emplace_back(&WorkerPool::WorkerLoop, this);
+  }
+}
+
+WorkerPool::~WorkerPool()
+{
+  {
+    std::lock_guard<std::mutex> lk{m_mtx};
+    m_halt = true;
+  }
+  m_cv.notify_all();
+  for (auto& worker : m_workers)
+  {
+    worker.join();
+  }
+}
+
+bool WorkerPool::Submit(Task task)
+{
+  {
+    std::lock_guard<std::mutex> lk{m_mtx};
+    if (m_halt || m_queue.size() >= m_max_queue_size)
+    {
+      ++m_metrics.m_rejected;
+      return false;
+    }
+    m_queue.push_back(QueuedTask{std::move(task), Clock::now()});
+    ++m_metrics.m_submitted;
+    m_metrics.m_max_queue_depth = std::max(m_metrics.m_max_queue_depth, m_queue.size());
+  }
+  m_cv.notify_one();
+  return true;
+}
+
+std::size_t WorkerPool::GetWorkerCount() const
+{
+  return m_workers.size();
+}
+
+std::size_t WorkerPool::GetMaxQueueSize() const
+{
+  return m_max_queue_size;
+}
+
+WorkerPoolMetrics WorkerPool::GetMetrics() const
+{
+  std::lock_guard<std::mutex> lk{m_mtx};
+  auto result = m_metrics;
+  result.m_queue_depth = m_queue.size();
+  return result;
+}
+
+void WorkerPool::WorkerLoop()
+{
+  std::unique_lock<std::mutex> lk{m_mtx};
+  while (true)
+  {
+    m_cv.wait(lk, [this]{ return m_halt || !m_queue.empty(); });
+    // Remaining tasks are still executed, since their submitters may be waiting for them
+    if (m_queue.empty())
+    {
+      break;
+    }
+    auto queued_task = std::move(m_queue.front());
+    m_queue.pop_front();
+    auto latency = Clock::now() - queued_task.m_submit_time;
+    m_metrics.m_total_dispatch_latency += latency;
+    m_metrics.m_max_dispatch_latency = std::max(m_metrics.m_max_dispatch_latency, latency);
+    lk.unlock();
+    queued_task.m_task();
+    // Release resources captured by the task outside of the lock
+    queued_task.m_task = nullptr;
+    lk.lock();
+    ++m_metrics.m_completed;
+  }
+}
+
+WorkerPool& GetControlWorkerPool()
+{
+  static WorkerPool pool{std::clamp<std::size_t>(std::thread::hardware_concurrency(),
+                                                 kMinControlWorkers, kMaxControlWorkers),
+                         kControlQueueSize};
+  return pool;
+}
+
+} // namespace oac_tree
+
+} // namespace sup
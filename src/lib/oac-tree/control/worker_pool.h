@@ -0,0 +1,114 @@
+/******************************************************************************
+* $HeadURL: $
+* $Id: $
+*
+* Project       : Supervision and Automation - oac-tree
+*
+* Description   : SUP oac-tree control plugin
+*
+* Author        : Walter Van Herck (IO)
+*
+* Copyright (c) : 2010-2026 ITER Organization,
+*                 CS 90 046
+*                 13067 St. Paul-lez-Durance Cedex
+*                 France
+* SPDX-License-Identifier: MIT
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file LICENSE located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+
+#ifndef SUP_OAC_TREE_PLUGIN_CONTROL_WORKER_POOL_H_
+#define SUP_OAC_TREE_PLUGIN_CONTROL_WORKER_POOL_H_
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace sup
+{
+namespace oac_tree
+{
+
+/**
+ * @brief Snapshot of the metrics of a WorkerPool.
+ *
+ * @details The dispatch latency is the time between submitting a task and a worker starting it.
+ */
+struct WorkerPoolMetrics
+{
+  std::size_t m_queue_depth = 0;
+  std::size_t m_max_queue_depth = 0;
+  std::size_t m_submitted = 0;
+  std::size_t m_rejected = 0;
+  std::size_t m_completed = 0;
+  std::chrono::steady_clock::duration m_total_dispatch_latency{};
+  std::chrono::steady_clock::duration m_max_dispatch_latency{};
+};
+
+/**
+ * @brief Fixed number of worker threads that execute short tasks from a bounded FIFO queue.
+ *
+ * @details Tasks should not block for long, since they share a bounded number of threads. Tasks
+ * that are still queued when the pool is destroyed are executed before the destructor returns.
+ */
+class WorkerPool
+{
+public:
+  using Clock = std::chrono::steady_clock;
+  using Task = std::function<void()>;
+
+  WorkerPool(std::size_t n_workers, std::size_t max_queue_size);
+  ~WorkerPool();
+
+  WorkerPool(const WorkerPool&) = delete;
+  WorkerPool& operator=(const WorkerPool&) = delete;
+
+  /**
+   * @brief Queue a task for execution.
+   *
+   * @return false if the queue was full and the task was rejected.
+   */
+  bool Submit(Task task);
+
+  std::size_t GetWorkerCount() const;
+  std::size_t GetMaxQueueSize() const;
+
+  WorkerPoolMetrics GetMetrics() const;
+
+private:
+  struct QueuedTask
+  {
+    Task m_task;
+    Clock::time_point m_submit_time;
+  };
+  void WorkerLoop();
+
+  const std::size_t m_max_queue_size;
+  mutable std::mutex m_mtx;
+  std::condition_variable m_cv;
+  std::deque<QueuedTask> m_queue;
+  WorkerPoolMetrics m_metrics;
+  bool m_halt;
+  std::vector<std::thread> m_workers;
+};
+
+/**
+ * @brief Worker pool shared by all instructions of this plugin. It is created on first use with
+ * a number of workers based on the hardware concurrency.
+ */
+WorkerPool& GetControlWorkerPool();
+
+}  // namespace oac_tree
+
+}  // namespace sup
+
+#endif  // SUP_OAC_TREE_PLUGIN_CONTROL_WORKER_POOL_H_
@@ -0,0 +1,81 @@
+/******************************************************************************
+* $HeadURL: $
+* $Id: $
+*
+* Project       : Supervision and Automation - oac-tree
+*
+* Description   : SUP oac-tree control plugin
+*
+* Author        : Walter Van Herck (IO)
+*
+* Copyright (c) : 2010-2026 ITER Organization,
+*                 CS 90 046
+*                 13067 St. Paul-lez-Durance Cedex
+*                 France
+* SPDX-License-Identifier: MIT
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file LICENSE located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+
+#include "workspace_version_tracker.h"
+
+#include <sup/oac-tree/workspace.h>
+
+namespace sup {
+
+namespace oac_tree {
+
+WorkspaceVersionTracker::WorkspaceVersionTracker()
+  : m_state{std::make_shared<TrackerState>()}
+  , m_ws{nullptr}
+{}
+
+WorkspaceVersionTracker::~WorkspaceVersionTracker()
+{
+  if (m_ws != nullptr)
+  {
+    m_ws->UnregisterListener(m_state.get());
+  }
+}
+
+bool WorkspaceVersionTracker::Start(Workspace& ws)
+{
+  if (m_ws != nullptr)
+  {
+    return IsTracking(ws);
+  }
+  m_ws = std::addressof(ws);
+  auto state = m_state;
+  auto callback = [state](const std::string& name, const sup::dto::AnyValue&, bool)
+  {
+    std::lock_guard<std::mutex> lk{state->m_mtx};
+    ++state->m_versions[name];
+  };
+  (void)ws.RegisterGenericCallback(callback, m_state.get());
+  return true;
+}
+
+bool WorkspaceVersionTracker::IsTracking(const Workspace& ws) const
+{
+  return m_ws == std::addressof(ws);
+}
+
+void WorkspaceVersionTracker::GetVersions(const std::vector<std::string>& var_names,
+                                          std::vector<std::uint64_t>& versions) const
+{
+  versions.resize(var_names.size());
+  std::lock_guard<std::mutex> lk{m_state->m_mtx};
+  for (std::size_t i = 0; i < var_names.size(); ++i)
+  {
+    auto it = m_state->m_versions.find(var_names[i]);
+    versions[i] = it == m_state->m_versions.end() ? 0u : it->second;
+  }
+}
+
+} // namespace oac_tree
+
+} // namespace sup
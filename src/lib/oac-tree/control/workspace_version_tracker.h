@@ -0,0 +1,87 @@
+/******************************************************************************
+* $HeadURL: $
+* $Id: $
+*
+* Project       : Supervision and Automation - oac-tree
+*
+* Description   : SUP oac-tree control plugin
+*
+* Author        : Walter Van Herck (IO)
+*
+* Copyright (c) : 2010-2026 ITER Organization,
+*                 CS 90 046
+*                 13067 St. Paul-lez-Durance Cedex
+*                 France
+* SPDX-License-Identifier: MIT
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file LICENSE located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+
+#ifndef SUP_OAC_TREE_PLUGIN_CONTROL_WORKSPACE_VERSION_TRACKER_H_
+#define SUP_OAC_TREE_PLUGIN_CONTROL_WORKSPACE_VERSION_TRACKER_H_
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace sup
+{
+namespace oac_tree
+{
+class Workspace;
+
+/**
+ * @brief Keeps a version number per workspace variable, which is incremented on every change of
+ * that variable. Variables that never changed since the tracker was started have version zero.
+ *
+ * @note As for VariableChangeMonitor, the registered callback only holds shared state, so it
+ * remains safe when it is called while the tracker is destroyed. The callback is unregistered on
+ * destruction, so the workspace needs to outlive a started tracker.
+ */
+class WorkspaceVersionTracker
+{
+public:
+  WorkspaceVersionTracker();
+  ~WorkspaceVersionTracker();
+
+  WorkspaceVersionTracker(const WorkspaceVersionTracker&) = delete;
+  WorkspaceVersionTracker& operator=(const WorkspaceVersionTracker&) = delete;
+
+  /**
+   * @brief Start tracking the given workspace. This is a no-op if tracking was already started.
+   *
+   * @return false if the tracker was already started for a different workspace.
+   */
+  bool Start(Workspace& ws);
+
+  bool IsTracking(const Workspace& ws) const;
+
+  /**
+   * @brief Retrieve the current versions of the given variables, in the same order. The output
+   * vector is overwritten, so it can be reused without allocating.
+   */
+  void GetVersions(const std::vector<std::string>& var_names,
+                   std::vector<std::uint64_t>& versions) const;
+
+private:
+  struct TrackerState
+  {
+    std::mutex m_mtx;
+    std::unordered_map<std::string, std::uint64_t> m_versions;
+  };
+  std::shared_ptr<TrackerState> m_state;
+  Workspace* m_ws;
+};
+
+}  // namespace oac_tree
+
+}  // namespace sup
+
+#endif  // SUP_OAC_TREE_PLUGIN_CONTROL_WORKSPACE_VERSION_TRACKER_H_
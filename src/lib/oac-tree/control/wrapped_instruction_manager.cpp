@@ -23,6 +23,9 @@
 #include "wrapped_instruction_manager.h"
 
 #include "context_override_instruction_wrapper.h"
+#include "measured_instruction_wrapper.h"
+#include "recheck_instruction_wrapper.h"
+#include "throttled_instruction_wrapper.h"
 #include "wrapped_user_interface.h"
 
 #include <sup/oac-tree/instruction.h>
@@ -38,36 +41,109 @@ namespace oac_tree {
 WrappedInstructionManager::WrappedInstructionManager()
   : m_wrapped_instructions{}
   , m_wrapped_ui{}
+  , m_retired_wrapped_uis{}
+  , m_context_ui{nullptr}
+  , m_log_options{}
 {}
 
 WrappedInstructionManager::~WrappedInstructionManager() = default;
 
 std::unique_ptr<Instruction> WrappedInstructionManager::CreateInstructionWrapper(Instruction& instr)
 {
-  (void)m_wrapped_instructions.emplace_back(std::make_unique<ContextOVerrideInstructionWrapper>(std::addressof(instr)));
-  auto wrapper = m_wrapped_instructions.back().get();
-  auto result = std::make_unique<NonOwningInstructionWrapper>(wrapper);
-  return result;
+  return AddWrapper(std::make_unique<ContextOVerrideInstructionWrapper>(std::addressof(instr)));
+}
+
+std::unique_ptr<Instruction> WrappedInstructionManager::CreateRecheckWrapper(Instruction& instr)
+{
+  return AddWrapper(std::make_unique<RecheckInstructionWrapper>(std::addressof(instr)));
+}
+
+std::unique_ptr<Instruction> WrappedInstructionManager::CreateThrottledWrapper(
+  Instruction& instr, ConditionThrottle& throttle, ConditionDebouncer* debouncer)
+{
+  return AddWrapper(
+    std::make_unique<ThrottledInstructionWrapper>(std::addressof(instr), throttle, debouncer));
+}
+
+std::unique_ptr<Instruction> WrappedInstructionManager::CreateMeasuredWrapper(
+  Instruction& instr, ControlMetrics& metrics, ControlMetrics::Section section)
+{
+  return AddWrapper(
+    std::make_unique<MeasuredInstructionWrapper>(std::addressof(instr), metrics, section));
 }
 
 UserInterface& WrappedInstructionManager::GetWrappedUI(UserInterface& ui, const std::string& prefix)
 {
-  SetContext(ui);
-  if (!m_wrapped_ui)
+  if (m_wrapped_ui && std::addressof(ui) == m_context_ui)
   {
-    m_wrapped_ui = std::make_unique<WrappedUserInterface>(ui, prefix);
+    return *m_wrapped_ui;
   }
+  if (std::addressof(ui) != m_context_ui)
+  {
+    SetContext(ui);
+    if (m_wrapped_ui)
+    {
+      // Asynchronous internal instructions may still hold a reference to the previous wrapped
+      // UserInterface, so it is kept until the internal tree was reset or the wrappers are
+      // cleared.
+      m_retired_wrapped_uis.push_back(std::move(m_wrapped_ui));
+    }
+    // Switching back to a previous UserInterface reuses its wrapped UserInterface, so that
+    // alternating between user interfaces does not accumulate retired ones.
+    auto it = std::find_if(m_retired_wrapped_uis.begin(), m_retired_wrapped_uis.end(),
+                           [&ui](const std::unique_ptr<WrappedUserInterface>& wrapped_ui) {
+                             return std::addressof(wrapped_ui->GetForwardedUserInterface()) ==
+                                    std::addressof(ui);
+                           });
+    if (it != m_retired_wrapped_uis.end())
+    {
+      m_wrapped_ui = std::move(*it);
+      (void)m_retired_wrapped_uis.erase(it);
+      return *m_wrapped_ui;
+    }
+  }
+  m_wrapped_ui = std::make_unique<WrappedUserInterface>(ui, prefix, m_log_options);
   return *m_wrapped_ui;
 }
 
+void WrappedInstructionManager::ReleaseRetiredUIs()
+{
+  m_retired_wrapped_uis.clear();
+}
+
 void WrappedInstructionManager::ClearWrappers()
 {
   m_wrapped_instructions.clear();
   m_wrapped_ui.reset();
+  m_retired_wrapped_uis.clear();
+  m_context_ui = nullptr;
+}
+
+void WrappedInstructionManager::SetLogForwardingOptions(const LogForwardingOptions& options)
+{
+  m_log_options = options;
+}
+
+std::size_t WrappedInstructionManager::GetDroppedLogMessageCount() const
+{
+  return m_wrapped_ui ? m_wrapped_ui->GetDroppedMessageCount() : 0;
+}
+
+std::unique_ptr<Instruction> WrappedInstructionManager::AddWrapper(
+  std::unique_ptr<ContextOVerrideInstructionWrapper> wrapper)
+{
+  if (m_context_ui != nullptr)
+  {
+    wrapper->SetUserInterface(*m_context_ui);
+  }
+  (void)m_wrapped_instructions.emplace_back(std::move(wrapper));
+  auto result = std::make_unique<NonOwningInstructionWrapper>(m_wrapped_instructions.back().get());
+  return result;
 }
 
 void WrappedInstructionManager::SetContext(UserInterface& ui)
 {
+  m_context_ui = std::addressof(ui);
   for (auto& instr : m_wrapped_instructions)
   {
     instr->SetUserInterface(ui);
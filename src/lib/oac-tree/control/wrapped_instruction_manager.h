@@ -23,6 +23,9 @@
 #ifndef SUP_OAC_TREE_PLUGIN_CONTROL_WRAPPED_INSTRUCTION_MANAGER_H_
 #define SUP_OAC_TREE_PLUGIN_CONTROL_WRAPPED_INSTRUCTION_MANAGER_H_
 
+#include "control_metrics.h"
+#include "log_forwarding_options.h"
+
 #include <memory>
 #include <string>
 #include <vector>
@@ -31,10 +34,13 @@ namespace sup
 {
 namespace oac_tree
 {
+class ConditionDebouncer;
+class ConditionThrottle;
 class Instruction;
 class ContextOVerrideInstructionWrapper;
 class UserInterface;
 class Workspace;
+class WrappedUserInterface;
 /**
  * @brief This class manages wrappers, that do not own their child instructions. It is used to
  * create private instruction trees inside an instruction and attach already owned child
@@ -49,14 +55,70 @@ public:
 
   std::unique_ptr<Instruction> CreateInstructionWrapper(Instruction& instr);
 
+  /**
+   * @brief Create a wrapper for an instruction that was already wrapped by this manager, in
+   * order to re-check its outcome later in the same private tree without cloning it.
+   */
+  std::unique_ptr<Instruction> CreateRecheckWrapper(Instruction& instr);
+
+  /**
+   * @brief Create a wrapper for a condition that is only executed when allowed by the given
+   * throttle. When a debouncer is given, the wrapper returns the debounced outcome. The throttle
+   * and debouncer need to outlive the wrapper.
+   */
+  std::unique_ptr<Instruction> CreateThrottledWrapper(Instruction& instr,
+                                                      ConditionThrottle& throttle,
+                                                      ConditionDebouncer* debouncer = nullptr);
+
+  /**
+   * @brief Create a wrapper that records the execution of the instruction as a condition
+   * evaluation or an action tick. The metrics need to outlive the wrapper.
+   */
+  std::unique_ptr<Instruction> CreateMeasuredWrapper(Instruction& instr, ControlMetrics& metrics,
+                                                     ControlMetrics::Section section);
+
+  /**
+   * @brief Get the UserInterface to pass to the private instruction tree and bind the wrapped
+   * instructions to the given UserInterface.
+   *
+   * @details Binding only happens when the UserInterface differs from the one of the previous
+   * call, so that calling this method on every tick has constant cost. When a different
+   * UserInterface is passed, a new wrapped UserInterface is created that forwards to it. The
+   * previous one is retired: it stays valid for asynchronous internal instructions until
+   * ReleaseRetiredUIs or ClearWrappers is called. Passing a UserInterface that was used before
+   * reuses its retired wrapped UserInterface, so at most one is kept per UserInterface.
+   */
   UserInterface& GetWrappedUI(UserInterface& ui, const std::string& prefix);
 
+  /**
+   * @brief Destroy the retired wrapped user interfaces. This may only be called when no internal
+   * instruction can still use them, e.g. right after the private instruction tree was reset.
+   */
+  void ReleaseRetiredUIs();
+
   void ClearWrappers();
 
+  /**
+   * @brief Set the options for forwarding log messages through the wrapped UserInterface. These
+   * options are applied the next time the wrapped UserInterface is created.
+   */
+  void SetLogForwardingOptions(const LogForwardingOptions& options);
+
+  /**
+   * @brief Number of forwarded log messages that were dropped by the current wrapped
+   * UserInterface.
+   */
+  std::size_t GetDroppedLogMessageCount() const;
+
 private:
   std::vector<std::unique_ptr<ContextOVerrideInstructionWrapper>> m_wrapped_instructions;
-  std::unique_ptr<UserInterface> m_wrapped_ui;
+  std::unique_ptr<WrappedUserInterface> m_wrapped_ui;
+  std::vector<std::unique_ptr<WrappedUserInterface>> m_retired_wrapped_uis;
+  UserInterface* m_context_ui;
+  LogForwardingOptions m_log_options;
 
+  std::unique_ptr<Instruction> AddWrapper(
+    std::unique_ptr<ContextOVerrideInstructionWrapper> wrapper);
   void SetContext(UserInterface& ui);
 };
 
@@ -22,21 +22,123 @@
 
 #include "wrapped_user_interface.h"
 
+#include "async_log_forwarder.h"
+#include "log_deduplicator.h"
+
+#include <chrono>
+
 namespace sup {
 
 namespace oac_tree {
 
-WrappedUserInterface::WrappedUserInterface(UserInterface& ui, const std::string& prefix)
+WrappedUserInterface::WrappedUserInterface(UserInterface& ui, const std::string& prefix,
+                                           const LogForwardingOptions& options)
   : m_ui{ui}
   , m_prefix{prefix}
-{}
+  , m_async_forwarder{}
+  , m_deduplicator{}
+  , m_dedup_mtx{}
+{
+  if (options.m_queue_size > 0)
+  {
+    m_async_forwarder = std::make_unique<AsyncLogForwarder>(ui, options.m_queue_size,
+                                                            options.m_overflow_policy);
+  }
+  if (options.m_dedup_window > 0.0)
+  {
+    auto window = std::chrono::duration_cast<LogDeduplicator::Clock::duration>(
+      std::chrono::duration<double>(options.m_dedup_window));
+    m_deduplicator = std::make_unique<LogDeduplicator>(window);
+  }
+}
+
+WrappedUserInterface::~WrappedUserInterface()
+{
+  if (m_deduplicator)
+  {
+    // Report remaining repetitions before the asynchronous forwarder is destroyed
+    LogRepeatSummary summary;
+    if (m_deduplicator->TakeSummary(summary))
+    {
+      ForwardRepeatSummary(summary);
+    }
+  }
+}
 
-WrappedUserInterface::~WrappedUserInterface() = default;
+std::size_t WrappedUserInterface::GetDroppedMessageCount() const
+{
+  return m_async_forwarder ? m_async_forwarder->GetDroppedCount() : 0;
+}
+
+UserInterface& WrappedUserInterface::GetForwardedUserInterface() const
+{
+  return m_ui;
+}
+
+bool WrappedUserInterface::HasQueuedMessages() const
+{
+  return m_async_forwarder && !m_async_forwarder->IsEmpty();
+}
 
 void WrappedUserInterface::Log(int severity, const std::string& message)
 {
-  std::string wrapped_message = m_prefix + message;
-  m_ui.Log(severity, wrapped_message);
+  if (m_deduplicator)
+  {
+    LogDeduplicated(severity, message);
+    return;
+  }
+  LogPrefixed(severity, message);
+}
+
+void WrappedUserInterface::LogDeduplicated(int severity, const std::string& message)
+{
+  // Suppressed repetitions return before the prefixed message is built
+  std::lock_guard<std::mutex> lk{m_dedup_mtx};
+  LogRepeatSummary summary;
+  auto forward = m_deduplicator->Register(severity, message, LogDeduplicator::Clock::now(),
+                                          summary);
+  if (summary.m_count > 0)
+  {
+    ForwardRepeatSummary(summary);
+  }
+  if (forward)
+  {
+    LogPrefixed(severity, message);
+  }
+}
+
+void WrappedUserInterface::LogPrefixed(int severity, const std::string& message)
+{
+  thread_local std::string buffer;
+  thread_local bool buffer_in_use = false;
+  // Nested forwarding on the same thread (wrapped interfaces forwarding to each other) cannot
+  // reuse the buffer, since it is still referenced by the outer call.
+  if (buffer_in_use)
+  {
+    Forward(severity, m_prefix + message);
+    return;
+  }
+  buffer_in_use = true;
+  (void)buffer.assign(m_prefix).append(message);
+  Forward(severity, buffer);
+  buffer_in_use = false;
+}
+
+void WrappedUserInterface::ForwardRepeatSummary(const LogRepeatSummary& summary)
+{
+  auto repeat_message = m_prefix + "Last message repeated " + std::to_string(summary.m_count) +
+    " time(s): " + summary.m_message;
+  Forward(summary.m_severity, repeat_message);
+}
+
+void WrappedUserInterface::Forward(int severity, const std::string& message)
+{
+  if (m_async_forwarder)
+  {
+    (void)m_async_forwarder->Push(severity, message);
+    return;
+  }
+  m_ui.Log(severity, message);
 }
 
 } // namespace oac_tree
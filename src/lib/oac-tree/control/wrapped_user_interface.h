@@ -23,26 +23,63 @@
 #ifndef SUP_OAC_TREE_PLUGIN_CONTROL_WRAPPED_USER_INTERFACE_H_
 #define SUP_OAC_TREE_PLUGIN_CONTROL_WRAPPED_USER_INTERFACE_H_
 
+#include "log_forwarding_options.h"
+
 #include <sup/oac-tree/user_interface.h>
 
+#include <memory>
+#include <mutex>
+
 namespace sup
 {
 namespace oac_tree
 {
+class AsyncLogForwarder;
 class Instruction;
+class LogDeduplicator;
+struct LogRepeatSummary;
 /**
  * @brief UserInterface wrapper that only forwards log messages
+ *
+ * @details The prefixed message is built in a buffer that is reused per thread, so that
+ * forwarding does not allocate once the buffer has grown to the needed size. When the options
+ * specify a non-zero queue size, messages are forwarded asynchronously by a background thread and
+ * logging never blocks the calling thread. When a deduplication window is configured, identical
+ * messages within that window are collapsed and reported as a single summary of the repetitions.
  */
 class WrappedUserInterface : public DefaultUserInterface
 {
 public:
-  WrappedUserInterface(UserInterface& ui, const std::string& prefix);
+  WrappedUserInterface(UserInterface& ui, const std::string& prefix,
+                       const LogForwardingOptions& options = {});
   ~WrappedUserInterface() override;
 
+  /**
+   * @brief Number of messages that were dropped because the asynchronous queue was full.
+   */
+  std::size_t GetDroppedMessageCount() const;
+
+  /**
+   * @brief Get the UserInterface to which messages are forwarded.
+   */
+  UserInterface& GetForwardedUserInterface() const;
+
+  /**
+   * @brief Check if asynchronously forwarded messages are still queued.
+   */
+  bool HasQueuedMessages() const;
+
 private:
   UserInterface& m_ui;
   std::string m_prefix;
+  std::unique_ptr<AsyncLogForwarder> m_async_forwarder;
+  std::unique_ptr<LogDeduplicator> m_deduplicator;
+  std::mutex m_dedup_mtx;
   void Log(int severity, const std::string& message) override;
+  void LogDeduplicated(int severity, const std::string& message);
+  void LogPrefixed(int severity, const std::string& message);
+  void ForwardRepeatSummary(const LogRepeatSummary& summary);
+  void Forward(int severity, const std::string& message);
 };
 
 }  // namespace oac_tree
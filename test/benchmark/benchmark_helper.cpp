@@ -0,0 +1,202 @@
+/******************************************************************************
+* $HeadURL: $
+* $Id: $
+*
+* Project       : Supervision and Automation - oac-tree
+*
+* Description   : SUP oac-tree control plugin
+*
+* Author        : Walter Van Herck (IO)
+*
+* Copyright (c) : 2010-2026 ITER Organization,
+*                 CS 90 046
+*                 13067 St. Paul-lez-Durance Cedex
+*                 France
+* SPDX-License-Identifier: MIT
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file LICENSE located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+#include "benchmark_helper.h"
+
+#include "allocation_counter.h"
+#include "unit_test_helper.h"
+
+#include "oac-tree/control/control_clock.h"
+#include "oac-tree/control/wake_up_hint.h"
+
+#include <sup/oac-tree/execution_status.h>
+#include <sup/oac-tree/sequence_parser.h>
+#include <sup/oac-tree/user_interface.h>
+
+#include <stdexcept>
+
+namespace sup {
+
+namespace oac_tree {
+
+namespace test {
+
+namespace
+{
+std::unique_ptr<Procedure> ParseBenchmarkProcedure(const std::string& body);
+
+void SetAllocationCounters(benchmark::State& state, const AllocationCounter& counter);
+}  // unnamed namespace
+
+std::string CreateConditionXml(std::size_t n_leaves, bool satisfied)
+{
+  static const std::string kSatisfiedLeaf = R"(<Equals leftVar="live" rightVar="zero"/>)";
+  static const std::string kFailingLeaf = R"(<Equals leftVar="live" rightVar="one"/>)";
+  if (n_leaves < 2u)
+  {
+    return satisfied ? kSatisfiedLeaf : kFailingLeaf;
+  }
+  std::string result = "<Sequence>";
+  for (std::size_t idx = 0; idx + 1u < n_leaves; ++idx)
+  {
+    result += kSatisfiedLeaf;
+  }
+  result += satisfied ? kSatisfiedLeaf : kFailingLeaf;
+  result += "</Sequence>";
+  return result;
+}
+
+std::string CreateWorkspaceXml()
+{
+  return R"(
+    <Workspace>
+        <Local name="live" type='{"type":"uint64"}' value='0' />
+        <Local name="zero" type='{"type":"uint64"}' value='0' />
+        <Local name="one" type='{"type":"uint64"}' value='1' />
+    </Workspace>)";
+}
+
+void RunTickBenchmark(benchmark::State& state, const std::string& body)
+{
+  auto proc = ParseBenchmarkProcedure(body);
+  DefaultUserInterface ui;
+  proc->Setup();
+  // First tick starts asynchronous branches and triggers lazy initialisation:
+  proc->ExecuteSingle(ui);
+  AllocationCounter counter;
+  for (auto _ : state)
+  {
+    if (IsFinishedStatus(proc->GetStatus()))
+    {
+      proc->Reset(ui);
+    }
+    proc->ExecuteSingle(ui);
+  }
+  SetAllocationCounters(state, counter);
+  proc->Reset(ui);
+}
+
+void RunExecutionBenchmark(benchmark::State& state, const std::string& body)
+{
+  auto proc = ParseBenchmarkProcedure(body);
+  DefaultUserInterface ui;
+  proc->Setup();
+  AllocationCounter counter;
+  std::size_t n_ticks = 0;
+  for (auto _ : state)
+  {
+    do
+    {
+      proc->ExecuteSingle(ui);
+      ++n_ticks;
+    } while (!IsFinishedStatus(proc->GetStatus()));
+    proc->Reset(ui);
+  }
+  state.counters["ticks/exec"] =
+    benchmark::Counter(static_cast<double>(n_ticks), benchmark::Counter::kAvgIterations);
+  state.counters["allocs/exec"] =
+    benchmark::Counter(static_cast<double>(counter.Allocations()),
+                       benchmark::Counter::kAvgIterations);
+}
+
+void RunSetupBenchmark(benchmark::State& state, const std::string& body)
+{
+  AllocationCounter counter;
+  std::size_t excluded_allocations = 0;
+  std::size_t excluded_bytes = 0;
+  for (auto _ : state)
+  {
+    state.PauseTiming();
+    AllocationCounter parse_counter;
+    auto proc = ParseBenchmarkProcedure(body);
+    excluded_allocations += parse_counter.Allocations();
+    excluded_bytes += parse_counter.Bytes();
+    state.ResumeTiming();
+    proc->Setup();
+    state.PauseTiming();
+    proc.reset();
+    state.ResumeTiming();
+  }
+  auto allocations = static_cast<double>(counter.Allocations() - excluded_allocations);
+  auto bytes = static_cast<double>(counter.Bytes() - excluded_bytes);
+  state.counters["allocs/setup"] = benchmark::Counter(allocations, benchmark::Counter::kAvgIterations);
+  state.counters["bytes/setup"] = benchmark::Counter(bytes, benchmark::Counter::kAvgIterations);
+}
+
+void RunSimulatedTimeBenchmark(benchmark::State& state, const std::string& body,
+                               std::chrono::steady_clock::duration poll_period)
+{
+  auto proc = ParseBenchmarkProcedure(body);
+  DefaultUserInterface ui;
+  ManualControlClock clock;
+  ScopedControlClock scoped_clock{clock};
+  proc->Setup();
+  const auto start = clock.Now();
+  std::size_t n_ticks = 0;
+  for (auto _ : state)
+  {
+    proc->ExecuteSingle(ui);
+    ++n_ticks;
+    while (!IsFinishedStatus(proc->GetStatus()))
+    {
+      auto root = proc->RootInstruction();
+      auto hint = root != nullptr ? GetWakeUpHint(*root) : PollingWakeUpHint();
+      clock.AdvanceTo(GetNextWakeUpTime(hint, clock.Now(), poll_period));
+      proc->ExecuteSingle(ui);
+      ++n_ticks;
+    }
+    proc->Reset(ui);
+  }
+  auto simulated = std::chrono::duration<double>(clock.Now() - start);
+  state.counters["ticks/exec"] =
+    benchmark::Counter(static_cast<double>(n_ticks), benchmark::Counter::kAvgIterations);
+  state.counters["simulated_s/exec"] =
+    benchmark::Counter(simulated.count(), benchmark::Counter::kAvgIterations);
+}
+
+namespace
+{
+std::unique_ptr<Procedure> ParseBenchmarkProcedure(const std::string& body)
+{
+  auto proc = ParseProcedureString(CreateProcedureString(body));
+  if (!proc)
+  {
+    throw std::runtime_error("Could not parse benchmark procedure");
+  }
+  return proc;
+}
+
+void SetAllocationCounters(benchmark::State& state, const AllocationCounter& counter)
+{
+  state.counters["allocs/tick"] =
+    benchmark::Counter(static_cast<double>(counter.Allocations()),
+                       benchmark::Counter::kAvgIterations);
+  state.counters["bytes/tick"] =
+    benchmark::Counter(static_cast<double>(counter.Bytes()), benchmark::Counter::kAvgIterations);
+}
+}  // unnamed namespace
+
+} // namespace test
+
+} // namespace oac_tree
+
+} // namespace sup
@@ -0,0 +1,91 @@
+/******************************************************************************
+* $HeadURL: $
+* $Id: $
+*
+* Project       : Supervision and Automation - oac-tree
+*
+* Description   : SUP oac-tree control plugin
+*
+* Author        : Walter Van Herck (IO)
+*
+* Copyright (c) : 2010-2026 ITER Organization,
+*                 CS 90 046
+*                 13067 St. Paul-lez-Durance Cedex
+*                 France
+* SPDX-License-Identifier: MIT
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file LICENSE located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+#ifndef SUP_OAC_TREE_PLUGIN_CONTROL_BENCHMARK_HELPER_H_
+#define SUP_OAC_TREE_PLUGIN_CONTROL_BENCHMARK_HELPER_H_
+
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+#include <cstddef>
+#include <string>
+
+namespace sup {
+
+namespace oac_tree {
+
+namespace test {
+
+/**
+ * Creates the XML of a condition tree with the given number of Equals leaf instructions. When
+ * more than one leaf is requested, they are combined in a Sequence. If the condition is not
+ * satisfied, only the last leaf fails, so the full tree is always evaluated.
+ */
+std::string CreateConditionXml(std::size_t n_leaves, bool satisfied);
+
+/**
+ * Creates the XML of a workspace containing the variables used by conditions created with
+ * CreateConditionXml.
+ */
+std::string CreateWorkspaceXml();
+
+/**
+ * Benchmark the cost of a single tick of the procedure defined by the given body. When the
+ * procedure finishes, it is reset (inside the timed loop) before the next tick.
+ *
+ * @note Reports the average number of heap allocations and allocated bytes per tick.
+ */
+void RunTickBenchmark(benchmark::State& state, const std::string& body);
+
+/**
+ * Benchmark the cost of a complete execution of the procedure defined by the given body: it is
+ * ticked until it finishes and then reset.
+ *
+ * @note Reports the average number of ticks and heap allocations per execution.
+ */
+void RunExecutionBenchmark(benchmark::State& state, const std::string& body);
+
+/**
+ * Benchmark the cost of the Setup of the procedure defined by the given body. Parsing of the
+ * procedure is excluded from the measurement.
+ *
+ * @note Reports the average number of heap allocations and allocated bytes per Setup.
+ */
+void RunSetupBenchmark(benchmark::State& state, const std::string& body);
+
+/**
+ * Benchmark the cost of a complete execution of the procedure defined by the given body in
+ * simulated time: a manual control clock is installed and advanced to the next wake-up time
+ * between ticks, polling at most every poll_period, instead of waiting for it.
+ *
+ * @note Reports the average number of ticks and simulated seconds per execution.
+ */
+void RunSimulatedTimeBenchmark(benchmark::State& state, const std::string& body,
+                               std::chrono::steady_clock::duration poll_period);
+
+} // namespace test
+
+} // namespace oac_tree
+
+} // namespace sup
+
+#endif // SUP_OAC_TREE_PLUGIN_CONTROL_BENCHMARK_HELPER_H_
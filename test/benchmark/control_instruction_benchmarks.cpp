@@ -0,0 +1,428 @@
+/******************************************************************************
+* $HeadURL: $
+* $Id: $
+*
+* Project       : Supervision and Automation - oac-tree
+*
+* Description   : SUP oac-tree control plugin
+*
+* Author        : Walter Van Herck (IO)
+*
+* Copyright (c) : 2010-2026 ITER Organization,
+*                 CS 90 046
+*                 13067 St. Paul-lez-Durance Cedex
+*                 France
+* SPDX-License-Identifier: MIT
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file LICENSE located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+#include "benchmark_helper.h"
+
+#include "oac-tree/control/array_comparison_kernel.h"
+#include "oac-tree/control/worker_pool.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <vector>
+
+using namespace sup::oac_tree;
+
+namespace
+{
+const std::string kLongTimeout = "3600.0";
+// Timeout of about eleven days, only feasible in simulated time
+const std::string kSimulatedTimeout = "1000000.0";
+const std::string kShortAction = R"(<Copy inputVar="zero" outputVar="live"/>)";
+
+std::size_t ConditionSize(const benchmark::State& state)
+{
+  return static_cast<std::size_t>(state.range(0));
+}
+
+std::string AchieveConditionSuccessBody(std::size_t n_leaves)
+{
+  return "<AchieveCondition>" + test::CreateConditionXml(n_leaves, true)
+         + R"(<Wait timeout=")" + kLongTimeout + R"("/></AchieveCondition>)"
+         + test::CreateWorkspaceXml();
+}
+
+std::string AchieveConditionRunningBody(std::size_t n_leaves)
+{
+  return "<AchieveCondition>" + test::CreateConditionXml(n_leaves, false)
+         + R"(<Wait timeout=")" + kLongTimeout + R"("/></AchieveCondition>)"
+         + test::CreateWorkspaceXml();
+}
+
+std::string AchieveConditionWithTimeoutRunningBody(std::size_t n_leaves)
+{
+  return R"(<AchieveConditionWithTimeout timeout=")" + kLongTimeout + R"(">)"
+         + test::CreateConditionXml(n_leaves, false)
+         + R"(<Copy inputVar="zero" outputVar="live"/></AchieveConditionWithTimeout>)"
+         + test::CreateWorkspaceXml();
+}
+
+std::string AchieveConditionWithOverrideRunningBody(std::size_t n_leaves)
+{
+  return "<AchieveConditionWithOverride>" + test::CreateConditionXml(n_leaves, false)
+         + R"(<Wait timeout=")" + kLongTimeout + R"("/></AchieveConditionWithOverride>)"
+         + test::CreateWorkspaceXml();
+}
+
+std::string ExecuteWhileRunningBody(std::size_t n_leaves,
+                                    const std::string& execution_mode = "async")
+{
+  return R"(<ExecuteWhile executionMode=")" + execution_mode + R"(">)"
+         + R"(<Wait timeout=")" + kLongTimeout + R"("/>)"
+         + test::CreateConditionXml(n_leaves, true) + "</ExecuteWhile>"
+         + test::CreateWorkspaceXml();
+}
+
+std::string ExecuteWhileShortActionBody(const std::string& execution_mode)
+{
+  return R"(<ExecuteWhile executionMode=")" + execution_mode + R"(">)"
+         + R"(<Copy inputVar="zero" outputVar="live"/>)"
+         + test::CreateConditionXml(1, true) + "</ExecuteWhile>"
+         + test::CreateWorkspaceXml();
+}
+
+std::string WaitForConditionRunningBody(std::size_t n_leaves, bool compiled = false)
+{
+  return R"(<WaitForCondition timeout=")" + kLongTimeout + R"(" compileCondition=")"
+         + (compiled ? "true" : "false") + R"(">)"
+         + test::CreateConditionXml(n_leaves, false) + "</WaitForCondition>"
+         + test::CreateWorkspaceXml();
+}
+
+std::string WaitForConditionTimeoutBody(bool event_driven)
+{
+  return R"(<WaitForCondition timeout=")" + kSimulatedTimeout + R"(" eventDriven=")"
+         + (event_driven ? "true" : "false") + R"(">)"
+         + test::CreateConditionXml(1, false) + "</WaitForCondition>"
+         + test::CreateWorkspaceXml();
+}
+
+std::string AchieveConditionWithTimeoutFailureBody()
+{
+  return R"(<AchieveConditionWithTimeout timeout=")" + kSimulatedTimeout + R"(">)"
+         + test::CreateConditionXml(1, false) + kShortAction + "</AchieveConditionWithTimeout>"
+         + test::CreateWorkspaceXml();
+}
+
+std::string SharedConditionRunningBody(std::size_t n_instructions, bool memoized)
+{
+  auto condition = test::CreateConditionXml(1, false);
+  if (memoized)
+  {
+    condition = "<MemoizedCondition>" + condition + "</MemoizedCondition>";
+  }
+  std::string result = "<ParallelSequence>";
+  for (std::size_t idx = 0; idx < n_instructions; ++idx)
+  {
+    result += R"(<WaitForCondition timeout=")" + kLongTimeout + R"(">)" + condition
+              + "</WaitForCondition>";
+  }
+  return result + "</ParallelSequence>" + test::CreateWorkspaceXml();
+}
+
+// Waits for a number of unsatisfied conditions, either with a single multi-condition instruction
+// or with a parallel sequence of WaitForCondition instructions.
+std::string MultiConditionRunningBody(std::size_t n_conditions, bool multi_condition)
+{
+  const auto condition = test::CreateConditionXml(1, false);
+  std::string result = multi_condition
+    ? R"(<WaitForAllConditions timeout=")" + kLongTimeout + R"(">)"
+    : std::string{"<ParallelSequence>"};
+  for (std::size_t idx = 0; idx < n_conditions; ++idx)
+  {
+    result += multi_condition
+      ? condition
+      : R"(<WaitForCondition timeout=")" + kLongTimeout + R"(">)" + condition
+        + "</WaitForCondition>";
+  }
+  result += multi_condition ? "</WaitForAllConditions>" : "</ParallelSequence>";
+  return result + test::CreateWorkspaceXml();
+}
+
+// Sequence of many control instructions, as in large procedures that are reloaded often.
+std::string ManyInstructionsBody(std::size_t n_instructions, const std::string& instruction_xml)
+{
+  std::string result = "<Sequence>";
+  for (std::size_t idx = 0; idx < n_instructions; ++idx)
+  {
+    result += instruction_xml;
+  }
+  return result + "</Sequence>" + test::CreateWorkspaceXml();
+}
+
+// Fallback whose first branch succeeds, so that the control instructions in the other branches
+// are set up, but never executed.
+std::string DormantInstructionsBody(std::size_t n_instructions, bool lazy_setup)
+{
+  const std::string lazy_attribute = lazy_setup ? R"( lazySetup="true")" : "";
+  const auto condition = test::CreateConditionXml(1, true);
+  const std::vector<std::string> instructions = {
+    "<AchieveCondition" + lazy_attribute + ">" + condition + kShortAction + "</AchieveCondition>",
+    R"(<AchieveConditionWithTimeout timeout="1.0")" + lazy_attribute + ">" + condition
+      + kShortAction + "</AchieveConditionWithTimeout>",
+    "<ExecuteWhile" + lazy_attribute + ">" + kShortAction + condition + "</ExecuteWhile>",
+    R"(<WaitForCondition timeout="1.0")" + lazy_attribute + ">" + condition
+      + "</WaitForCondition>"
+  };
+  std::string result = "<Fallback><Succeed/>";
+  for (std::size_t idx = 0; idx < n_instructions; ++idx)
+  {
+    result += instructions[idx % instructions.size()];
+  }
+  return result + "</Fallback>" + test::CreateWorkspaceXml();
+}
+
+std::string ArrayXml(std::size_t n_elements, bool satisfied)
+{
+  std::string result = "[";
+  for (std::size_t idx = 0; idx + 1u < n_elements; ++idx)
+  {
+    result += "1,";
+  }
+  return result + (satisfied ? "1]" : "0]");
+}
+
+// Waits for all elements of an array to be one. Only the last element is zero, so every tick
+// needs to compare all elements.
+std::string ArrayWaitRunningBody(std::size_t n_elements, bool array_condition)
+{
+  const std::string array_type = R"({"type":"uint32_array","multiplicity":)"
+                                 + std::to_string(n_elements) + R"(,"element":{"type":"uint32"}})";
+  const std::string condition =
+    array_condition ? R"(<ArrayCondition varName="statuses" referenceVar="one"/>)"
+                    : R"(<Equals leftVar="statuses" rightVar="expected"/>)";
+  return R"(<WaitForCondition timeout=")" + kLongTimeout + R"(">)" + condition
+         + "</WaitForCondition>"
+         + R"(<Workspace><Local name="statuses" type=')" + array_type + R"(' value=')"
+         + ArrayXml(n_elements, false) + R"('/><Local name="expected" type=')" + array_type
+         + R"(' value=')" + ArrayXml(n_elements, true)
+         + R"('/><Local name="one" type='{"type":"uint32"}' value='1'/></Workspace>)";
+}
+}  // unnamed namespace
+
+// Per tick cost
+
+static void BM_AchieveConditionDirectSuccessTick(benchmark::State& state)
+{
+  test::RunTickBenchmark(state, AchieveConditionSuccessBody(ConditionSize(state)));
+}
+BENCHMARK(BM_AchieveConditionDirectSuccessTick)->RangeMultiplier(8)->Range(1, 64);
+
+static void BM_AchieveConditionRunningActionTick(benchmark::State& state)
+{
+  test::RunTickBenchmark(state, AchieveConditionRunningBody(ConditionSize(state)));
+}
+BENCHMARK(BM_AchieveConditionRunningActionTick)->RangeMultiplier(8)->Range(1, 64);
+
+static void BM_AchieveConditionWithTimeoutRunningTick(benchmark::State& state)
+{
+  test::RunTickBenchmark(state, AchieveConditionWithTimeoutRunningBody(ConditionSize(state)));
+}
+BENCHMARK(BM_AchieveConditionWithTimeoutRunningTick)->RangeMultiplier(8)->Range(1, 64);
+
+static void BM_AchieveConditionWithOverrideRunningActionTick(benchmark::State& state)
+{
+  test::RunTickBenchmark(state, AchieveConditionWithOverrideRunningBody(ConditionSize(state)));
+}
+BENCHMARK(BM_AchieveConditionWithOverrideRunningActionTick)->RangeMultiplier(8)->Range(1, 64);
+
+static void BM_ExecuteWhileRunningTick(benchmark::State& state)
+{
+  test::RunTickBenchmark(state, ExecuteWhileRunningBody(ConditionSize(state)));
+}
+BENCHMARK(BM_ExecuteWhileRunningTick)->RangeMultiplier(8)->Range(1, 64);
+
+static void BM_ExecuteWhileInterleavedRunningTick(benchmark::State& state)
+{
+  test::RunTickBenchmark(state, ExecuteWhileRunningBody(ConditionSize(state), "interleaved"));
+}
+BENCHMARK(BM_ExecuteWhileInterleavedRunningTick)->RangeMultiplier(8)->Range(1, 64);
+
+static void BM_WaitForConditionRunningTick(benchmark::State& state)
+{
+  test::RunTickBenchmark(state, WaitForConditionRunningBody(ConditionSize(state)));
+}
+BENCHMARK(BM_WaitForConditionRunningTick)->RangeMultiplier(8)->Range(1, 64);
+
+static void BM_WaitForConditionCompiledRunningTick(benchmark::State& state)
+{
+  test::RunTickBenchmark(state, WaitForConditionRunningBody(ConditionSize(state), true));
+}
+BENCHMARK(BM_WaitForConditionCompiledRunningTick)->RangeMultiplier(8)->Range(1, 64);
+
+static void BM_ParallelWaitForConditionRunningTick(benchmark::State& state)
+{
+  test::RunTickBenchmark(state, MultiConditionRunningBody(ConditionSize(state), false));
+}
+BENCHMARK(BM_ParallelWaitForConditionRunningTick)->RangeMultiplier(8)->Range(1, 512);
+
+static void BM_WaitForAllConditionsRunningTick(benchmark::State& state)
+{
+  test::RunTickBenchmark(state, MultiConditionRunningBody(ConditionSize(state), true));
+}
+BENCHMARK(BM_WaitForAllConditionsRunningTick)->RangeMultiplier(8)->Range(1, 512);
+
+static void BM_ArrayEqualsRunningTick(benchmark::State& state)
+{
+  test::RunTickBenchmark(state, ArrayWaitRunningBody(ConditionSize(state), false));
+}
+BENCHMARK(BM_ArrayEqualsRunningTick)->RangeMultiplier(16)->Range(16, 1 << 20);
+
+static void BM_ArrayConditionRunningTick(benchmark::State& state)
+{
+  test::RunTickBenchmark(state, ArrayWaitRunningBody(ConditionSize(state), true));
+}
+BENCHMARK(BM_ArrayConditionRunningTick)->RangeMultiplier(16)->Range(16, 1 << 20);
+
+static void BM_CountArrayMatches(benchmark::State& state)
+{
+  std::vector<double> values(ConditionSize(state), 1.0);
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(CountArrayMatches(values.data(), values.size(),
+                                               ArrayComparison::kEqual, 1.0, true, 1));
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(values.size()));
+}
+BENCHMARK(BM_CountArrayMatches)->RangeMultiplier(16)->Range(16, 1 << 20);
+
+static void BM_SharedConditionRunningTick(benchmark::State& state)
+{
+  test::RunTickBenchmark(state, SharedConditionRunningBody(ConditionSize(state), false));
+}
+BENCHMARK(BM_SharedConditionRunningTick)->RangeMultiplier(8)->Range(1, 64);
+
+static void BM_SharedMemoizedConditionRunningTick(benchmark::State& state)
+{
+  test::RunTickBenchmark(state, SharedConditionRunningBody(ConditionSize(state), true));
+}
+BENCHMARK(BM_SharedMemoizedConditionRunningTick)->RangeMultiplier(8)->Range(1, 64);
+
+// Complete execution cost
+
+static void BM_ExecuteWhileAsyncExecution(benchmark::State& state)
+{
+  test::RunExecutionBenchmark(state, ExecuteWhileShortActionBody("async"));
+}
+BENCHMARK(BM_ExecuteWhileAsyncExecution);
+
+static void BM_ExecuteWhileWorkerPoolExecution(benchmark::State& state)
+{
+  auto& pool = GetControlWorkerPool();
+  auto metrics_before = pool.GetMetrics();
+  test::RunExecutionBenchmark(state, ExecuteWhileShortActionBody("workerPool"));
+  auto metrics_after = pool.GetMetrics();
+  auto n_tasks = metrics_after.m_completed - metrics_before.m_completed;
+  auto latency = std::chrono::duration_cast<std::chrono::nanoseconds>(
+    metrics_after.m_total_dispatch_latency - metrics_before.m_total_dispatch_latency);
+  state.counters["dispatch_ns/task"] = n_tasks > 0
+    ? static_cast<double>(latency.count()) / static_cast<double>(n_tasks) : 0.0;
+  state.counters["max_queue_depth"] = static_cast<double>(metrics_after.m_max_queue_depth);
+}
+BENCHMARK(BM_ExecuteWhileWorkerPoolExecution);
+
+static void BM_ExecuteWhileInterleavedExecution(benchmark::State& state)
+{
+  test::RunExecutionBenchmark(state, ExecuteWhileShortActionBody("interleaved"));
+}
+BENCHMARK(BM_ExecuteWhileInterleavedExecution);
+
+// Complete execution cost of timeouts in simulated time: the argument is the poll period in
+// seconds
+
+static void BM_WaitForConditionSimulatedTimeout(benchmark::State& state)
+{
+  test::RunSimulatedTimeBenchmark(state, WaitForConditionTimeoutBody(false),
+                                  std::chrono::seconds(state.range(0)));
+}
+BENCHMARK(BM_WaitForConditionSimulatedTimeout)->RangeMultiplier(10)->Range(10, 1000)
+  ->Unit(benchmark::kMillisecond);
+
+static void BM_WaitForConditionEventDrivenSimulatedTimeout(benchmark::State& state)
+{
+  test::RunSimulatedTimeBenchmark(state, WaitForConditionTimeoutBody(true),
+                                  std::chrono::seconds(state.range(0)));
+}
+BENCHMARK(BM_WaitForConditionEventDrivenSimulatedTimeout)->RangeMultiplier(10)->Range(10, 1000)
+  ->Unit(benchmark::kMillisecond);
+
+static void BM_AchieveConditionWithTimeoutSimulatedTimeout(benchmark::State& state)
+{
+  test::RunSimulatedTimeBenchmark(state, AchieveConditionWithTimeoutFailureBody(),
+                                  std::chrono::seconds(state.range(0)));
+}
+BENCHMARK(BM_AchieveConditionWithTimeoutSimulatedTimeout)->RangeMultiplier(10)->Range(10, 1000)
+  ->Unit(benchmark::kMillisecond);
+
+// Setup cost
+
+static void BM_AchieveConditionSetup(benchmark::State& state)
+{
+  test::RunSetupBenchmark(state, AchieveConditionRunningBody(ConditionSize(state)));
+}
+BENCHMARK(BM_AchieveConditionSetup)->RangeMultiplier(8)->Range(1, 64);
+
+static void BM_AchieveConditionWithTimeoutSetup(benchmark::State& state)
+{
+  test::RunSetupBenchmark(state, AchieveConditionWithTimeoutRunningBody(ConditionSize(state)));
+}
+BENCHMARK(BM_AchieveConditionWithTimeoutSetup)->RangeMultiplier(8)->Range(1, 64);
+
+static void BM_AchieveConditionWithOverrideSetup(benchmark::State& state)
+{
+  test::RunSetupBenchmark(state, AchieveConditionWithOverrideRunningBody(ConditionSize(state)));
+}
+BENCHMARK(BM_AchieveConditionWithOverrideSetup)->RangeMultiplier(8)->Range(1, 64);
+
+static void BM_ExecuteWhileSetup(benchmark::State& state)
+{
+  test::RunSetupBenchmark(state, ExecuteWhileRunningBody(ConditionSize(state)));
+}
+BENCHMARK(BM_ExecuteWhileSetup)->RangeMultiplier(8)->Range(1, 64);
+
+static void BM_WaitForConditionSetup(benchmark::State& state)
+{
+  test::RunSetupBenchmark(state, WaitForConditionRunningBody(ConditionSize(state)));
+}
+BENCHMARK(BM_WaitForConditionSetup)->RangeMultiplier(8)->Range(1, 64);
+
+static void BM_ManyAchieveConditionSetup(benchmark::State& state)
+{
+  const auto instruction_xml = "<AchieveCondition>" + test::CreateConditionXml(1, true)
+                               + kShortAction + "</AchieveCondition>";
+  test::RunSetupBenchmark(state, ManyInstructionsBody(ConditionSize(state), instruction_xml));
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ManyAchieveConditionSetup)->Arg(10000)->Unit(benchmark::kMillisecond);
+
+static void BM_ManyExecuteWhileSetup(benchmark::State& state)
+{
+  const auto instruction_xml = "<ExecuteWhile>" + kShortAction
+                               + test::CreateConditionXml(1, true) + "</ExecuteWhile>";
+  test::RunSetupBenchmark(state, ManyInstructionsBody(ConditionSize(state), instruction_xml));
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ManyExecuteWhileSetup)->Arg(10000)->Unit(benchmark::kMillisecond);
+
+static void BM_DormantInstructionsSetup(benchmark::State& state)
+{
+  test::RunSetupBenchmark(state, DormantInstructionsBody(ConditionSize(state), false));
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_DormantInstructionsSetup)->Arg(5000)->Unit(benchmark::kMillisecond);
+
+static void BM_DormantLazyInstructionsSetup(benchmark::State& state)
+{
+  test::RunSetupBenchmark(state, DormantInstructionsBody(ConditionSize(state), true));
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_DormantLazyInstructionsSetup)->Arg(5000)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,110 @@
+/******************************************************************************
+* $HeadURL: $
+* $Id: $
+*
+* Project       : Supervision and Automation - oac-tree
+*
+* Description   : SUP oac-tree control plugin
+*
+* Author        : Walter Van Herck (IO)
+*
+* Copyright (c) : 2010-2026 ITER Organization,
+*                 CS 90 046
+*                 13067 St. Paul-lez-Durance Cedex
+*                 France
+* SPDX-License-Identifier: MIT
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file LICENSE located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+#include "allocation_counter.h"
+
+#include "oac-tree/control/wrapped_user_interface.h"
+
+#include <sup/oac-tree/log_severity.h>
+#include <sup/oac-tree/user_interface.h>
+
+#include <benchmark/benchmark.h>
+
+using namespace sup::oac_tree;
+
+namespace
+{
+const std::string kLogPrefix =
+  "Forwarded log message from internal instruction of AchieveConditionWithTimeout: ";
+const std::string kLogMessage = "Instruction Equals: variable [live] could not be read";
+
+/**
+ * @brief User interface sink that only counts received characters, to prevent the compiler from
+ * optimizing the forwarding away.
+ */
+class CountingLogInterface : public DefaultUserInterface
+{
+public:
+  CountingLogInterface() : m_characters{0} {}
+  ~CountingLogInterface() override = default;
+
+  void Log(int severity, const std::string& message) override
+  {
+    (void)severity;
+    m_characters += message.size();
+  }
+
+  std::size_t m_characters;
+};
+
+/**
+ * @brief Log forwarding as implemented before: a new string is built for every message.
+ */
+class ConcatenatingUserInterface : public DefaultUserInterface
+{
+public:
+  ConcatenatingUserInterface(UserInterface& ui, const std::string& prefix)
+    : m_ui{ui}, m_prefix{prefix}
+  {}
+  ~ConcatenatingUserInterface() override = default;
+
+  void Log(int severity, const std::string& message) override
+  {
+    std::string wrapped_message = m_prefix + message;
+    m_ui.Log(severity, wrapped_message);
+  }
+
+private:
+  UserInterface& m_ui;
+  std::string m_prefix;
+};
+
+void RunLogForwardingBenchmark(benchmark::State& state, UserInterface& forwarding_ui,
+                               const CountingLogInterface& sink)
+{
+  test::AllocationCounter counter;
+  for (auto _ : state)
+  {
+    forwarding_ui.Log(log::SUP_SEQ_LOG_WARNING, kLogMessage);
+  }
+  benchmark::DoNotOptimize(sink.m_characters);
+  state.SetItemsProcessed(state.iterations());
+  state.counters["allocs/msg"] = benchmark::Counter(static_cast<double>(counter.Allocations()),
+                                                    benchmark::Counter::kAvgIterations);
+}
+}  // unnamed namespace
+
+static void BM_LogForwardingConcatenate(benchmark::State& state)
+{
+  CountingLogInterface sink;
+  ConcatenatingUserInterface forwarding_ui{sink, kLogPrefix};
+  RunLogForwardingBenchmark(state, forwarding_ui, sink);
+}
+BENCHMARK(BM_LogForwardingConcatenate);
+
+static void BM_LogForwardingWrappedUserInterface(benchmark::State& state)
+{
+  CountingLogInterface sink;
+  WrappedUserInterface forwarding_ui{sink, kLogPrefix};
+  RunLogForwardingBenchmark(state, forwarding_ui, sink);
+}
+BENCHMARK(BM_LogForwardingWrappedUserInterface);
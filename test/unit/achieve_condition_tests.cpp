@@ -20,14 +20,20 @@
 * of the distribution package.
 ******************************************************************************/
 
+#include "test_instructions.h"
 #include "test_user_interface.h"
 #include "unit_test_helper.h"
 
 #include <sup/oac-tree/instruction_registry.h>
 #include <sup/oac-tree/sequence_parser.h>
 
+#include <sup/dto/anyvalue.h>
+
 #include <gtest/gtest.h>
 
+#include <utility>
+#include <vector>
+
 using namespace sup::oac_tree;
 
 class AchieveConditionTest : public ::testing::Test
@@ -35,8 +41,29 @@ class AchieveConditionTest : public ::testing::Test
 protected:
   AchieveConditionTest() = default;
   virtual ~AchieveConditionTest() = default;
+
+  struct ExecutionTrace
+  {
+    std::vector<ExecutionStatus> m_statuses;
+    sup::dto::AnyValue m_live;
+  };
+
+  static std::string CreateBody(const std::string& execution_mode, const std::string& condition,
+                                const std::string& action);
+  static ExecutionTrace ExecuteAndTrace(const std::string& body);
 };
 
+namespace
+{
+const std::string kWorkspace{R"(
+    <Workspace>
+        <Local name="live" type='{"type":"uint64"}' value='0' />
+        <Local name="zero" type='{"type":"uint64"}' value='0' />
+        <Local name="one" type='{"type":"uint64"}' value='1' />
+    </Workspace>
+)"};
+}
+
 TEST_F(AchieveConditionTest, DirectSuccess)
 {
   const std::string body{R"(
@@ -210,3 +237,305 @@ TEST_F(AchieveConditionTest, Setup)
     EXPECT_THROW(proc->Setup(), InstructionSetupException);
   }
 }
+
+TEST_F(AchieveConditionTest, NativeSuccessAfterAction)
+{
+  const std::string body{R"(
+    <AchieveCondition executionMode="native">
+        <Equals leftVar="live" rightVar="one"/>
+        <Copy inputVar="one" outputVar="live"/>
+    </AchieveCondition>
+    <Workspace>
+        <Local name="live" type='{"type":"uint64"}' value='0' />
+        <Local name="one" type='{"type":"uint64"}' value='1' />
+    </Workspace>
+)"};
+
+  test::NullUserInterface ui;
+  auto proc = ParseProcedureString(test::CreateProcedureString(body));
+  EXPECT_TRUE(test::TryAndExecute(proc, ui));
+}
+
+TEST_F(AchieveConditionTest, NativeHalt)
+{
+  const std::string body{R"(
+    <ParallelSequence>
+        <Fail timeout="0.1"/>
+        <AchieveCondition executionMode="native">
+            <Equals leftVar="live" rightVar="one"/>
+            <Wait timeout="1.0"/>
+        </AchieveCondition>
+    </ParallelSequence>
+    <Workspace>
+        <Local name="live" type='{"type":"uint64"}' value='0' />
+        <Local name="one" type='{"type":"uint64"}' value='1' />
+    </Workspace>
+)"};
+
+  test::NullUserInterface ui;
+  auto proc = ParseProcedureString(test::CreateProcedureString(body));
+  EXPECT_TRUE(test::TryAndExecute(proc, ui, ExecutionStatus::FAILURE));
+}
+
+TEST_F(AchieveConditionTest, NativeInterruptsAction)
+{
+  const std::string body{R"(
+    <ParallelSequence>
+        <AchieveCondition executionMode="native">
+            <Equals leftVar="live" rightVar="one"/>
+            <Wait timeout="2.0"/>
+        </AchieveCondition>
+        <Sequence>
+            <Wait timeout="0.2"/>
+            <Copy inputVar="one" outputVar="live"/>
+        </Sequence>
+    </ParallelSequence>
+    <Workspace>
+        <Local name="live" type='{"type":"uint64"}' value='0' />
+        <Local name="one" type='{"type":"uint64"}' value='1' />
+    </Workspace>
+)"};
+
+  test::NullUserInterface ui;
+  auto proc = ParseProcedureString(test::CreateProcedureString(body));
+  EXPECT_TRUE(test::TryAndExecute(proc, ui));
+}
+
+TEST_F(AchieveConditionTest, NativeSetup)
+{
+  {
+    // One child
+    const std::string body{R"(
+      <AchieveCondition executionMode="native">
+          <Wait timeout="1.0"/>
+      </AchieveCondition>
+      <Workspace/>)"};
+
+    auto proc = ParseProcedureString(test::CreateProcedureString(body));
+    EXPECT_THROW(proc->Setup(), InstructionSetupException);
+  }
+  {
+    // Unknown execution mode
+    const std::string body{R"(
+      <AchieveCondition executionMode="unknown">
+          <Wait/>
+          <Wait/>
+      </AchieveCondition>
+      <Workspace/>)"};
+
+    auto proc = ParseProcedureString(test::CreateProcedureString(body));
+    EXPECT_THROW(proc->Setup(), InstructionSetupException);
+  }
+}
+
+TEST_F(AchieveConditionTest, NativeCompatibility)
+{
+  // Pairs of condition and action, covering immediate success, success and failure after
+  // (compound) actions and compound conditions that take multiple ticks.
+  const std::vector<std::pair<std::string, std::string>> scenarios{
+    { R"(<Equals leftVar="live" rightVar="zero"/>)",
+      R"(<Copy inputVar="one" outputVar="live"/>)" },
+    { R"(<Equals leftVar="live" rightVar="one"/>)",
+      R"(<Copy inputVar="one" outputVar="live"/>)" },
+    { R"(<Equals leftVar="live" rightVar="one"/>)",
+      R"(<Copy inputVar="zero" outputVar="live"/>)" },
+    { R"(<Equals leftVar="live" rightVar="one"/>)",
+      R"(<Inverter><Copy inputVar="one" outputVar="live"/></Inverter>)" },
+    { R"(<Sequence><Wait/><Wait/><Equals leftVar="live" rightVar="one"/></Sequence>)",
+      R"(<Sequence><Wait/><Wait/><Copy inputVar="one" outputVar="live"/></Sequence>)" },
+    { R"(<Sequence><Wait/><Wait/><Equals leftVar="live" rightVar="one"/></Sequence>)",
+      R"(<Sequence><Wait/><Wait/><Copy inputVar="zero" outputVar="live"/></Sequence>)" },
+    { R"(<Fallback><Equals leftVar="live" rightVar="one"/><Wait/></Fallback>)",
+      R"(<Copy inputVar="zero" outputVar="live"/>)" }
+  };
+  for (const auto& [condition, action] : scenarios)
+  {
+    auto composed_trace = ExecuteAndTrace(CreateBody("composed", condition, action));
+    auto native_trace = ExecuteAndTrace(CreateBody("native", condition, action));
+    EXPECT_EQ(native_trace.m_statuses, composed_trace.m_statuses)
+      << "Condition: " << condition << ", action: " << action;
+    EXPECT_EQ(native_trace.m_live, composed_trace.m_live)
+      << "Condition: " << condition << ", action: " << action;
+  }
+}
+
+TEST_F(AchieveConditionTest, NoConditionCopies)
+{
+  // The number of condition instances may not grow during Setup, independent of the size of the
+  // condition tree.
+  for (std::size_t n_leaves : { 1u, 16u })
+  {
+    std::string condition = "<Sequence>";
+    for (std::size_t idx = 0; idx < n_leaves; ++idx)
+    {
+      condition += R"(<CountingCondition varName="one"/>)";
+    }
+    condition += "</Sequence>";
+    auto body = CreateBody("composed", condition, R"(<Copy inputVar="one" outputVar="live"/>)");
+    auto proc = ParseProcedureString(test::CreateProcedureString(body));
+    ASSERT_TRUE(proc);
+    auto n_instances = test::CountingCondition::GetInstanceCount();
+    ASSERT_GE(n_instances, n_leaves);
+    proc->Setup();
+    EXPECT_EQ(test::CountingCondition::GetInstanceCount(), n_instances);
+  }
+}
+
+TEST_F(AchieveConditionTest, RecheckWithoutClone)
+{
+  // Condition is evaluated once before and once after the action
+  const std::string body{R"(
+    <AchieveCondition>
+        <CountingCondition varName="live"/>
+        <Copy inputVar="zero" outputVar="live"/>
+    </AchieveCondition>
+    <Workspace>
+        <Local name="live" type='{"type":"uint64"}' value='0' />
+        <Local name="zero" type='{"type":"uint64"}' value='0' />
+    </Workspace>
+)"};
+
+  test::NullUserInterface ui;
+  test::CountingCondition::ResetExecutionCount();
+  auto proc = ParseProcedureString(test::CreateProcedureString(body));
+  EXPECT_TRUE(test::TryAndExecute(proc, ui, ExecutionStatus::FAILURE));
+  EXPECT_EQ(test::CountingCondition::GetExecutionCount(), 2);
+}
+
+std::string AchieveConditionTest::CreateBody(const std::string& execution_mode,
+                                             const std::string& condition,
+                                             const std::string& action)
+{
+  return R"(<AchieveCondition executionMode=")" + execution_mode + R"(">)" + condition + action
+         + "</AchieveCondition>" + kWorkspace;
+}
+
+AchieveConditionTest::ExecutionTrace AchieveConditionTest::ExecuteAndTrace(
+  const std::string& body)
+{
+  const std::size_t kMaxTicks = 100;
+  ExecutionTrace trace;
+  test::NullUserInterface ui;
+  auto proc = ParseProcedureString(test::CreateProcedureString(body));
+  EXPECT_TRUE(proc);
+  if (!proc)
+  {
+    return trace;
+  }
+  proc->Setup();
+  while (!IsFinishedStatus(proc->GetStatus()) && trace.m_statuses.size() < kMaxTicks)
+  {
+    proc->ExecuteSingle(ui);
+    trace.m_statuses.push_back(proc->GetStatus());
+  }
+  EXPECT_TRUE(proc->GetVariableValue("live", trace.m_live));
+  proc->Reset(ui);
+  return trace;
+}
+
+TEST_F(AchieveConditionTest, StableCountDirectSuccess)
+{
+  // The action is not started while the successful condition settles
+  const std::string body{R"(
+    <Sequence>
+        <AchieveCondition stableCount="3">
+            <CountingCondition varName="live"/>
+            <Copy inputVar="one" outputVar="action_done"/>
+        </AchieveCondition>
+        <Equals leftVar="action_done" rightVar="zero"/>
+    </Sequence>
+    <Workspace>
+        <Local name="live" type='{"type":"uint64"}' value='1' />
+        <Local name="zero" type='{"type":"uint64"}' value='0' />
+        <Local name="one" type='{"type":"uint64"}' value='1' />
+        <Local name="action_done" type='{"type":"uint64"}' value='0' />
+    </Workspace>
+)"};
+
+  test::NullUserInterface ui;
+  test::CountingCondition::ResetExecutionCount();
+  auto proc = ParseProcedureString(test::CreateProcedureString(body));
+  EXPECT_TRUE(test::TryAndExecute(proc, ui));
+  EXPECT_EQ(test::CountingCondition::GetExecutionCount(), 3);
+}
+
+TEST_F(AchieveConditionTest, StableCountSuccessAfterAction)
+{
+  // The re-check after the action waits for the condition to become stable
+  const std::string body{R"(
+    <AchieveCondition stableCount="2">
+        <CountingCondition varName="live"/>
+        <Copy inputVar="one" outputVar="live"/>
+    </AchieveCondition>
+    <Workspace>
+        <Local name="live" type='{"type":"uint64"}' value='0' />
+        <Local name="one" type='{"type":"uint64"}' value='1' />
+    </Workspace>
+)"};
+
+  test::NullUserInterface ui;
+  test::CountingCondition::ResetExecutionCount();
+  auto proc = ParseProcedureString(test::CreateProcedureString(body));
+  EXPECT_TRUE(test::TryAndExecute(proc, ui));
+  // Two failing evaluations before the action and two successful ones after it
+  EXPECT_EQ(test::CountingCondition::GetExecutionCount(), 4);
+}
+
+TEST_F(AchieveConditionTest, StableForFailAfterAction)
+{
+  const std::string body{R"(
+    <AchieveCondition stableFor="0.05">
+        <Equals leftVar="live" rightVar="one"/>
+        <Copy inputVar="zero" outputVar="live"/>
+    </AchieveCondition>
+    <Workspace>
+        <Local name="live" type='{"type":"uint64"}' value='0' />
+        <Local name="zero" type='{"type":"uint64"}' value='0' />
+        <Local name="one" type='{"type":"uint64"}' value='1' />
+    </Workspace>
+)"};
+
+  test::NullUserInterface ui;
+  auto proc = ParseProcedureString(test::CreateProcedureString(body));
+  EXPECT_TRUE(test::TryAndExecute(proc, ui, ExecutionStatus::FAILURE));
+}
+
+TEST_F(AchieveConditionTest, StableSetup)
+{
+  {
+    // Debouncing is not supported in composed mode
+    const std::string body{R"(
+      <AchieveCondition executionMode="composed" stableCount="2">
+          <Wait/>
+          <Wait/>
+      </AchieveCondition>
+      <Workspace/>)"};
+
+    auto proc = ParseProcedureString(test::CreateProcedureString(body));
+    EXPECT_THROW(proc->Setup(), InstructionSetupException);
+  }
+  {
+    // Negative duration
+    const std::string body{R"(
+      <AchieveCondition stableFor="-1.0">
+          <Wait/>
+          <Wait/>
+      </AchieveCondition>
+      <Workspace/>)"};
+
+    auto proc = ParseProcedureString(test::CreateProcedureString(body));
+    EXPECT_THROW(proc->Setup(), InstructionSetupException);
+  }
+  {
+    // A stable count of one does not require debouncing
+    const std::string body{R"(
+      <AchieveCondition executionMode="composed" stableCount="1">
+          <Wait/>
+          <Wait/>
+      </AchieveCondition>
+      <Workspace/>)"};
+
+    auto proc = ParseProcedureString(test::CreateProcedureString(body));
+    EXPECT_NO_THROW(proc->Setup());
+  }
+}
@@ -20,11 +20,14 @@
 * of the distribution package.
 ******************************************************************************/
 
+#include "allocation_counter.h"
+#include "test_instructions.h"
 #include "test_user_interface.h"
 #include "unit_test_helper.h"
 
 #include <sup/oac-tree/instruction_registry.h>
 #include <sup/oac-tree/sequence_parser.h>
+#include <sup/oac-tree/workspace.h>
 
 #include <gtest/gtest.h>
 
@@ -381,3 +384,35 @@ TEST_F(AchieveConditionWithOverrideTest, VariableDialogTextNotPresent)
   EXPECT_TRUE(test::TryAndExecute(proc, ui, ExecutionStatus::FAILURE));
 }
 
+
+TEST_F(AchieveConditionWithOverrideTest, SteadyStateTickWithoutAllocation)
+{
+  auto instr = GlobalInstructionRegistry().Create("AchieveConditionWithOverride");
+  auto condition = GlobalInstructionRegistry().Create(test::CountingCondition::Type);
+  auto action = GlobalInstructionRegistry().Create(test::RunningAction::Type);
+  ASSERT_TRUE(instr);
+  ASSERT_TRUE(condition);
+  ASSERT_TRUE(action);
+  ASSERT_TRUE(condition->AddAttribute("varName", "live"));
+  ASSERT_TRUE(instr->InsertInstruction(std::move(condition), 0));
+  ASSERT_TRUE(instr->InsertInstruction(std::move(action), 1));
+  Procedure proc;
+  ASSERT_NO_THROW(instr->Setup(proc));
+
+  // Condition fails, since the variable is not present in the workspace, and the action is
+  // running from the second tick on.
+  test::NullUserInterface ui;
+  Workspace ws;
+  instr->ExecuteSingle(ui, ws);
+  instr->ExecuteSingle(ui, ws);
+  EXPECT_EQ(instr->GetStatus(), ExecutionStatus::RUNNING);
+
+  test::AllocationCounter counter{test::AllocationCounter::kCurrentThread};
+  for (int i = 0; i < 100; ++i)
+  {
+    instr->ExecuteSingle(ui, ws);
+  }
+  EXPECT_EQ(counter.Allocations(), 0);
+  EXPECT_EQ(instr->GetStatus(), ExecutionStatus::RUNNING);
+  instr->Reset(ui);
+}
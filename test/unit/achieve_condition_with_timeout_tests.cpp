@@ -20,11 +20,16 @@
 * of the distribution package.
 ******************************************************************************/
 
+#include "test_instructions.h"
 #include "test_user_interface.h"
 #include "unit_test_helper.h"
 
+#include "oac-tree/control/achieve_condition_with_timeout_instruction.h"
+#include "oac-tree/control/control_clock.h"
+
 #include <sup/oac-tree/instruction_registry.h>
 #include <sup/oac-tree/sequence_parser.h>
+#include <sup/oac-tree/workspace.h>
 
 #include <gtest/gtest.h>
 
@@ -162,13 +167,34 @@ TEST_F(AchieveConditionWithTimeoutTest, SuccessWithinTimeout)
 TEST_F(AchieveConditionWithTimeoutTest, FailAfterTimeout)
 {
   const std::string body{R"(
-    <AchieveConditionWithTimeout timeout="0.5">
+    <AchieveConditionWithTimeout timeout="60.0">
+        <Equals leftVar="live" rightVar="one"/>
+        <Succeed/>
+    </AchieveConditionWithTimeout>
+    <Workspace>
+        <Local name="live" type='{"type":"uint64"}' value='0' />
+        <Local name="one" type='{"type":"uint64"}' value='1' />
+    </Workspace>
+)"};
+
+  ManualControlClock clock;
+  ScopedControlClock scoped_clock{clock};
+  test::NullUserInterface ui;
+  auto proc = ParseProcedureString(test::CreateProcedureString(body));
+  EXPECT_TRUE(test::TryAndExecute(proc, ui, ExecutionStatus::FAILURE));
+}
+
+TEST_F(AchieveConditionWithTimeoutTest, VariableTimeout)
+{
+  const std::string body{R"(
+    <AchieveConditionWithTimeout timeout="@timeout">
         <Equals leftVar="live" rightVar="one"/>
         <Wait timeout="0.1"/>
     </AchieveConditionWithTimeout>
     <Workspace>
         <Local name="live" type='{"type":"uint64"}' value='0' />
         <Local name="one" type='{"type":"uint64"}' value='1' />
+        <Local name="timeout" type='{"type":"float64"}' value='0.2' />
     </Workspace>
 )"};
 
@@ -176,3 +202,65 @@ TEST_F(AchieveConditionWithTimeoutTest, FailAfterTimeout)
   auto proc = ParseProcedureString(test::CreateProcedureString(body));
   EXPECT_TRUE(test::TryAndExecute(proc, ui, ExecutionStatus::FAILURE));
 }
+
+TEST_F(AchieveConditionWithTimeoutTest, TimeRemaining)
+{
+  AchieveConditionWithTimeoutInstruction instr;
+  auto condition = GlobalInstructionRegistry().Create(test::CountingCondition::Type);
+  auto action = GlobalInstructionRegistry().Create("Succeed");
+  ASSERT_TRUE(condition);
+  ASSERT_TRUE(action);
+  ASSERT_TRUE(condition->AddAttribute("varName", "live"));
+  ASSERT_TRUE(instr.InsertInstruction(std::move(condition), 0));
+  ASSERT_TRUE(instr.InsertInstruction(std::move(action), 1));
+  ASSERT_TRUE(instr.AddAttribute("timeout", "10.0"));
+  Procedure proc;
+  ASSERT_NO_THROW(instr.Setup(proc));
+  EXPECT_EQ(instr.GetTimeRemaining(), std::chrono::steady_clock::duration::zero());
+
+  // Condition fails, since the variable is not present in the workspace. The timeout starts after
+  // the action succeeded.
+  test::NullUserInterface ui;
+  Workspace ws;
+  for (int i = 0; i < 3; ++i)
+  {
+    instr.ExecuteSingle(ui, ws);
+  }
+  EXPECT_EQ(instr.GetStatus(), ExecutionStatus::RUNNING);
+  EXPECT_GT(instr.GetTimeRemaining(), std::chrono::seconds(9));
+  EXPECT_LE(instr.GetTimeRemaining(), std::chrono::seconds(10));
+
+  instr.Halt(ui);
+  instr.Reset(ui);
+  EXPECT_EQ(instr.GetTimeRemaining(), std::chrono::steady_clock::duration::zero());
+}
+
+TEST_F(AchieveConditionWithTimeoutTest, TimeoutCount)
+{
+  for (const std::string timeout : {"0.0", "@missing"})
+  {
+    AchieveConditionWithTimeoutInstruction instr;
+    auto condition = GlobalInstructionRegistry().Create(test::CountingCondition::Type);
+    auto action = GlobalInstructionRegistry().Create("Succeed");
+    ASSERT_TRUE(condition);
+    ASSERT_TRUE(action);
+    ASSERT_TRUE(condition->AddAttribute("varName", "live"));
+    ASSERT_TRUE(instr.InsertInstruction(std::move(condition), 0));
+    ASSERT_TRUE(instr.InsertInstruction(std::move(action), 1));
+    ASSERT_TRUE(instr.AddAttribute("timeout", timeout));
+    Procedure proc;
+    ASSERT_NO_THROW(instr.Setup(proc));
+
+    // Condition fails, since the variable is not present in the workspace
+    test::NullUserInterface ui;
+    Workspace ws;
+    for (int i = 0; i < 10 && !IsFinishedStatus(instr.GetStatus()); ++i)
+    {
+      instr.ExecuteSingle(ui, ws);
+    }
+    EXPECT_EQ(instr.GetStatus(), ExecutionStatus::FAILURE);
+    // A timeout that cannot be read is a failure, but not a timeout
+    const std::size_t expected_timeouts = timeout == "0.0" ? 1 : 0;
+    EXPECT_EQ(instr.GetControlMetrics().GetSnapshot().m_timeouts, expected_timeouts);
+  }
+}
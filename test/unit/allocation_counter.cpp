@@ -0,0 +1,145 @@
+/******************************************************************************
+* $HeadURL: $
+* $Id: $
+*
+* Project       : Supervision and Automation - oac-tree
+*
+* Description   : SUP oac-tree control plugin
+*
+* Author        : Walter Van Herck (IO)
+*
+* Copyright (c) : 2010-2026 ITER Organization,
+*                 CS 90 046
+*                 13067 St. Paul-lez-Durance Cedex
+*                 France
+* SPDX-License-Identifier: MIT
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file LICENSE located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+#include "allocation_counter.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+std::atomic<std::size_t> g_allocation_count{0};
+std::atomic<std::size_t> g_allocated_bytes{0};
+thread_local std::size_t t_allocation_count = 0;
+thread_local std::size_t t_allocated_bytes = 0;
+
+void* CountedAllocate(std::size_t size)
+{
+  (void)g_allocation_count.fetch_add(1u, std::memory_order_relaxed);
+  (void)g_allocated_bytes.fetch_add(size, std::memory_order_relaxed);
+  ++t_allocation_count;
+  t_allocated_bytes += size;
+  void* ptr = std::malloc(size == 0u ? 1u : size);
+  if (ptr == nullptr)
+  {
+    throw std::bad_alloc{};
+  }
+  return ptr;
+}
+}  // unnamed namespace
+
+void* operator new(std::size_t size)
+{
+  return CountedAllocate(size);
+}
+
+void* operator new[](std::size_t size)
+{
+  return CountedAllocate(size);
+}
+
+void operator delete(void* ptr) noexcept
+{
+  std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+  std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+  std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept
+{
+  std::free(ptr);
+}
+
+namespace sup {
+
+namespace oac_tree {
+
+namespace test {
+
+std::size_t GetAllocationCount()
+{
+  return g_allocation_count.load(std::memory_order_relaxed);
+}
+
+std::size_t GetAllocatedBytes()
+{
+  return g_allocated_bytes.load(std::memory_order_relaxed);
+}
+
+std::size_t GetThreadAllocationCount()
+{
+  return t_allocation_count;
+}
+
+std::size_t GetThreadAllocatedBytes()
+{
+  return t_allocated_bytes;
+}
+
+AllocationCounter::AllocationCounter(Scope scope)
+  : m_scope{scope}
+  , m_start_allocations{CurrentAllocations()}
+  , m_start_bytes{CurrentBytes()}
+{}
+
+AllocationCounter::~AllocationCounter() = default;
+
+void AllocationCounter::Restart()
+{
+  m_start_allocations = CurrentAllocations();
+  m_start_bytes = CurrentBytes();
+}
+
+std::size_t AllocationCounter::Allocations() const
+{
+  return CurrentAllocations() - m_start_allocations;
+}
+
+std::size_t AllocationCounter::Bytes() const
+{
+  return CurrentBytes() - m_start_bytes;
+}
+
+std::size_t AllocationCounter::CurrentAllocations() const
+{
+  return m_scope == kCurrentThread ? GetThreadAllocationCount() : GetAllocationCount();
+}
+
+std::size_t AllocationCounter::CurrentBytes() const
+{
+  return m_scope == kCurrentThread ? GetThreadAllocatedBytes() : GetAllocatedBytes();
+}
+
+} // namespace test
+
+} // namespace oac_tree
+
+} // namespace sup
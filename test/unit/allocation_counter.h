@@ -0,0 +1,90 @@
+/******************************************************************************
+* $HeadURL: $
+* $Id: $
+*
+* Project       : Supervision and Automation - oac-tree
+*
+* Description   : SUP oac-tree control plugin
+*
+* Author        : Walter Van Herck (IO)
+*
+* Copyright (c) : 2010-2026 ITER Organization,
+*                 CS 90 046
+*                 13067 St. Paul-lez-Durance Cedex
+*                 France
+* SPDX-License-Identifier: MIT
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file LICENSE located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+#ifndef SUP_OAC_TREE_PLUGIN_CONTROL_ALLOCATION_COUNTER_H_
+#define SUP_OAC_TREE_PLUGIN_CONTROL_ALLOCATION_COUNTER_H_
+
+#include <cstddef>
+
+namespace sup {
+
+namespace oac_tree {
+
+namespace test {
+
+/**
+ * @brief Total number of calls to the global operator new (all threads) since program start.
+ */
+std::size_t GetAllocationCount();
+
+/**
+ * @brief Total number of bytes requested from the global operator new (all threads) since program
+ * start.
+ */
+std::size_t GetAllocatedBytes();
+
+/**
+ * @brief Number of calls to the global operator new from the current thread.
+ */
+std::size_t GetThreadAllocationCount();
+
+/**
+ * @brief Number of bytes requested from the global operator new by the current thread.
+ */
+std::size_t GetThreadAllocatedBytes();
+
+/**
+ * @brief Utility class that records the number of allocations and allocated bytes between its
+ * construction (or last call to Restart) and the moment of the query. It either counts the
+ * allocations of all threads or only those of the thread that created it.
+ */
+class AllocationCounter
+{
+public:
+  enum Scope
+  {
+    kAllThreads,
+    kCurrentThread
+  };
+  explicit AllocationCounter(Scope scope = kAllThreads);
+  ~AllocationCounter();
+
+  void Restart();
+
+  std::size_t Allocations() const;
+  std::size_t Bytes() const;
+
+private:
+  std::size_t CurrentAllocations() const;
+  std::size_t CurrentBytes() const;
+  Scope m_scope;
+  std::size_t m_start_allocations;
+  std::size_t m_start_bytes;
+};
+
+} // namespace test
+
+} // namespace oac_tree
+
+} // namespace sup
+
+#endif // SUP_OAC_TREE_PLUGIN_CONTROL_ALLOCATION_COUNTER_H_
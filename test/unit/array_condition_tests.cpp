@@ -0,0 +1,275 @@
+/******************************************************************************
+* $HeadURL: $
+* $Id: $
+*
+* Project       : Supervision and Automation - oac-tree
+*
+* Description   : SUP oac-tree control plugin
+*
+* Author        : Walter Van Herck (IO)
+*
+* Copyright (c) : 2010-2026 ITER Organization,
+*                 CS 90 046
+*                 13067 St. Paul-lez-Durance Cedex
+*                 France
+* SPDX-License-Identifier: MIT
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file LICENSE located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+
+#include "test_user_interface.h"
+#include "unit_test_helper.h"
+
+#include "oac-tree/control/array_comparison_kernel.h"
+
+#include <sup/oac-tree/sequence_parser.h>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+using namespace sup::oac_tree;
+
+class ArrayConditionTest : public ::testing::Test
+{
+protected:
+  ArrayConditionTest() = default;
+  virtual ~ArrayConditionTest() = default;
+
+  static std::string CreateBody(const std::string& attributes, const std::string& array_value);
+};
+
+TEST_F(ArrayConditionTest, CountArrayMatches)
+{
+  // Size is not a multiple of the vector block size, to also cover the remainder
+  std::vector<double> values{ 0.0, 1.0, 2.0, 1.0, 0.0, 1.0, 2.0, 1.0, 1.0, NAN, 1.0 };
+  const auto n_values = values.size();
+  EXPECT_EQ(CountArrayMatches(values.data(), n_values, ArrayComparison::kEqual, 1.0, false,
+                              n_values), 6);
+  EXPECT_EQ(CountArrayMatches(values.data(), n_values, ArrayComparison::kEqual, 1.0, true,
+                              n_values), 5);
+  EXPECT_EQ(CountArrayMatches(values.data(), n_values, ArrayComparison::kNotEqual, 1.0, false,
+                              n_values), 5);
+  EXPECT_EQ(CountArrayMatches(values.data(), n_values, ArrayComparison::kLess, 1.0, false,
+                              n_values), 2);
+  EXPECT_EQ(CountArrayMatches(values.data(), n_values, ArrayComparison::kLessOrEqual, 1.0, false,
+                              n_values), 8);
+  EXPECT_EQ(CountArrayMatches(values.data(), n_values, ArrayComparison::kGreater, 1.0, false,
+                              n_values), 2);
+  EXPECT_EQ(CountArrayMatches(values.data(), n_values, ArrayComparison::kGreaterOrEqual, 1.0,
+                              false, n_values), 8);
+  // NaN never compares as less, greater or equal
+  EXPECT_EQ(CountArrayMatches(values.data(), n_values, ArrayComparison::kLess, 1.0, true,
+                              n_values), 9);
+  // Empty array
+  EXPECT_EQ(CountArrayMatches(values.data(), 0, ArrayComparison::kEqual, 1.0, false, 1), 0);
+}
+
+TEST_F(ArrayConditionTest, CountArrayMatchesLimit)
+{
+  std::vector<double> values(1000, 1.0);
+  auto count = CountArrayMatches(values.data(), values.size(), ArrayComparison::kEqual, 1.0,
+                                 false, 1);
+  // Counting stops early
+  EXPECT_GE(count, 1);
+  EXPECT_LT(count, values.size());
+}
+
+TEST_F(ArrayConditionTest, CountIntegerArrayMatches)
+{
+  // Differences below the precision of a double
+  const std::int64_t big = (std::int64_t{1} << 53) + 1;
+  std::vector<std::int64_t> values{ big, big - 1, big, -big };
+  const auto n_values = values.size();
+  EXPECT_EQ(CountArrayMatches(values.data(), n_values, ArrayComparison::kEqual, big, false,
+                              n_values), 2);
+  EXPECT_EQ(CountArrayMatches(values.data(), n_values, ArrayComparison::kLess, big, false,
+                              n_values), 2);
+  EXPECT_EQ(CountArrayMatches(values.data(), n_values, ArrayComparison::kGreaterOrEqual, big,
+                              true, n_values), 2);
+  std::vector<std::uint64_t> unsigned_values{ 18446744073709551615u, 18446744073709551614u };
+  EXPECT_EQ(CountArrayMatches(unsigned_values.data(), unsigned_values.size(),
+                              ArrayComparison::kGreater, std::uint64_t{18446744073709551614u},
+                              false, unsigned_values.size()), 1);
+}
+
+TEST_F(ArrayConditionTest, AllMode)
+{
+  {
+    auto proc = ParseProcedureString(CreateBody(R"(mode="all")", "[1,1,1,1,1,1,1,1,1,1]"));
+    test::NullUserInterface ui;
+    EXPECT_TRUE(test::TryAndExecute(proc, ui));
+  }
+  {
+    auto proc = ParseProcedureString(CreateBody(R"(mode="all")", "[1,1,1,1,1,1,1,1,1,0]"));
+    test::NullUserInterface ui;
+    EXPECT_TRUE(test::TryAndExecute(proc, ui, ExecutionStatus::FAILURE));
+  }
+  {
+    // Default mode is all
+    auto proc = ParseProcedureString(CreateBody("", "[1,1,0,1,1,1,1,1,1,1]"));
+    test::NullUserInterface ui;
+    EXPECT_TRUE(test::TryAndExecute(proc, ui, ExecutionStatus::FAILURE));
+  }
+}
+
+TEST_F(ArrayConditionTest, AnyMode)
+{
+  {
+    auto proc = ParseProcedureString(CreateBody(R"(mode="any")", "[0,0,0,0,0,0,0,0,0,1]"));
+    test::NullUserInterface ui;
+    EXPECT_TRUE(test::TryAndExecute(proc, ui));
+  }
+  {
+    auto proc = ParseProcedureString(CreateBody(R"(mode="any")", "[0,0,0,0,0,0,0,0,0,0]"));
+    test::NullUserInterface ui;
+    EXPECT_TRUE(test::TryAndExecute(proc, ui, ExecutionStatus::FAILURE));
+  }
+  {
+    auto proc = ParseProcedureString(
+      CreateBody(R"(mode="any" comparison="greater")", "[0,0,0,0,0,0,0,0,2,0]"));
+    test::NullUserInterface ui;
+    EXPECT_TRUE(test::TryAndExecute(proc, ui));
+  }
+}
+
+TEST_F(ArrayConditionTest, CountMode)
+{
+  {
+    auto proc = ParseProcedureString(
+      CreateBody(R"(mode="count" threshold="3")", "[0,1,0,1,0,1,0,0,0,0]"));
+    test::NullUserInterface ui;
+    EXPECT_TRUE(test::TryAndExecute(proc, ui));
+  }
+  {
+    auto proc = ParseProcedureString(
+      CreateBody(R"(mode="count" threshold="4")", "[0,1,0,1,0,1,0,0,0,0]"));
+    test::NullUserInterface ui;
+    EXPECT_TRUE(test::TryAndExecute(proc, ui, ExecutionStatus::FAILURE));
+  }
+  {
+    auto proc = ParseProcedureString(
+      CreateBody(R"(mode="count" threshold="7" comparison="notEqual")", "[0,1,0,1,0,1,0,0,0,0]"));
+    test::NullUserInterface ui;
+    EXPECT_TRUE(test::TryAndExecute(proc, ui));
+  }
+}
+
+TEST_F(ArrayConditionTest, WaitForCondition)
+{
+  const std::string body{R"(
+    <ParallelSequence>
+        <WaitForCondition timeout="1.0">
+            <ArrayCondition varName="statuses" referenceVar="one" comparison="greaterOrEqual"/>
+        </WaitForCondition>
+        <Sequence>
+            <Wait timeout="0.1"/>
+            <Copy inputVar="ok_statuses" outputVar="statuses"/>
+        </Sequence>
+    </ParallelSequence>
+    <Workspace>
+        <Local name="statuses" type='{"type":"uint32_array","multiplicity":4,"element":{"type":"uint32"}}'
+               value='[1,0,2,1]' />
+        <Local name="ok_statuses" type='{"type":"uint32_array","multiplicity":4,"element":{"type":"uint32"}}'
+               value='[1,1,2,1]' />
+        <Local name="one" type='{"type":"uint32"}' value='1' />
+    </Workspace>
+)"};
+
+  test::NullUserInterface ui;
+  auto proc = ParseProcedureString(test::CreateProcedureString(body));
+  EXPECT_TRUE(test::TryAndExecute(proc, ui));
+}
+
+TEST_F(ArrayConditionTest, SixtyFourBitIntegers)
+{
+  const std::string body{R"(
+    <Sequence>
+        <Inverter>
+            <ArrayCondition varName="signed" referenceVar="signed_ref"/>
+        </Inverter>
+        <ArrayCondition varName="signed" referenceVar="signed_ref" comparison="greater"/>
+        <ArrayCondition varName="signed" referenceVar="unsigned_max" comparison="less"/>
+        <ArrayCondition varName="unsigned" referenceVar="minus_one" comparison="greater"/>
+        <ArrayCondition varName="unsigned" referenceVar="unsigned_max" mode="any"/>
+        <Inverter>
+            <ArrayCondition varName="signed" referenceVar="float_ref" comparison="greater"/>
+        </Inverter>
+    </Sequence>
+    <Workspace>
+        <Local name="signed" type='{"type":"int64_array","multiplicity":2,"element":{"type":"int64"}}'
+               value='[9007199254740993,9007199254740993]' />
+        <Local name="unsigned" type='{"type":"uint64_array","multiplicity":2,"element":{"type":"uint64"}}'
+               value='[18446744073709551615,0]' />
+        <Local name="signed_ref" type='{"type":"int64"}' value='9007199254740992' />
+        <Local name="unsigned_max" type='{"type":"uint64"}' value='18446744073709551615' />
+        <Local name="minus_one" type='{"type":"int8"}' value='-1' />
+        <Local name="float_ref" type='{"type":"float64"}' value='1.0' />
+    </Workspace>
+)"};
+
+  test::NullUserInterface ui;
+  auto proc = ParseProcedureString(test::CreateProcedureString(body));
+  EXPECT_TRUE(test::TryAndExecute(proc, ui));
+}
+
+TEST_F(ArrayConditionTest, InvalidVariables)
+{
+  const std::string body{R"(
+    <Sequence>
+        <Inverter>
+            <ArrayCondition varName="undefined" referenceVar="one"/>
+        </Inverter>
+        <Inverter>
+            <ArrayCondition varName="one" referenceVar="one"/>
+        </Inverter>
+    </Sequence>
+    <Workspace>
+        <Local name="one" type='{"type":"uint32"}' value='1' />
+    </Workspace>
+)"};
+
+  test::NullUserInterface ui;
+  auto proc = ParseProcedureString(test::CreateProcedureString(body));
+  EXPECT_TRUE(test::TryAndExecute(proc, ui));
+}
+
+TEST_F(ArrayConditionTest, Setup)
+{
+  {
+    // Unknown mode
+    auto proc = ParseProcedureString(CreateBody(R"(mode="most")", "[1,1,1,1,1,1,1,1,1,1]"));
+    EXPECT_THROW(proc->Setup(), InstructionSetupException);
+  }
+  {
+    // Unknown comparison
+    auto proc = ParseProcedureString(
+      CreateBody(R"(comparison="almostEqual")", "[1,1,1,1,1,1,1,1,1,1]"));
+    EXPECT_THROW(proc->Setup(), InstructionSetupException);
+  }
+  {
+    // Missing threshold
+    auto proc = ParseProcedureString(CreateBody(R"(mode="count")", "[1,1,1,1,1,1,1,1,1,1]"));
+    EXPECT_THROW(proc->Setup(), InstructionSetupException);
+  }
+}
+
+std::string ArrayConditionTest::CreateBody(const std::string& attributes,
+                                           const std::string& array_value)
+{
+  const std::string body =
+    R"(<ArrayCondition varName="statuses" referenceVar="one" )" + attributes + "/>" + R"(
+    <Workspace>
+        <Local name="statuses" type='{"type":"uint32_array","multiplicity":10,"element":{"type":"uint32"}}'
+               value=')" + array_value + R"(' />
+        <Local name="one" type='{"type":"uint32"}' value='1' />
+    </Workspace>
+)";
+  return test::CreateProcedureString(body);
+}
@@ -0,0 +1,55 @@
+/******************************************************************************
+* $HeadURL: $
+* $Id: $
+*
+* Project       : Supervision and Automation - oac-tree
+*
+* Description   : SUP oac-tree control plugin
+*
+* Author        : Walter Van Herck (IO)
+*
+* Copyright (c) : 2010-2026 ITER Organization,
+*                 CS 90 046
+*                 13067 St. Paul-lez-Durance Cedex
+*                 France
+* SPDX-License-Identifier: MIT
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file LICENSE located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+
+#include "oac-tree/control/building_block_factory.h"
+
+#include <sup/oac-tree/instruction.h>
+
+#include <gtest/gtest.h>
+
+using namespace sup::oac_tree;
+
+class BuildingBlockFactoryTest : public ::testing::Test
+{
+protected:
+  BuildingBlockFactoryTest() = default;
+  virtual ~BuildingBlockFactoryTest() = default;
+};
+
+TEST_F(BuildingBlockFactoryTest, Create)
+{
+  for (auto block : { BuildingBlock::kAsync, BuildingBlock::kForceSuccess,
+                      BuildingBlock::kReactiveFallback, BuildingBlock::kReactiveSequence,
+                      BuildingBlock::kSequence })
+  {
+    auto instr = CreateBuildingBlock(block);
+    ASSERT_NE(instr, nullptr);
+    EXPECT_EQ(instr->GetType(), GetBuildingBlockType(block));
+  }
+  EXPECT_EQ(GetBuildingBlockType(BuildingBlock::kReactiveFallback), "ReactiveFallback");
+
+  // Each call creates a new instance
+  auto sequence_1 = CreateBuildingBlock(BuildingBlock::kSequence);
+  auto sequence_2 = CreateBuildingBlock(BuildingBlock::kSequence);
+  EXPECT_NE(sequence_1.get(), sequence_2.get());
+}
@@ -0,0 +1,139 @@
+/******************************************************************************
+* $HeadURL: $
+* $Id: $
+*
+* Project       : Supervision and Automation - oac-tree
+*
+* Description   : SUP oac-tree control plugin
+*
+* Author        : Walter Van Herck (IO)
+*
+* Copyright (c) : 2010-2026 ITER Organization,
+*                 CS 90 046
+*                 13067 St. Paul-lez-Durance Cedex
+*                 France
+* SPDX-License-Identifier: MIT
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file LICENSE located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+
+#include "oac-tree/control/condition_debouncer.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <limits>
+
+using namespace sup::oac_tree;
+
+class ConditionDebouncerTest : public ::testing::Test
+{
+protected:
+  ConditionDebouncerTest() = default;
+  virtual ~ConditionDebouncerTest() = default;
+};
+
+TEST_F(ConditionDebouncerTest, Disabled)
+{
+  ConditionDebouncer debouncer;
+  EXPECT_FALSE(debouncer.IsEnabled());
+  debouncer.SetStableCount(1);
+  EXPECT_FALSE(debouncer.IsEnabled());
+  debouncer.SetStableDuration(-1.0);
+  EXPECT_FALSE(debouncer.IsEnabled());
+  debouncer.SetStableDuration(std::numeric_limits<double>::quiet_NaN());
+  EXPECT_FALSE(debouncer.IsEnabled());
+
+  // Outcomes are accepted immediately
+  EXPECT_EQ(debouncer.Update(ExecutionStatus::FAILURE), ExecutionStatus::FAILURE);
+  EXPECT_EQ(debouncer.Update(ExecutionStatus::SUCCESS), ExecutionStatus::SUCCESS);
+  EXPECT_EQ(debouncer.Update(ExecutionStatus::FAILURE), ExecutionStatus::FAILURE);
+  EXPECT_FALSE(debouncer.IsSettling());
+}
+
+TEST_F(ConditionDebouncerTest, StableCount)
+{
+  ConditionDebouncer debouncer;
+  debouncer.SetStableCount(3);
+  EXPECT_TRUE(debouncer.IsEnabled());
+
+  // The first outcome settles
+  EXPECT_EQ(debouncer.Update(ExecutionStatus::SUCCESS), ExecutionStatus::RUNNING);
+  EXPECT_TRUE(debouncer.IsSettling());
+  EXPECT_EQ(debouncer.Update(ExecutionStatus::SUCCESS), ExecutionStatus::RUNNING);
+  EXPECT_EQ(debouncer.Update(ExecutionStatus::SUCCESS), ExecutionStatus::SUCCESS);
+  EXPECT_FALSE(debouncer.IsSettling());
+
+  // Short glitches are ignored
+  EXPECT_EQ(debouncer.Update(ExecutionStatus::FAILURE), ExecutionStatus::SUCCESS);
+  EXPECT_TRUE(debouncer.IsSettling());
+  EXPECT_EQ(debouncer.Update(ExecutionStatus::FAILURE), ExecutionStatus::SUCCESS);
+  EXPECT_EQ(debouncer.Update(ExecutionStatus::SUCCESS), ExecutionStatus::SUCCESS);
+  EXPECT_FALSE(debouncer.IsSettling());
+
+  // Unfinished outcomes do not interrupt settling
+  EXPECT_EQ(debouncer.Update(ExecutionStatus::FAILURE), ExecutionStatus::SUCCESS);
+  EXPECT_EQ(debouncer.Update(ExecutionStatus::RUNNING), ExecutionStatus::SUCCESS);
+  EXPECT_EQ(debouncer.Update(ExecutionStatus::FAILURE), ExecutionStatus::SUCCESS);
+  EXPECT_EQ(debouncer.Update(ExecutionStatus::FAILURE), ExecutionStatus::FAILURE);
+}
+
+TEST_F(ConditionDebouncerTest, StableDuration)
+{
+  ConditionDebouncer debouncer;
+  debouncer.SetStableDuration(std::chrono::milliseconds(100));
+  EXPECT_TRUE(debouncer.IsEnabled());
+  auto start = ConditionDebouncer::Clock::now();
+
+  EXPECT_EQ(debouncer.Update(ExecutionStatus::FAILURE, start), ExecutionStatus::RUNNING);
+  EXPECT_EQ(debouncer.Update(ExecutionStatus::FAILURE, start + std::chrono::milliseconds(50)),
+            ExecutionStatus::RUNNING);
+  EXPECT_EQ(debouncer.Update(ExecutionStatus::FAILURE, start + std::chrono::milliseconds(100)),
+            ExecutionStatus::FAILURE);
+
+  // A glitch restarts the duration
+  EXPECT_EQ(debouncer.Update(ExecutionStatus::SUCCESS, start + std::chrono::milliseconds(150)),
+            ExecutionStatus::FAILURE);
+  EXPECT_EQ(debouncer.Update(ExecutionStatus::FAILURE, start + std::chrono::milliseconds(200)),
+            ExecutionStatus::FAILURE);
+  EXPECT_EQ(debouncer.Update(ExecutionStatus::SUCCESS, start + std::chrono::milliseconds(210)),
+            ExecutionStatus::FAILURE);
+  EXPECT_EQ(debouncer.Update(ExecutionStatus::SUCCESS, start + std::chrono::milliseconds(300)),
+            ExecutionStatus::FAILURE);
+  EXPECT_EQ(debouncer.Update(ExecutionStatus::SUCCESS, start + std::chrono::milliseconds(310)),
+            ExecutionStatus::SUCCESS);
+}
+
+TEST_F(ConditionDebouncerTest, StableCountAndDuration)
+{
+  ConditionDebouncer debouncer;
+  debouncer.SetStableCount(3);
+  debouncer.SetStableDuration(std::chrono::milliseconds(100));
+  auto start = ConditionDebouncer::Clock::now();
+
+  // Duration reached, but not the count
+  EXPECT_EQ(debouncer.Update(ExecutionStatus::SUCCESS, start), ExecutionStatus::RUNNING);
+  EXPECT_EQ(debouncer.Update(ExecutionStatus::SUCCESS, start + std::chrono::seconds(1)),
+            ExecutionStatus::RUNNING);
+  EXPECT_EQ(debouncer.Update(ExecutionStatus::SUCCESS, start + std::chrono::seconds(1)),
+            ExecutionStatus::SUCCESS);
+}
+
+TEST_F(ConditionDebouncerTest, Reset)
+{
+  ConditionDebouncer debouncer;
+  debouncer.SetStableCount(2);
+  EXPECT_EQ(debouncer.Update(ExecutionStatus::SUCCESS), ExecutionStatus::RUNNING);
+  EXPECT_EQ(debouncer.Update(ExecutionStatus::SUCCESS), ExecutionStatus::SUCCESS);
+  EXPECT_EQ(debouncer.Update(ExecutionStatus::FAILURE), ExecutionStatus::SUCCESS);
+
+  debouncer.Reset();
+  EXPECT_FALSE(debouncer.IsSettling());
+  EXPECT_EQ(debouncer.Update(ExecutionStatus::FAILURE), ExecutionStatus::RUNNING);
+  EXPECT_EQ(debouncer.Update(ExecutionStatus::RUNNING), ExecutionStatus::RUNNING);
+  EXPECT_EQ(debouncer.Update(ExecutionStatus::FAILURE), ExecutionStatus::FAILURE);
+}
@@ -0,0 +1,265 @@
+/******************************************************************************
+* $HeadURL: $
+* $Id: $
+*
+* Project       : Supervision and Automation - oac-tree
+*
+* Description   : SUP oac-tree control plugin
+*
+* Author        : Walter Van Herck (IO)
+*
+* Copyright (c) : 2010-2026 ITER Organization,
+*                 CS 90 046
+*                 13067 St. Paul-lez-Durance Cedex
+*                 France
+* SPDX-License-Identifier: MIT
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file LICENSE located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+
+#include "test_instructions.h"
+#include "test_user_interface.h"
+#include "unit_test_helper.h"
+
+#include "oac-tree/control/condition_program.h"
+
+#include <sup/oac-tree/instruction.h>
+#include <sup/oac-tree/instruction_registry.h>
+#include <sup/oac-tree/procedure.h>
+#include <sup/oac-tree/sequence_parser.h>
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+using namespace sup::oac_tree;
+
+class ConditionProgramTest : public ::testing::Test
+{
+protected:
+  ConditionProgramTest() = default;
+  virtual ~ConditionProgramTest() = default;
+
+  static std::unique_ptr<Instruction> CreateComparison(const std::string& instr_type,
+                                                       const std::string& left_var,
+                                                       const std::string& right_var);
+
+  /**
+   * Evaluates the compiled condition against a workspace with numeric variables of different
+   * types and checks that the outcome is the same as when executing the condition tree.
+   */
+  static void ExpectSameOutcome(const std::string& condition);
+
+  static std::string CreateComparisonBody(const std::string& instr_type,
+                                          const std::string& left_var,
+                                          const std::string& right_var);
+};
+
+namespace
+{
+// Numeric variables of different types, some of them with equal values
+const std::vector<std::string> kVariableNames{ "i8_one",   "u64_one", "f64_one", "i32_minus_two",
+                                               "f32_half", "u8_two",  "f64_two" };
+const std::string kWorkspace{R"(
+    <Workspace>
+        <Local name="i8_one" type='{"type":"int8"}' value='1' />
+        <Local name="u64_one" type='{"type":"uint64"}' value='1' />
+        <Local name="f64_one" type='{"type":"float64"}' value='1.0' />
+        <Local name="i32_minus_two" type='{"type":"int32"}' value='-2' />
+        <Local name="f32_half" type='{"type":"float32"}' value='0.5' />
+        <Local name="u8_two" type='{"type":"uint8"}' value='2' />
+        <Local name="f64_two" type='{"type":"float64"}' value='2.0' />
+    </Workspace>
+)"};
+}  // unnamed namespace
+
+TEST_F(ConditionProgramTest, Comparison)
+{
+  for (const std::string instr_type : { "Equals", "GreaterThan", "GreaterThanOrEqual", "LessThan",
+                                        "LessThanOrEqual" })
+  {
+    auto condition = CreateComparison(instr_type, "live", "one");
+    auto program = ConditionProgram::Compile(*condition);
+    ASSERT_NE(program, nullptr) << instr_type;
+    EXPECT_EQ(program->GetOperationCount(), 1);
+    EXPECT_EQ(program->GetOperandCount(), 2);
+  }
+}
+
+TEST_F(ConditionProgramTest, CompoundCondition)
+{
+  // Sequence(Equals, Inverter(LessThan), Fallback(Fail, ForceSuccess(GreaterThan)), Succeed)
+  auto sequence = GlobalInstructionRegistry().Create("Sequence");
+  auto inverter = GlobalInstructionRegistry().Create("Inverter");
+  auto fallback = GlobalInstructionRegistry().Create("Fallback");
+  auto force_success = GlobalInstructionRegistry().Create("ForceSuccess");
+  ASSERT_TRUE(inverter->InsertInstruction(CreateComparison("LessThan", "live", "zero"), 0));
+  ASSERT_TRUE(force_success->InsertInstruction(CreateComparison("GreaterThan", "one", "live"), 0));
+  ASSERT_TRUE(fallback->InsertInstruction(GlobalInstructionRegistry().Create("Fail"), 0));
+  ASSERT_TRUE(fallback->InsertInstruction(std::move(force_success), 1));
+  ASSERT_TRUE(sequence->InsertInstruction(CreateComparison("Equals", "live", "zero"), 0));
+  ASSERT_TRUE(sequence->InsertInstruction(std::move(inverter), 1));
+  ASSERT_TRUE(sequence->InsertInstruction(std::move(fallback), 2));
+  ASSERT_TRUE(sequence->InsertInstruction(GlobalInstructionRegistry().Create("Succeed"), 3));
+
+  auto program = ConditionProgram::Compile(*sequence);
+  ASSERT_NE(program, nullptr);
+  EXPECT_EQ(program->GetOperationCount(), 9);
+  // Variables are only read once, even when referenced multiple times
+  EXPECT_EQ(program->GetOperandCount(), 3);
+}
+
+TEST_F(ConditionProgramTest, NotCompilable)
+{
+  {
+    // Instruction with side effects
+    auto condition = GlobalInstructionRegistry().Create("Wait");
+    EXPECT_EQ(ConditionProgram::Compile(*condition), nullptr);
+  }
+  {
+    // Unknown instruction deep in the tree
+    auto sequence = GlobalInstructionRegistry().Create("Sequence");
+    auto counting = GlobalInstructionRegistry().Create(test::CountingCondition::Type);
+    ASSERT_TRUE(counting->AddAttribute("varName", "live"));
+    ASSERT_TRUE(sequence->InsertInstruction(CreateComparison("Equals", "live", "zero"), 0));
+    ASSERT_TRUE(sequence->InsertInstruction(std::move(counting), 1));
+    EXPECT_EQ(ConditionProgram::Compile(*sequence), nullptr);
+  }
+  {
+    // Indirect variable reference
+    auto condition = CreateComparison("Equals", "@live", "zero");
+    EXPECT_EQ(ConditionProgram::Compile(*condition), nullptr);
+  }
+  {
+    // Missing operand
+    auto condition = GlobalInstructionRegistry().Create("Equals");
+    ASSERT_TRUE(condition->AddAttribute("leftVar", "live"));
+    EXPECT_EQ(ConditionProgram::Compile(*condition), nullptr);
+  }
+  {
+    // Decorator without child
+    auto condition = GlobalInstructionRegistry().Create("Inverter");
+    EXPECT_EQ(ConditionProgram::Compile(*condition), nullptr);
+  }
+}
+
+TEST_F(ConditionProgramTest, ComparisonTruthTable)
+{
+  // All pairs of variables, including equality between different numeric types
+  for (const std::string instr_type : { "Equals", "GreaterThan", "GreaterThanOrEqual", "LessThan",
+                                        "LessThanOrEqual" })
+  {
+    for (const auto& left_var : kVariableNames)
+    {
+      for (const auto& right_var : kVariableNames)
+      {
+        ExpectSameOutcome(CreateComparisonBody(instr_type, left_var, right_var));
+      }
+    }
+  }
+}
+
+TEST_F(ConditionProgramTest, LeafTruthTable)
+{
+  ExpectSameOutcome("<Succeed/>");
+  ExpectSameOutcome("<Fail/>");
+}
+
+TEST_F(ConditionProgramTest, DecoratorTruthTable)
+{
+  const std::vector<std::string> children{
+    "<Succeed/>", "<Fail/>", CreateComparisonBody("LessThanOrEqual", "u8_two", "f64_two"),
+    CreateComparisonBody("GreaterThan", "f32_half", "i8_one")
+  };
+  for (const auto& child : children)
+  {
+    ExpectSameOutcome("<Inverter>" + child + "</Inverter>");
+    ExpectSameOutcome("<ForceSuccess>" + child + "</ForceSuccess>");
+    ExpectSameOutcome("<Inverter><Inverter>" + child + "</Inverter></Inverter>");
+    ExpectSameOutcome("<Inverter><ForceSuccess>" + child + "</ForceSuccess></Inverter>");
+    ExpectSameOutcome("<ForceSuccess><Inverter>" + child + "</Inverter></ForceSuccess>");
+  }
+}
+
+TEST_F(ConditionProgramTest, CompoundTruthTable)
+{
+  // Every combination of up to three successful or failing children
+  const std::vector<std::string> leaves{
+    CreateComparisonBody("Equals", "f64_one", "u64_one"),
+    CreateComparisonBody("GreaterThanOrEqual", "i32_minus_two", "f32_half")
+  };
+  for (std::size_t n_children = 1; n_children <= 3; ++n_children)
+  {
+    for (std::size_t pattern = 0; pattern < (1u << n_children); ++pattern)
+    {
+      std::string children;
+      for (std::size_t idx = 0; idx < n_children; ++idx)
+      {
+        children += leaves[(pattern >> idx) & 1u];
+      }
+      ExpectSameOutcome("<Sequence>" + children + "</Sequence>");
+      ExpectSameOutcome("<Fallback>" + children + "</Fallback>");
+    }
+  }
+}
+
+TEST_F(ConditionProgramTest, NestedTruthTable)
+{
+  const std::string is_one = CreateComparisonBody("Equals", "i8_one", "f64_one");
+  const std::string is_two = CreateComparisonBody("Equals", "u8_two", "u64_one");
+  const std::string is_less = CreateComparisonBody("LessThan", "i32_minus_two", "f32_half");
+  const std::string is_greater = CreateComparisonBody("GreaterThan", "f64_two", "u8_two");
+  ExpectSameOutcome("<Sequence>" + is_one + "<Inverter>" + is_two + "</Inverter>" +
+                    "<Fallback><Fail/><ForceSuccess>" + is_greater + "</ForceSuccess></Fallback>" +
+                    "<Succeed/></Sequence>");
+  ExpectSameOutcome("<Fallback><Sequence>" + is_one + is_two + "</Sequence>" +
+                    "<Sequence>" + is_less + is_greater + "</Sequence></Fallback>");
+  ExpectSameOutcome("<Fallback><Sequence>" + is_one + is_less + "</Sequence>" + is_greater +
+                    "</Fallback>");
+  ExpectSameOutcome("<Inverter><Fallback>" + is_two + "<Inverter><Sequence>" + is_less +
+                    is_one + "</Sequence></Inverter></Fallback></Inverter>");
+  ExpectSameOutcome("<Sequence><ForceSuccess><Sequence>" + is_two + is_less + "</Sequence>" +
+                    "</ForceSuccess><Fallback>" + is_greater + "<Inverter>" + is_one +
+                    "</Inverter></Fallback></Sequence>");
+}
+
+std::unique_ptr<Instruction> ConditionProgramTest::CreateComparison(const std::string& instr_type,
+                                                                    const std::string& left_var,
+                                                                    const std::string& right_var)
+{
+  auto result = GlobalInstructionRegistry().Create(instr_type);
+  EXPECT_TRUE(result->AddAttribute("leftVar", left_var));
+  EXPECT_TRUE(result->AddAttribute("rightVar", right_var));
+  return result;
+}
+
+void ConditionProgramTest::ExpectSameOutcome(const std::string& condition)
+{
+  const std::size_t kMaxTicks = 100;
+  test::NullUserInterface ui;
+  auto proc = ParseProcedureString(test::CreateProcedureString(condition + kWorkspace));
+  ASSERT_TRUE(proc) << condition;
+  ASSERT_NO_THROW(proc->Setup()) << condition;
+  auto program = ConditionProgram::Compile(*proc->RootInstruction());
+  ASSERT_NE(program, nullptr) << condition;
+  bool result = false;
+  ASSERT_TRUE(program->Evaluate(proc->GetWorkspace(), result)) << condition;
+  for (std::size_t idx = 0; idx < kMaxTicks && !IsFinishedStatus(proc->GetStatus()); ++idx)
+  {
+    proc->ExecuteSingle(ui);
+  }
+  ASSERT_TRUE(IsFinishedStatus(proc->GetStatus())) << condition;
+  EXPECT_EQ(result, proc->GetStatus() == ExecutionStatus::SUCCESS) << condition;
+  proc->Reset(ui);
+}
+
+std::string ConditionProgramTest::CreateComparisonBody(const std::string& instr_type,
+                                                       const std::string& left_var,
+                                                       const std::string& right_var)
+{
+  return "<" + instr_type + R"( leftVar=")" + left_var + R"(" rightVar=")" + right_var + R"("/>)";
+}
@@ -0,0 +1,111 @@
+/******************************************************************************
+* $HeadURL: $
+* $Id: $
+*
+* Project       : Supervision and Automation - oac-tree
+*
+* Description   : SUP oac-tree control plugin
+*
+* Author        : Walter Van Herck (IO)
+*
+* Copyright (c) : 2010-2026 ITER Organization,
+*                 CS 90 046
+*                 13067 St. Paul-lez-Durance Cedex
+*                 France
+* SPDX-License-Identifier: MIT
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file LICENSE located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+
+#include "test_instructions.h"
+#include "test_user_interface.h"
+
+#include "oac-tree/control/condition_throttle.h"
+
+#include <sup/oac-tree/instruction_registry.h>
+#include <sup/oac-tree/procedure.h>
+#include <sup/oac-tree/workspace.h>
+
+#include <gtest/gtest.h>
+
+#include <limits>
+#include <memory>
+
+using namespace sup::oac_tree;
+
+class ConditionThrottleTest : public ::testing::Test
+{
+protected:
+  ConditionThrottleTest();
+  virtual ~ConditionThrottleTest() = default;
+
+  std::unique_ptr<Instruction> m_condition;
+  test::NullUserInterface m_ui;
+  Workspace m_ws;
+};
+
+TEST_F(ConditionThrottleTest, Disabled)
+{
+  ConditionThrottle throttle;
+  EXPECT_EQ(throttle.GetPeriod(), ConditionThrottle::Clock::duration::zero());
+  auto now = ConditionThrottle::Clock::now();
+  for (int i = 0; i < 3; ++i)
+  {
+    // The condition fails, since its variable is not present in the workspace
+    EXPECT_EQ(throttle.Evaluate(*m_condition, m_ui, m_ws, now), ExecutionStatus::FAILURE);
+  }
+  EXPECT_EQ(throttle.GetEvaluationCount(), 3);
+  EXPECT_EQ(throttle.GetSkippedEvaluationCount(), 0);
+}
+
+TEST_F(ConditionThrottleTest, CachedOutcome)
+{
+  ConditionThrottle throttle;
+  throttle.SetPeriod(std::chrono::milliseconds(10));
+  auto now = ConditionThrottle::Clock::now();
+  EXPECT_EQ(throttle.Evaluate(*m_condition, m_ui, m_ws, now), ExecutionStatus::FAILURE);
+  EXPECT_EQ(throttle.Evaluate(*m_condition, m_ui, m_ws, now + std::chrono::milliseconds(5)),
+            ExecutionStatus::FAILURE);
+  EXPECT_EQ(throttle.Evaluate(*m_condition, m_ui, m_ws, now + std::chrono::milliseconds(9)),
+            ExecutionStatus::FAILURE);
+  EXPECT_EQ(throttle.GetEvaluationCount(), 1);
+  EXPECT_EQ(throttle.GetSkippedEvaluationCount(), 2);
+
+  // Period elapsed: the condition is executed again
+  EXPECT_EQ(throttle.Evaluate(*m_condition, m_ui, m_ws, now + std::chrono::milliseconds(10)),
+            ExecutionStatus::FAILURE);
+  EXPECT_EQ(throttle.GetEvaluationCount(), 2);
+  EXPECT_EQ(throttle.GetSkippedEvaluationCount(), 2);
+
+  // Reset discards the cached outcome, but keeps the counters
+  throttle.Reset();
+  EXPECT_EQ(throttle.Evaluate(*m_condition, m_ui, m_ws, now + std::chrono::milliseconds(11)),
+            ExecutionStatus::FAILURE);
+  EXPECT_EQ(throttle.GetEvaluationCount(), 3);
+  EXPECT_EQ(throttle.GetSkippedEvaluationCount(), 2);
+}
+
+TEST_F(ConditionThrottleTest, InvalidPeriod)
+{
+  ConditionThrottle throttle;
+  throttle.SetPeriod(-1.0);
+  EXPECT_EQ(throttle.GetPeriod(), ConditionThrottle::Clock::duration::zero());
+  throttle.SetPeriod(std::numeric_limits<double>::quiet_NaN());
+  EXPECT_EQ(throttle.GetPeriod(), ConditionThrottle::Clock::duration::zero());
+  throttle.SetPeriod(0.5);
+  EXPECT_EQ(throttle.GetPeriod(), std::chrono::milliseconds(500));
+}
+
+ConditionThrottleTest::ConditionThrottleTest()
+  : m_condition{GlobalInstructionRegistry().Create(test::CountingCondition::Type)}
+  , m_ui{}
+  , m_ws{}
+{
+  (void)m_condition->AddAttribute("varName", "live");
+  Procedure proc;
+  m_condition->Setup(proc);
+}
@@ -0,0 +1,111 @@
+/******************************************************************************
+* $HeadURL: $
+* $Id: $
+*
+* Project       : Supervision and Automation - oac-tree
+*
+* Description   : SUP oac-tree control plugin
+*
+* Author        : Walter Van Herck (IO)
+*
+* Copyright (c) : 2010-2026 ITER Organization,
+*                 CS 90 046
+*                 13067 St. Paul-lez-Durance Cedex
+*                 France
+* SPDX-License-Identifier: MIT
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file LICENSE located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+#include "oac-tree/control/condition_debouncer.h"
+#include "oac-tree/control/control_clock.h"
+#include "oac-tree/control/deadline_timer.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+
+using namespace sup::oac_tree;
+
+class ControlClockTest : public ::testing::Test
+{
+protected:
+  ControlClockTest() = default;
+  virtual ~ControlClockTest() = default;
+};
+
+TEST_F(ControlClockTest, ManualClock)
+{
+  const ControlClock::Clock::time_point start{std::chrono::seconds(100)};
+  ManualControlClock clock{start};
+  EXPECT_EQ(clock.Now(), start);
+
+  clock.Advance(std::chrono::milliseconds(1500));
+  EXPECT_EQ(clock.Now(), start + std::chrono::milliseconds(1500));
+
+  clock.AdvanceTo(start + std::chrono::seconds(10));
+  EXPECT_EQ(clock.Now(), start + std::chrono::seconds(10));
+
+  // Time never goes back
+  clock.AdvanceTo(start);
+  EXPECT_EQ(clock.Now(), start + std::chrono::seconds(10));
+}
+
+TEST_F(ControlClockTest, ScopedClock)
+{
+  EXPECT_EQ(GetControlClock(), nullptr);
+  ManualControlClock outer_clock{ControlClock::Clock::time_point{std::chrono::hours(1)}};
+  ManualControlClock inner_clock{ControlClock::Clock::time_point{std::chrono::hours(2)}};
+  {
+    ScopedControlClock scoped_outer{outer_clock};
+    EXPECT_EQ(GetControlClock(), &outer_clock);
+    EXPECT_EQ(ControlClockNow(), outer_clock.Now());
+    {
+      ScopedControlClock scoped_inner{inner_clock};
+      EXPECT_EQ(GetControlClock(), &inner_clock);
+      EXPECT_EQ(ControlClockNow(), inner_clock.Now());
+    }
+    EXPECT_EQ(GetControlClock(), &outer_clock);
+  }
+  EXPECT_EQ(GetControlClock(), nullptr);
+
+  // Without an installed clock, the steady clock is used
+  auto before = std::chrono::steady_clock::now();
+  auto now = ControlClockNow();
+  EXPECT_GE(now, before);
+  EXPECT_LE(now, std::chrono::steady_clock::now());
+}
+
+TEST_F(ControlClockTest, DeadlineTimer)
+{
+  ManualControlClock clock;
+  ScopedControlClock scoped_clock{clock};
+  DeadlineTimer timer;
+  timer.Start(3600.0);
+  EXPECT_FALSE(timer.IsExpired());
+  EXPECT_EQ(timer.GetTimeRemaining(), std::chrono::hours(1));
+
+  clock.Advance(std::chrono::minutes(59));
+  EXPECT_FALSE(timer.IsExpired());
+  EXPECT_EQ(timer.GetTimeRemaining(), std::chrono::minutes(1));
+
+  clock.Advance(std::chrono::minutes(1));
+  EXPECT_TRUE(timer.IsExpired());
+  EXPECT_EQ(timer.GetTimeRemaining(), ControlClock::Clock::duration::zero());
+}
+
+TEST_F(ControlClockTest, ConditionDebouncer)
+{
+  ManualControlClock clock;
+  ScopedControlClock scoped_clock{clock};
+  ConditionDebouncer debouncer;
+  debouncer.SetStableDuration(60.0);
+  EXPECT_EQ(debouncer.Update(ExecutionStatus::SUCCESS), ExecutionStatus::RUNNING);
+  clock.Advance(std::chrono::seconds(59));
+  EXPECT_EQ(debouncer.Update(ExecutionStatus::SUCCESS), ExecutionStatus::RUNNING);
+  clock.Advance(std::chrono::seconds(1));
+  EXPECT_EQ(debouncer.Update(ExecutionStatus::SUCCESS), ExecutionStatus::SUCCESS);
+}
@@ -0,0 +1,194 @@
+/******************************************************************************
+* $HeadURL: $
+* $Id: $
+*
+* Project       : Supervision and Automation - oac-tree
+*
+* Description   : SUP oac-tree control plugin
+*
+* Author        : Walter Van Herck (IO)
+*
+* Copyright (c) : 2010-2026 ITER Organization,
+*                 CS 90 046
+*                 13067 St. Paul-lez-Durance Cedex
+*                 France
+* SPDX-License-Identifier: MIT
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file LICENSE located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+
+#include "test_user_interface.h"
+#include "unit_test_helper.h"
+
+#include "oac-tree/control/control_metrics.h"
+
+#include <sup/oac-tree/sequence_parser.h>
+
+#include <gtest/gtest.h>
+
+using namespace sup::oac_tree;
+
+class ControlMetricsTest : public ::testing::Test
+{
+protected:
+  ControlMetricsTest() = default;
+  virtual ~ControlMetricsTest() = default;
+
+  test::ScopedControlMetrics m_metrics_enabled;
+};
+
+TEST_F(ControlMetricsTest, Counters)
+{
+  ControlMetrics metrics;
+  auto snapshot = metrics.GetSnapshot();
+  EXPECT_EQ(snapshot.m_ticks, 0);
+  EXPECT_EQ(snapshot.m_max_tick_latency, ControlMetrics::Clock::duration::zero());
+
+  metrics.RecordTick(std::chrono::milliseconds(5));
+  metrics.RecordTick(std::chrono::milliseconds(2));
+  metrics.RecordConditionEvaluation(std::chrono::milliseconds(1));
+  metrics.RecordConditionEvaluation(std::chrono::milliseconds(1));
+  metrics.RecordActionTick(std::chrono::milliseconds(3), true);
+  metrics.RecordActionTick(std::chrono::milliseconds(4), false);
+  metrics.RecordRetry();
+  metrics.RecordTimeout();
+  snapshot = metrics.GetSnapshot();
+  EXPECT_EQ(snapshot.m_ticks, 2);
+  EXPECT_EQ(snapshot.m_condition_evaluations, 2);
+  EXPECT_EQ(snapshot.m_action_runs, 1);
+  EXPECT_EQ(snapshot.m_retries, 1);
+  EXPECT_EQ(snapshot.m_timeouts, 1);
+  EXPECT_EQ(snapshot.m_condition_time, std::chrono::milliseconds(2));
+  EXPECT_EQ(snapshot.m_action_time, std::chrono::milliseconds(7));
+  EXPECT_EQ(snapshot.m_max_tick_latency, std::chrono::milliseconds(5));
+
+  metrics.Clear();
+  snapshot = metrics.GetSnapshot();
+  EXPECT_EQ(snapshot.m_ticks, 0);
+  EXPECT_EQ(snapshot.m_action_runs, 0);
+  EXPECT_EQ(snapshot.m_action_time, ControlMetrics::Clock::duration::zero());
+}
+
+TEST_F(ControlMetricsTest, ScopedTimer)
+{
+  ControlMetrics metrics;
+  {
+    ScopedMetricsTimer timer{metrics, ControlMetrics::Section::kCondition};
+  }
+  {
+    ScopedMetricsTimer timer{metrics, ControlMetrics::Section::kTick};
+  }
+  auto snapshot = metrics.GetSnapshot();
+  EXPECT_EQ(snapshot.m_condition_evaluations, 1);
+  EXPECT_EQ(snapshot.m_ticks, 1);
+  EXPECT_EQ(snapshot.m_action_runs, 0);
+}
+
+TEST_F(ControlMetricsTest, Disabled)
+{
+  SetControlMetricsEnabled(false);
+  EXPECT_FALSE(ControlMetrics::IsActive());
+  ControlMetrics metrics;
+  {
+    ScopedMetricsTimer timer{metrics, ControlMetrics::Section::kTick};
+  }
+  EXPECT_EQ(metrics.GetSnapshot().m_ticks, 0);
+
+  const std::string body{R"(
+    <AchieveCondition>
+        <Equals leftVar="live" rightVar="one"/>
+        <Copy inputVar="one" outputVar="live"/>
+    </AchieveCondition>
+    <Workspace>
+        <Local name="live" type='{"type":"uint64"}' value='0' />
+        <Local name="one" type='{"type":"uint64"}' value='1' />
+    </Workspace>
+)"};
+
+  test::NullUserInterface ui;
+  auto proc = ParseProcedureString(test::CreateProcedureString(body));
+  EXPECT_TRUE(test::TryAndExecute(proc, ui));
+
+  auto entries = CollectControlMetrics(*proc->RootInstruction());
+  ASSERT_EQ(entries.size(), 1);
+  EXPECT_EQ(entries[0].m_metrics.m_ticks, 0);
+  EXPECT_EQ(entries[0].m_metrics.m_condition_evaluations, 0);
+  EXPECT_EQ(entries[0].m_metrics.m_action_runs, 0);
+}
+
+TEST_F(ControlMetricsTest, CollectFromProcedure)
+{
+  const std::string body{R"(
+    <Sequence>
+        <AchieveCondition executionMode="native">
+            <Equals leftVar="live" rightVar="one"/>
+            <Copy inputVar="one" outputVar="live"/>
+        </AchieveCondition>
+        <WaitForCondition timeout="0.05">
+            <Equals leftVar="live" rightVar="zero"/>
+        </WaitForCondition>
+    </Sequence>
+    <Workspace>
+        <Local name="live" type='{"type":"uint64"}' value='0' />
+        <Local name="zero" type='{"type":"uint64"}' value='0' />
+        <Local name="one" type='{"type":"uint64"}' value='1' />
+    </Workspace>
+)"};
+
+  test::NullUserInterface ui;
+  auto proc = ParseProcedureString(test::CreateProcedureString(body));
+  EXPECT_TRUE(test::TryAndExecute(proc, ui, ExecutionStatus::FAILURE));
+
+  // Metrics are cumulative and survive the reset of the procedure
+  auto root = proc->RootInstruction();
+  ASSERT_NE(root, nullptr);
+  auto entries = CollectControlMetrics(*root);
+  ASSERT_EQ(entries.size(), 2);
+
+  EXPECT_EQ(entries[0].m_instruction->GetType(), "AchieveCondition");
+  const auto& achieve = entries[0].m_metrics;
+  EXPECT_GE(achieve.m_ticks, 2);
+  // Initial evaluation and re-check after the action
+  EXPECT_EQ(achieve.m_condition_evaluations, 2);
+  EXPECT_EQ(achieve.m_action_runs, 1);
+  EXPECT_EQ(achieve.m_timeouts, 0);
+  EXPECT_GE(achieve.m_max_tick_latency, ControlMetrics::Clock::duration::zero());
+
+  EXPECT_EQ(entries[1].m_instruction->GetType(), "WaitForCondition");
+  const auto& wait = entries[1].m_metrics;
+  EXPECT_GE(wait.m_condition_evaluations, 1);
+  EXPECT_EQ(wait.m_action_runs, 0);
+  EXPECT_EQ(wait.m_timeouts, 1);
+
+  auto text = FormatControlMetrics(entries);
+  EXPECT_NE(text.find("AchieveCondition: ticks="), std::string::npos);
+  EXPECT_NE(text.find("WaitForCondition: ticks="), std::string::npos);
+  EXPECT_NE(text.find("timeouts=1"), std::string::npos);
+}
+
+TEST_F(ControlMetricsTest, ComposedAchieveCondition)
+{
+  const std::string body{R"(
+    <AchieveCondition>
+        <Equals leftVar="live" rightVar="one"/>
+        <Copy inputVar="one" outputVar="live"/>
+    </AchieveCondition>
+    <Workspace>
+        <Local name="live" type='{"type":"uint64"}' value='0' />
+        <Local name="one" type='{"type":"uint64"}' value='1' />
+    </Workspace>
+)"};
+
+  test::NullUserInterface ui;
+  auto proc = ParseProcedureString(test::CreateProcedureString(body));
+  EXPECT_TRUE(test::TryAndExecute(proc, ui));
+
+  auto entries = CollectControlMetrics(*proc->RootInstruction());
+  ASSERT_EQ(entries.size(), 1);
+  EXPECT_GE(entries[0].m_metrics.m_condition_evaluations, 1);
+  EXPECT_EQ(entries[0].m_metrics.m_action_runs, 1);
+}
@@ -0,0 +1,147 @@
+/******************************************************************************
+* $HeadURL: $
+* $Id: $
+*
+* Project       : Supervision and Automation - oac-tree
+*
+* Description   : SUP oac-tree control plugin
+*
+* Author        : Walter Van Herck (IO)
+*
+* Copyright (c) : 2010-2026 ITER Organization,
+*                 CS 90 046
+*                 13067 St. Paul-lez-Durance Cedex
+*                 France
+* SPDX-License-Identifier: MIT
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file LICENSE located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+
+#include "oac-tree/control/control_trace.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <thread>
+
+using namespace sup::oac_tree;
+
+const std::string kTraceFilename = "control_trace_test.json";
+
+class ControlTraceTest : public ::testing::Test
+{
+protected:
+  ControlTraceTest() = default;
+  virtual ~ControlTraceTest();
+
+  static std::string ReadTraceFile();
+};
+
+TEST_F(ControlTraceTest, DisabledByDefault)
+{
+  if (std::getenv(CONTROL_TRACE_FILE_ENVIRONMENT_VARIABLE.c_str()) == nullptr)
+  {
+    EXPECT_EQ(GetControlTraceSink(), nullptr);
+  }
+}
+
+TEST_F(ControlTraceTest, WriteEvents)
+{
+  {
+    ControlTraceSink sink{kTraceFilename};
+    auto now = ControlTraceSink::Clock::now();
+    sink.AddCompleteEvent("AchieveCondition [\"quoted\"]", "condition", now,
+                          std::chrono::microseconds(250));
+    sink.AddInstantEvent("WaitForCondition", "timeout", now);
+    EXPECT_EQ(sink.GetEventCount(), 2);
+    EXPECT_TRUE(sink.Flush());
+  }
+  auto trace = ReadTraceFile();
+  EXPECT_EQ(trace.find("{\"traceEvents\":["), 0);
+  EXPECT_NE(trace.find(R"("name":"AchieveCondition [\"quoted\"]","cat":"condition","ph":"X")"),
+            std::string::npos);
+  EXPECT_NE(trace.find(R"("dur":250)"), std::string::npos);
+  EXPECT_NE(trace.find(R"("name":"WaitForCondition","cat":"timeout","ph":"i")"),
+            std::string::npos);
+}
+
+TEST_F(ControlTraceTest, WriteOnDestruction)
+{
+  {
+    ControlTraceSink sink{kTraceFilename};
+    sink.AddInstantEvent("ExecuteWhile", "timeout", ControlTraceSink::Clock::now());
+  }
+  auto trace = ReadTraceFile();
+  EXPECT_NE(trace.find(R"("name":"ExecuteWhile")"), std::string::npos);
+}
+
+TEST_F(ControlTraceTest, WriteInChunks)
+{
+  ControlTraceSink sink{kTraceFilename};
+  EXPECT_FALSE(sink.TracesTicks());
+  auto now = ControlTraceSink::Clock::now();
+  for (std::size_t idx = 0; idx + 1u < ControlTraceSink::kChunkSize; ++idx)
+  {
+    sink.AddCompleteEvent("ExecuteWhile", "condition", now, std::chrono::microseconds(1));
+  }
+  EXPECT_EQ(sink.GetBufferedEventCount(), ControlTraceSink::kChunkSize - 1u);
+  EXPECT_EQ(ReadTraceFile().find("ExecuteWhile"), std::string::npos);
+
+  // A full chunk is written without explicit flush and the file is complete
+  sink.AddCompleteEvent("ExecuteWhile", "condition", now, std::chrono::microseconds(1));
+  EXPECT_EQ(sink.GetBufferedEventCount(), 0);
+  EXPECT_EQ(sink.GetEventCount(), ControlTraceSink::kChunkSize);
+  auto trace = ReadTraceFile();
+  EXPECT_NE(trace.find("ExecuteWhile"), std::string::npos);
+  EXPECT_NE(trace.find(R"(],"displayTimeUnit":"ms"})"), std::string::npos);
+
+  // Events older than a second are not kept in the buffer
+  sink.AddInstantEvent("RetryUntil", "timeout", now);
+  EXPECT_EQ(sink.GetBufferedEventCount(), 1);
+  sink.AddInstantEvent("RetryUntil", "timeout", now + std::chrono::seconds(2));
+  EXPECT_EQ(sink.GetBufferedEventCount(), 0);
+}
+
+TEST_F(ControlTraceTest, ThreadIds)
+{
+  {
+    ControlTraceSink sink{kTraceFilename};
+    auto now = ControlTraceSink::Clock::now();
+    std::thread other{[&sink, now]() { sink.AddInstantEvent("Other", "timeout", now); }};
+    other.join();
+    sink.AddInstantEvent("Main", "timeout", now);
+  }
+  auto trace = ReadTraceFile();
+  auto other_tid = trace.find("\"tid\":", trace.find("Other"));
+  auto main_tid = trace.find("\"tid\":", trace.find("Main"));
+  ASSERT_NE(other_tid, std::string::npos);
+  ASSERT_NE(main_tid, std::string::npos);
+  EXPECT_NE(trace.substr(other_tid, trace.find('}', other_tid) - other_tid),
+            trace.substr(main_tid, trace.find('}', main_tid) - main_tid));
+}
+
+TEST_F(ControlTraceTest, UnwritableFile)
+{
+  ControlTraceSink sink{"/nonexistent_directory/trace.json"};
+  EXPECT_FALSE(sink.Flush());
+}
+
+ControlTraceTest::~ControlTraceTest()
+{
+  (void)std::remove(kTraceFilename.c_str());
+}
+
+std::string ControlTraceTest::ReadTraceFile()
+{
+  std::ifstream in{kTraceFilename};
+  std::ostringstream oss;
+  oss << in.rdbuf();
+  return oss.str();
+}
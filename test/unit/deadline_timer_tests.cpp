@@ -0,0 +1,118 @@
+/******************************************************************************
+* $HeadURL: $
+* $Id: $
+*
+* Project       : Supervision and Automation - oac-tree
+*
+* Description   : SUP oac-tree control plugin
+*
+* Author        : Walter Van Herck (IO)
+*
+* Copyright (c) : 2010-2026 ITER Organization,
+*                 CS 90 046
+*                 13067 St. Paul-lez-Durance Cedex
+*                 France
+* SPDX-License-Identifier: MIT
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file LICENSE located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+
+#include "oac-tree/control/deadline_timer.h"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <limits>
+
+using namespace sup::oac_tree;
+
+class DeadlineTimerTest : public ::testing::Test
+{
+protected:
+  DeadlineTimerTest() = default;
+  virtual ~DeadlineTimerTest() = default;
+};
+
+TEST_F(DeadlineTimerTest, NotStarted)
+{
+  DeadlineTimer timer;
+  EXPECT_FALSE(timer.IsStarted());
+  EXPECT_FALSE(timer.IsExpired());
+  EXPECT_EQ(timer.GetTimeRemaining(), DeadlineTimer::Clock::duration::zero());
+  EXPECT_EQ(timer.GetExpiryLatency(), DeadlineTimer::Clock::duration::zero());
+}
+
+TEST_F(DeadlineTimerTest, DeadlineComparison)
+{
+  DeadlineTimer timer;
+  timer.Start(std::chrono::seconds(10));
+  EXPECT_TRUE(timer.IsStarted());
+  auto deadline = timer.GetDeadline();
+  EXPECT_FALSE(timer.IsExpired(deadline - std::chrono::nanoseconds(1)));
+  EXPECT_EQ(timer.GetTimeRemaining(deadline - std::chrono::milliseconds(3)),
+            std::chrono::milliseconds(3));
+  EXPECT_TRUE(timer.IsExpired(deadline + std::chrono::microseconds(20)));
+  EXPECT_EQ(timer.GetExpiryLatency(), std::chrono::microseconds(20));
+  // Expiration is sticky and the latency of the first observation is kept
+  EXPECT_TRUE(timer.IsExpired(deadline));
+  EXPECT_EQ(timer.GetExpiryLatency(), std::chrono::microseconds(20));
+  EXPECT_EQ(timer.GetTimeRemaining(), DeadlineTimer::Clock::duration::zero());
+
+  timer.Stop();
+  EXPECT_FALSE(timer.IsStarted());
+  EXPECT_FALSE(timer.IsExpired(deadline + std::chrono::seconds(1)));
+}
+
+TEST_F(DeadlineTimerTest, SubMillisecondTimeout)
+{
+  DeadlineTimer timer;
+  auto start = DeadlineTimer::Clock::now();
+  timer.Start(0.0002);
+  EXPECT_LE(timer.GetDeadline() - start, std::chrono::microseconds(200) +
+                                         (DeadlineTimer::Clock::now() - start));
+  EXPECT_GE(timer.GetDeadline() - start, std::chrono::microseconds(200));
+  while (!timer.IsExpired())
+  {}
+  auto end = DeadlineTimer::Clock::now();
+  EXPECT_GE(end - start, std::chrono::microseconds(200));
+  EXPECT_LE(timer.GetExpiryLatency(), end - timer.GetDeadline());
+}
+
+TEST_F(DeadlineTimerTest, InvalidTimeouts)
+{
+  DeadlineTimer timer;
+  timer.Start(-1.0);
+  EXPECT_TRUE(timer.IsExpired());
+  timer.Start(std::numeric_limits<double>::quiet_NaN());
+  EXPECT_TRUE(timer.IsExpired());
+  timer.Start(std::chrono::seconds(-1));
+  EXPECT_TRUE(timer.IsExpired());
+}
+
+TEST_F(DeadlineTimerTest, VeryLargeTimeouts)
+{
+  // Timeouts beyond the range of the clock are clamped to the latest representable deadline
+  const auto max_deadline = DeadlineTimer::Clock::time_point::max();
+  DeadlineTimer timer;
+  for (double timeout_sec : {1e10, 1e300, std::numeric_limits<double>::max(),
+                             std::numeric_limits<double>::infinity()})
+  {
+    timer.Start(timeout_sec);
+    EXPECT_EQ(timer.GetDeadline(), max_deadline);
+    EXPECT_FALSE(timer.IsExpired());
+    EXPECT_GT(timer.GetTimeRemaining(), std::chrono::hours(24 * 365));
+  }
+  timer.Start(DeadlineTimer::Clock::duration::max());
+  EXPECT_EQ(timer.GetDeadline(), max_deadline);
+  EXPECT_FALSE(timer.IsExpired());
+
+  // Large timeouts within range are kept
+  timer.Start(1e6);
+  EXPECT_LT(timer.GetDeadline(), max_deadline);
+  EXPECT_GE(timer.GetTimeRemaining(), std::chrono::seconds(999999));
+  EXPECT_FALSE(timer.IsExpired());
+}
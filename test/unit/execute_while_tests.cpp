@@ -20,14 +20,22 @@
 * of the distribution package.
 ******************************************************************************/
 
+#include "test_instructions.h"
 #include "test_user_interface.h"
 #include "unit_test_helper.h"
 
+#include "oac-tree/control/execute_while_instruction.h"
+
 #include <sup/oac-tree/instruction_registry.h>
+#include <sup/oac-tree/procedure.h>
 #include <sup/oac-tree/sequence_parser.h>
+#include <sup/oac-tree/workspace.h>
 
 #include <gtest/gtest.h>
 
+#include <chrono>
+#include <thread>
+
 using namespace sup::oac_tree;
 
 class ExecuteWhileTest : public ::testing::Test
@@ -55,6 +63,44 @@ TEST_F(ExecuteWhileTest, Success)
   EXPECT_TRUE(test::TryAndExecute(proc, ui));
 }
 
+TEST_F(ExecuteWhileTest, UserInterfaceSwitchedDuringAction)
+{
+  // The asynchronous action keeps using the wrapped UserInterface it was started with, which
+  // stays valid after the UserInterface changes
+  const std::string body{R"(
+    <ExecuteWhile>
+        <Sequence>
+            <Wait timeout="0.1"/>
+            <Inverter>
+                <Wait timeout="@missing"/>
+            </Inverter>
+        </Sequence>
+        <Equals leftVar="live" rightVar="zero"/>
+    </ExecuteWhile>
+    <Workspace>
+        <Local name="live" type='{"type":"uint64"}' value='0' />
+        <Local name="zero" type='{"type":"uint64"}' value='0' />
+    </Workspace>
+)"};
+
+  test::LogUserInterface ui_1;
+  test::LogUserInterface ui_2;
+  auto proc = ParseProcedureString(test::CreateProcedureString(body));
+  ASSERT_TRUE(proc);
+  ASSERT_NO_THROW(proc->Setup());
+  proc->ExecuteSingle(ui_1);
+  EXPECT_EQ(proc->GetStatus(), ExecutionStatus::RUNNING);
+  const std::size_t kMaxTicks = 1000;
+  for (std::size_t idx = 0; idx < kMaxTicks && !IsFinishedStatus(proc->GetStatus()); ++idx)
+  {
+    proc->ExecuteSingle(idx % 2 == 0 ? ui_2 : ui_1);
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  EXPECT_EQ(proc->GetStatus(), ExecutionStatus::SUCCESS);
+  EXPECT_FALSE(ui_1.GetLogEntries().empty() && ui_2.GetLogEntries().empty());
+  proc->Reset(ui_1);
+}
+
 TEST_F(ExecuteWhileTest, Setup)
 {
   {
@@ -124,3 +170,366 @@ TEST_F(ExecuteWhileTest, Failure)
   auto proc = ParseProcedureString(test::CreateProcedureString(body));
   EXPECT_TRUE(test::TryAndExecute(proc, ui, ExecutionStatus::FAILURE));
 }
+
+TEST_F(ExecuteWhileTest, WorkerPoolSuccess)
+{
+  const std::string body{R"(
+    <ExecuteWhile executionMode="workerPool">
+        <Wait timeout="0.2"/>
+        <Equals leftVar="live" rightVar="zero"/>
+    </ExecuteWhile>
+    <Workspace>
+        <Local name="live" type='{"type":"uint64"}' value='0' />
+        <Local name="zero" type='{"type":"uint64"}' value='0' />
+    </Workspace>
+)"};
+
+  test::NullUserInterface ui;
+  auto proc = ParseProcedureString(test::CreateProcedureString(body));
+  EXPECT_TRUE(test::TryAndExecute(proc, ui));
+}
+
+TEST_F(ExecuteWhileTest, WorkerPoolFailure)
+{
+  const std::string body{R"(
+    <ParallelSequence successThreshold="1">
+        <ExecuteWhile executionMode="workerPool">
+            <Wait timeout="1.0"/>
+            <Equals leftVar="live" rightVar="zero"/>
+        </ExecuteWhile>
+        <Inverter>
+            <Sequence>
+                <Wait timeout="0.1"/>
+                <Copy inputVar="one" outputVar="live"/>
+            </Sequence>
+        </Inverter>
+    </ParallelSequence>
+    <Workspace>
+        <Local name="live" type='{"type":"uint64"}' value='0' />
+        <Local name="zero" type='{"type":"uint64"}' value='0' />
+        <Local name="one" type='{"type":"uint64"}' value='1' />
+    </Workspace>
+)"};
+
+  test::NullUserInterface ui;
+  auto proc = ParseProcedureString(test::CreateProcedureString(body));
+  EXPECT_TRUE(test::TryAndExecute(proc, ui, ExecutionStatus::FAILURE));
+}
+
+TEST_F(ExecuteWhileTest, WorkerPoolFailingAction)
+{
+  const std::string body{R"(
+    <ExecuteWhile executionMode="workerPool">
+        <Fail/>
+        <Equals leftVar="live" rightVar="zero"/>
+    </ExecuteWhile>
+    <Workspace>
+        <Local name="live" type='{"type":"uint64"}' value='0' />
+        <Local name="zero" type='{"type":"uint64"}' value='0' />
+    </Workspace>
+)"};
+
+  test::NullUserInterface ui;
+  auto proc = ParseProcedureString(test::CreateProcedureString(body));
+  EXPECT_TRUE(test::TryAndExecute(proc, ui, ExecutionStatus::FAILURE));
+}
+
+TEST_F(ExecuteWhileTest, WorkerPoolRepeat)
+{
+  const std::string body{R"(
+    <Repeat maxCount="20">
+        <ExecuteWhile executionMode="workerPool">
+            <Copy inputVar="zero" outputVar="live"/>
+            <Equals leftVar="live" rightVar="zero"/>
+        </ExecuteWhile>
+    </Repeat>
+    <Workspace>
+        <Local name="live" type='{"type":"uint64"}' value='0' />
+        <Local name="zero" type='{"type":"uint64"}' value='0' />
+    </Workspace>
+)"};
+
+  test::NullUserInterface ui;
+  auto proc = ParseProcedureString(test::CreateProcedureString(body));
+  EXPECT_TRUE(test::TryAndExecute(proc, ui));
+}
+
+TEST_F(ExecuteWhileTest, WorkerPoolNested)
+{
+  // More nested levels than workers in the pool
+  std::string action = R"(<Copy inputVar="zero" outputVar="live"/>)";
+  for (int idx = 0; idx < 12; ++idx)
+  {
+    action = R"(<ExecuteWhile executionMode="workerPool">)" + action
+             + R"(<Equals leftVar="live" rightVar="zero"/></ExecuteWhile>)";
+  }
+  const std::string body = action + R"(
+    <Workspace>
+        <Local name="live" type='{"type":"uint64"}' value='0' />
+        <Local name="zero" type='{"type":"uint64"}' value='0' />
+    </Workspace>
+)";
+
+  test::NullUserInterface ui;
+  auto proc = ParseProcedureString(test::CreateProcedureString(body));
+  EXPECT_TRUE(test::TryAndExecute(proc, ui));
+}
+
+TEST_F(ExecuteWhileTest, InterleavedSuccess)
+{
+  const std::string body{R"(
+    <ExecuteWhile executionMode="interleaved">
+        <Wait timeout="0.2"/>
+        <Equals leftVar="live" rightVar="zero"/>
+    </ExecuteWhile>
+    <Workspace>
+        <Local name="live" type='{"type":"uint64"}' value='0' />
+        <Local name="zero" type='{"type":"uint64"}' value='0' />
+    </Workspace>
+)"};
+
+  test::NullUserInterface ui;
+  auto proc = ParseProcedureString(test::CreateProcedureString(body));
+  EXPECT_TRUE(test::TryAndExecute(proc, ui));
+}
+
+TEST_F(ExecuteWhileTest, InterleavedFailure)
+{
+  const std::string body{R"(
+    <ParallelSequence successThreshold="1">
+        <ExecuteWhile executionMode="interleaved">
+            <Wait timeout="1.0"/>
+            <Equals leftVar="live" rightVar="zero"/>
+        </ExecuteWhile>
+        <Inverter>
+            <Sequence>
+                <Wait timeout="0.1"/>
+                <Copy inputVar="one" outputVar="live"/>
+            </Sequence>
+        </Inverter>
+    </ParallelSequence>
+    <Workspace>
+        <Local name="live" type='{"type":"uint64"}' value='0' />
+        <Local name="zero" type='{"type":"uint64"}' value='0' />
+        <Local name="one" type='{"type":"uint64"}' value='1' />
+    </Workspace>
+)"};
+
+  test::NullUserInterface ui;
+  auto proc = ParseProcedureString(test::CreateProcedureString(body));
+  EXPECT_TRUE(test::TryAndExecute(proc, ui, ExecutionStatus::FAILURE));
+}
+
+TEST_F(ExecuteWhileTest, InterleavedConditionCheckedBeforeAction)
+{
+  // The action invalidates the condition: it may only run once, since the condition is checked
+  // again before the next action tick.
+  const std::string body{R"(
+    <ExecuteWhile executionMode="interleaved">
+        <Sequence>
+            <Copy inputVar="one" outputVar="live"/>
+            <Wait timeout="0.1"/>
+        </Sequence>
+        <Equals leftVar="live" rightVar="zero"/>
+    </ExecuteWhile>
+    <Workspace>
+        <Local name="live" type='{"type":"uint64"}' value='0' />
+        <Local name="zero" type='{"type":"uint64"}' value='0' />
+        <Local name="one" type='{"type":"uint64"}' value='1' />
+    </Workspace>
+)"};
+
+  test::NullUserInterface ui;
+  auto proc = ParseProcedureString(test::CreateProcedureString(body));
+  EXPECT_TRUE(test::TryAndExecute(proc, ui, ExecutionStatus::FAILURE));
+}
+
+TEST_F(ExecuteWhileTest, InterleavedRepeat)
+{
+  const std::string body{R"(
+    <Repeat maxCount="20">
+        <ExecuteWhile executionMode="interleaved">
+            <Copy inputVar="zero" outputVar="live"/>
+            <Equals leftVar="live" rightVar="zero"/>
+        </ExecuteWhile>
+    </Repeat>
+    <Workspace>
+        <Local name="live" type='{"type":"uint64"}' value='0' />
+        <Local name="zero" type='{"type":"uint64"}' value='0' />
+    </Workspace>
+)"};
+
+  test::NullUserInterface ui;
+  auto proc = ParseProcedureString(test::CreateProcedureString(body));
+  EXPECT_TRUE(test::TryAndExecute(proc, ui));
+}
+
+TEST_F(ExecuteWhileTest, ConditionPeriod)
+{
+  ExecuteWhileInstruction instr;
+  auto action = GlobalInstructionRegistry().Create(test::RunningAction::Type);
+  auto counting_condition = GlobalInstructionRegistry().Create(test::CountingCondition::Type);
+  auto condition = GlobalInstructionRegistry().Create("Inverter");
+  ASSERT_TRUE(action);
+  ASSERT_TRUE(counting_condition);
+  ASSERT_TRUE(condition);
+  // The counting condition fails, since the variable is not present in the workspace
+  ASSERT_TRUE(counting_condition->AddAttribute("varName", "live"));
+  ASSERT_TRUE(condition->InsertInstruction(std::move(counting_condition), 0));
+  ASSERT_TRUE(instr.InsertInstruction(std::move(action), 0));
+  ASSERT_TRUE(instr.InsertInstruction(std::move(condition), 1));
+  ASSERT_TRUE(instr.AddAttribute("executionMode", "interleaved"));
+  ASSERT_TRUE(instr.AddAttribute("conditionPeriod", "100.0"));
+  Procedure proc;
+  ASSERT_NO_THROW(instr.Setup(proc));
+
+  test::NullUserInterface ui;
+  Workspace ws;
+  test::CountingCondition::ResetExecutionCount();
+  for (int i = 0; i < 5; ++i)
+  {
+    instr.ExecuteSingle(ui, ws);
+  }
+  EXPECT_EQ(instr.GetStatus(), ExecutionStatus::RUNNING);
+  EXPECT_EQ(instr.GetConditionEvaluationCount(), 1);
+  EXPECT_EQ(instr.GetSkippedConditionEvaluationCount(), 4);
+  EXPECT_EQ(test::CountingCondition::GetExecutionCount(), 1);
+
+  // Reset discards the cached outcome of the condition
+  instr.Halt(ui);
+  instr.Reset(ui);
+  instr.ExecuteSingle(ui, ws);
+  EXPECT_EQ(instr.GetConditionEvaluationCount(), 2);
+  EXPECT_EQ(instr.GetSkippedConditionEvaluationCount(), 4);
+}
+
+TEST_F(ExecuteWhileTest, ConditionPeriodAsync)
+{
+  const std::string body{R"(
+    <ExecuteWhile conditionPeriod="0.05">
+        <Wait timeout="0.2"/>
+        <Equals leftVar="live" rightVar="zero"/>
+    </ExecuteWhile>
+    <Workspace>
+        <Local name="live" type='{"type":"uint64"}' value='0' />
+        <Local name="zero" type='{"type":"uint64"}' value='0' />
+    </Workspace>
+)"};
+
+  test::NullUserInterface ui;
+  auto proc = ParseProcedureString(test::CreateProcedureString(body));
+  EXPECT_TRUE(test::TryAndExecute(proc, ui));
+}
+
+TEST_F(ExecuteWhileTest, ConditionPeriodFailure)
+{
+  // The condition becomes false while its last outcome is cached: this is only detected at the
+  // next evaluation, but still before the action finishes.
+  const std::string body{R"(
+    <ParallelSequence successThreshold="1">
+        <ExecuteWhile executionMode="interleaved" conditionPeriod="0.05">
+            <Wait timeout="1.0"/>
+            <Equals leftVar="live" rightVar="zero"/>
+        </ExecuteWhile>
+        <Inverter>
+            <Sequence>
+                <Wait timeout="0.1"/>
+                <Copy inputVar="one" outputVar="live"/>
+            </Sequence>
+        </Inverter>
+    </ParallelSequence>
+    <Workspace>
+        <Local name="live" type='{"type":"uint64"}' value='0' />
+        <Local name="zero" type='{"type":"uint64"}' value='0' />
+        <Local name="one" type='{"type":"uint64"}' value='1' />
+    </Workspace>
+)"};
+
+  test::NullUserInterface ui;
+  auto proc = ParseProcedureString(test::CreateProcedureString(body));
+  EXPECT_TRUE(test::TryAndExecute(proc, ui, ExecutionStatus::FAILURE));
+}
+
+TEST_F(ExecuteWhileTest, NegativeConditionPeriod)
+{
+  const std::string body{R"(
+    <ExecuteWhile conditionPeriod="-1.0">
+        <Wait timeout="0.2"/>
+        <Equals leftVar="live" rightVar="zero"/>
+    </ExecuteWhile>
+    <Workspace>
+        <Local name="live" type='{"type":"uint64"}' value='0' />
+        <Local name="zero" type='{"type":"uint64"}' value='0' />
+    </Workspace>
+)"};
+
+  auto proc = ParseProcedureString(test::CreateProcedureString(body));
+  EXPECT_THROW(proc->Setup(), InstructionSetupException);
+}
+
+TEST_F(ExecuteWhileTest, UnknownExecutionMode)
+{
+  const std::string body{R"(
+    <ExecuteWhile executionMode="unknown">
+        <Wait timeout="0.2"/>
+        <Equals leftVar="live" rightVar="zero"/>
+    </ExecuteWhile>
+    <Workspace>
+        <Local name="live" type='{"type":"uint64"}' value='0' />
+        <Local name="zero" type='{"type":"uint64"}' value='0' />
+    </Workspace>
+)"};
+
+  auto proc = ParseProcedureString(test::CreateProcedureString(body));
+  EXPECT_THROW(proc->Setup(), InstructionSetupException);
+}
+
+TEST_F(ExecuteWhileTest, StableCount)
+{
+  // The action only starts after the condition held for three ticks
+  const std::string body{R"(
+    <ExecuteWhile executionMode="interleaved" stableCount="3">
+        <Copy inputVar="zero" outputVar="live"/>
+        <CountingCondition varName="one"/>
+    </ExecuteWhile>
+    <Workspace>
+        <Local name="live" type='{"type":"uint64"}' value='1' />
+        <Local name="zero" type='{"type":"uint64"}' value='0' />
+        <Local name="one" type='{"type":"uint64"}' value='1' />
+    </Workspace>
+)"};
+
+  test::NullUserInterface ui;
+  test::CountingCondition::ResetExecutionCount();
+  auto proc = ParseProcedureString(test::CreateProcedureString(body));
+  EXPECT_TRUE(test::TryAndExecute(proc, ui));
+  EXPECT_EQ(test::CountingCondition::GetExecutionCount(), 3);
+}
+
+TEST_F(ExecuteWhileTest, StableForFailure)
+{
+  // The action is interrupted once the condition failed for long enough
+  const std::string body{R"(
+    <ParallelSequence>
+        <ExecuteWhile stableFor="0.05">
+            <Wait timeout="10.0"/>
+            <Equals leftVar="live" rightVar="one"/>
+        </ExecuteWhile>
+        <Sequence>
+            <Wait timeout="0.1"/>
+            <Copy inputVar="zero" outputVar="live"/>
+        </Sequence>
+    </ParallelSequence>
+    <Workspace>
+        <Local name="live" type='{"type":"uint64"}' value='1' />
+        <Local name="zero" type='{"type":"uint64"}' value='0' />
+        <Local name="one" type='{"type":"uint64"}' value='1' />
+    </Workspace>
+)"};
+
+  test::NullUserInterface ui;
+  auto proc = ParseProcedureString(test::CreateProcedureString(body));
+  auto start = std::chrono::steady_clock::now();
+  EXPECT_TRUE(test::TryAndExecute(proc, ui, ExecutionStatus::FAILURE));
+  EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(5));
+}
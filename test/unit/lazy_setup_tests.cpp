@@ -0,0 +1,211 @@
+/******************************************************************************
+* $HeadURL: $
+* $Id: $
+*
+* Project       : Supervision and Automation - oac-tree
+*
+* Description   : SUP oac-tree control plugin
+*
+* Author        : Walter Van Herck (IO)
+*
+* Copyright (c) : 2010-2026 ITER Organization,
+*                 CS 90 046
+*                 13067 St. Paul-lez-Durance Cedex
+*                 France
+* SPDX-License-Identifier: MIT
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file LICENSE located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+
+#include "test_user_interface.h"
+#include "unit_test_helper.h"
+
+#include "oac-tree/control/lazy_setup.h"
+
+#include <sup/oac-tree/exceptions.h>
+#include <sup/oac-tree/instruction_registry.h>
+#include <sup/oac-tree/procedure.h>
+#include <sup/oac-tree/sequence_parser.h>
+
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace sup::oac_tree;
+
+class LazySetupTest : public ::testing::Test
+{
+protected:
+  LazySetupTest() = default;
+  virtual ~LazySetupTest() = default;
+};
+
+static const std::string kWorkspace{R"(
+    <Workspace>
+        <Local name="live" type='{"type":"uint64"}' value='0' />
+        <Local name="zero" type='{"type":"uint64"}' value='0' />
+        <Local name="one" type='{"type":"uint64"}' value='1' />
+    </Workspace>
+)"};
+
+TEST_F(LazySetupTest, DeferredSetupFunction)
+{
+  auto instr = GlobalInstructionRegistry().Create("AchieveCondition");
+  ASSERT_TRUE(instr);
+  Procedure proc;
+  test::NullUserInterface ui;
+  LazySetup lazy_setup;
+  int n_calls = 0;
+  auto setup = [&n_calls](const Procedure&) { ++n_calls; };
+
+  // Without the attribute, the setup function is called immediately
+  lazy_setup.Setup(*instr, proc, setup);
+  EXPECT_EQ(n_calls, 1);
+  EXPECT_FALSE(lazy_setup.IsPending());
+  EXPECT_TRUE(lazy_setup.Complete(ui));
+  EXPECT_EQ(n_calls, 1);
+
+  // With the attribute, it is called once on completion
+  ASSERT_TRUE(instr->AddAttribute(LAZY_SETUP_ATTRIBUTE, "true"));
+  lazy_setup.Setup(*instr, proc, setup);
+  EXPECT_EQ(n_calls, 1);
+  EXPECT_TRUE(lazy_setup.IsPending());
+  EXPECT_TRUE(lazy_setup.Complete(ui));
+  EXPECT_FALSE(lazy_setup.IsPending());
+  EXPECT_TRUE(lazy_setup.Complete(ui));
+  EXPECT_EQ(n_calls, 2);
+
+  // A failing deferred setup is reported on every completion
+  lazy_setup.Setup(*instr, proc, [](const Procedure&) {
+    throw InstructionSetupException("deferred setup failed");
+  });
+  EXPECT_FALSE(lazy_setup.Complete(ui));
+  EXPECT_FALSE(lazy_setup.Complete(ui));
+
+  // Other exceptions are also caught
+  lazy_setup.Setup(*instr, proc, [](const Procedure&) {
+    throw std::runtime_error("deferred setup failed");
+  });
+  EXPECT_FALSE(lazy_setup.Complete(ui));
+}
+
+TEST_F(LazySetupTest, Execution)
+{
+  const std::vector<std::string> bodies = {
+    R"(<AchieveCondition lazySetup="true">
+           <Equals leftVar="live" rightVar="one"/>
+           <Copy inputVar="one" outputVar="live"/>
+       </AchieveCondition>)",
+    R"(<AchieveCondition lazySetup="true" executionMode="native">
+           <Equals leftVar="live" rightVar="one"/>
+           <Copy inputVar="one" outputVar="live"/>
+       </AchieveCondition>)",
+    R"(<AchieveConditionWithTimeout lazySetup="true" timeout="1.0">
+           <Equals leftVar="live" rightVar="one"/>
+           <Copy inputVar="one" outputVar="live"/>
+       </AchieveConditionWithTimeout>)",
+    R"(<AchieveConditionWithOverride lazySetup="true">
+           <Equals leftVar="live" rightVar="zero"/>
+       </AchieveConditionWithOverride>)",
+    R"(<ExecuteWhile lazySetup="true">
+           <Copy inputVar="one" outputVar="live"/>
+           <Equals leftVar="zero" rightVar="zero"/>
+       </ExecuteWhile>)",
+    R"(<ExecuteWhile lazySetup="true" executionMode="interleaved">
+           <Copy inputVar="one" outputVar="live"/>
+           <Equals leftVar="zero" rightVar="zero"/>
+       </ExecuteWhile>)",
+    R"(<WaitForCondition lazySetup="true" timeout="1.0" compileCondition="true">
+           <Equals leftVar="live" rightVar="zero"/>
+       </WaitForCondition>)",
+    R"(<RetryUntil lazySetup="true" maxAttempts="2">
+           <Equals leftVar="live" rightVar="one"/>
+           <Copy inputVar="one" outputVar="live"/>
+       </RetryUntil>)"
+  };
+  test::NullUserInterface ui;
+  for (const auto& instr_xml : bodies)
+  {
+    auto proc = ParseProcedureString(test::CreateProcedureString(instr_xml + kWorkspace));
+    EXPECT_TRUE(test::TryAndExecute(proc, ui)) << instr_xml;
+  }
+}
+
+TEST_F(LazySetupTest, DormantInstruction)
+{
+  // The condition of the AchieveCondition instruction lacks a mandatory attribute, which is only
+  // detected during setup of the child instructions.
+  const std::string body_template{R"(
+    <Fallback>
+        <Equals leftVar="live" rightVar="DORMANT"/>
+        <AchieveCondition lazySetup="true">
+            <Equals leftVar="live"/>
+            <Copy inputVar="one" outputVar="live"/>
+        </AchieveCondition>
+    </Fallback>
+)" + kWorkspace};
+
+  test::NullUserInterface ui;
+  {
+    // Never executed: setup and execution succeed
+    auto body = body_template;
+    body.replace(body.find("DORMANT"), std::string{"DORMANT"}.size(), "zero");
+    auto proc = ParseProcedureString(test::CreateProcedureString(body));
+    EXPECT_TRUE(test::TryAndExecute(proc, ui));
+  }
+  {
+    // Executed: the setup error makes the instruction fail
+    auto body = body_template;
+    body.replace(body.find("DORMANT"), std::string{"DORMANT"}.size(), "one");
+    auto proc = ParseProcedureString(test::CreateProcedureString(body));
+    EXPECT_TRUE(test::TryAndExecute(proc, ui, ExecutionStatus::FAILURE));
+  }
+  {
+    // Without lazy setup, the error is detected during setup
+    auto body = body_template;
+    body.replace(body.find("DORMANT"), std::string{"DORMANT"}.size(), "zero");
+    body.replace(body.find(R"( lazySetup="true")"), std::string{R"( lazySetup="true")"}.size(),
+                 "");
+    auto proc = ParseProcedureString(test::CreateProcedureString(body));
+    EXPECT_THROW(proc->Setup(), InstructionSetupException);
+  }
+}
+
+TEST_F(LazySetupTest, StructuralErrorsDetectedEagerly)
+{
+  // An invalid number of children is detected during setup, even when the setup of the children
+  // is deferred.
+  const std::vector<std::string> bodies{
+    R"(<AchieveCondition lazySetup="true">
+           <Equals leftVar="live" rightVar="one"/>
+       </AchieveCondition>)",
+    R"(<AchieveCondition lazySetup="true" executionMode="native">
+           <Equals leftVar="live" rightVar="one"/>
+       </AchieveCondition>)",
+    R"(<AchieveConditionWithTimeout lazySetup="true" timeout="1.0">
+           <Equals leftVar="live" rightVar="one"/>
+       </AchieveConditionWithTimeout>)",
+    R"(<AchieveConditionWithOverride lazySetup="true"/>)",
+    R"(<ExecuteWhile lazySetup="true">
+           <Equals leftVar="live" rightVar="one"/>
+       </ExecuteWhile>)",
+    R"(<ExecuteWhile lazySetup="true" executionMode="interleaved">
+           <Equals leftVar="live" rightVar="one"/>
+       </ExecuteWhile>)",
+    R"(<RetryUntil lazySetup="true" maxAttempts="2">
+           <Equals leftVar="live" rightVar="one"/>
+       </RetryUntil>)",
+    R"(<WaitForCondition lazySetup="true" timeout="1.0"/>)"
+  };
+  for (const auto& instr_xml : bodies)
+  {
+    auto proc = ParseProcedureString(test::CreateProcedureString(instr_xml + kWorkspace));
+    EXPECT_THROW(proc->Setup(), InstructionSetupException) << instr_xml;
+  }
+}
@@ -0,0 +1,92 @@
+/******************************************************************************
+* $HeadURL: $
+* $Id: $
+*
+* Project       : Supervision and Automation - oac-tree
+*
+* Description   : SUP oac-tree control plugin
+*
+* Author        : Walter Van Herck (IO)
+*
+* Copyright (c) : 2010-2026 ITER Organization,
+*                 CS 90 046
+*                 13067 St. Paul-lez-Durance Cedex
+*                 France
+* SPDX-License-Identifier: MIT
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file LICENSE located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+
+#include "oac-tree/control/log_deduplicator.h"
+
+#include <gtest/gtest.h>
+
+using namespace sup::oac_tree;
+
+class LogDeduplicatorTest : public ::testing::Test
+{
+protected:
+  LogDeduplicatorTest();
+  virtual ~LogDeduplicatorTest() = default;
+
+  LogDeduplicator::Clock::time_point m_start;
+};
+
+TEST_F(LogDeduplicatorTest, CollapseWithinWindow)
+{
+  LogDeduplicator dedup{std::chrono::seconds(1)};
+  LogRepeatSummary summary;
+  EXPECT_TRUE(dedup.Register(1, "failed", m_start, summary));
+  EXPECT_EQ(summary.m_count, 0);
+  for (int idx = 1; idx < 10; ++idx)
+  {
+    EXPECT_FALSE(dedup.Register(1, "failed", m_start + std::chrono::milliseconds(idx * 10),
+                                summary));
+    EXPECT_EQ(summary.m_count, 0);
+  }
+  EXPECT_TRUE(dedup.TakeSummary(summary));
+  EXPECT_EQ(summary.m_severity, 1);
+  EXPECT_EQ(summary.m_count, 9);
+  EXPECT_EQ(summary.m_message, "failed");
+  // Summary was taken
+  EXPECT_FALSE(dedup.TakeSummary(summary));
+  EXPECT_EQ(summary.m_count, 0);
+}
+
+TEST_F(LogDeduplicatorTest, DifferentMessage)
+{
+  LogDeduplicator dedup{std::chrono::seconds(1)};
+  LogRepeatSummary summary;
+  EXPECT_TRUE(dedup.Register(1, "failed", m_start, summary));
+  EXPECT_FALSE(dedup.Register(1, "failed", m_start, summary));
+  EXPECT_FALSE(dedup.Register(1, "failed", m_start, summary));
+  EXPECT_TRUE(dedup.Register(1, "other", m_start, summary));
+  EXPECT_EQ(summary.m_count, 2);
+  EXPECT_EQ(summary.m_message, "failed");
+  // Different severity is a different message
+  EXPECT_TRUE(dedup.Register(2, "other", m_start, summary));
+  EXPECT_EQ(summary.m_count, 0);
+  EXPECT_FALSE(dedup.TakeSummary(summary));
+}
+
+TEST_F(LogDeduplicatorTest, WindowExpired)
+{
+  LogDeduplicator dedup{std::chrono::seconds(1)};
+  LogRepeatSummary summary;
+  EXPECT_TRUE(dedup.Register(1, "failed", m_start, summary));
+  EXPECT_FALSE(dedup.Register(1, "failed", m_start + std::chrono::milliseconds(500), summary));
+  EXPECT_TRUE(dedup.Register(1, "failed", m_start + std::chrono::milliseconds(1000), summary));
+  EXPECT_EQ(summary.m_count, 1);
+  EXPECT_EQ(summary.m_message, "failed");
+  // New window starts at the last forwarded message
+  EXPECT_FALSE(dedup.Register(1, "failed", m_start + std::chrono::milliseconds(1500), summary));
+  EXPECT_EQ(summary.m_count, 0);
+}
+
+LogDeduplicatorTest::LogDeduplicatorTest()
+  : m_start{LogDeduplicator::Clock::now()}
+{}
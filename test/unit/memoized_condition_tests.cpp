@@ -0,0 +1,154 @@
+/******************************************************************************
+* $HeadURL: $
+* $Id: $
+*
+* Project       : Supervision and Automation - oac-tree
+*
+* Description   : SUP oac-tree control plugin
+*
+* Author        : Walter Van Herck (IO)
+*
+* Copyright (c) : 2010-2026 ITER Organization,
+*                 CS 90 046
+*                 13067 St. Paul-lez-Durance Cedex
+*                 France
+* SPDX-License-Identifier: MIT
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file LICENSE located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+
+#include "test_user_interface.h"
+#include "unit_test_helper.h"
+
+#include "oac-tree/control/condition_memo_table.h"
+#include "oac-tree/control/memoized_condition_instruction.h"
+
+#include <sup/oac-tree/instruction_registry.h>
+#include <sup/oac-tree/sequence_parser.h>
+
+#include <gtest/gtest.h>
+
+#include <memory>
+
+using namespace sup::oac_tree;
+
+class MemoizedConditionTest : public ::testing::Test
+{
+protected:
+  MemoizedConditionTest() = default;
+  virtual ~MemoizedConditionTest() = default;
+};
+
+TEST_F(MemoizedConditionTest, SharedOutcome)
+{
+  const std::string body{R"(
+    <Sequence>
+        <Repeat maxCount="3">
+            <MemoizedCondition>
+                <Equals leftVar="live" rightVar="zero"/>
+            </MemoizedCondition>
+        </Repeat>
+        <MemoizedCondition>
+            <Equals rightVar="zero" leftVar="live"/>
+        </MemoizedCondition>
+        <Copy inputVar="one" outputVar="live"/>
+        <Inverter>
+            <MemoizedCondition>
+                <Equals leftVar="live" rightVar="zero"/>
+            </MemoizedCondition>
+        </Inverter>
+    </Sequence>
+    <Workspace>
+        <Local name="live" type='{"type":"uint64"}' value='0' />
+        <Local name="zero" type='{"type":"uint64"}' value='0' />
+        <Local name="one" type='{"type":"uint64"}' value='1' />
+    </Workspace>
+)"};
+
+  test::NullUserInterface ui;
+  auto proc = ParseProcedureString(test::CreateProcedureString(body));
+  EXPECT_TRUE(test::TryAndExecute(proc, ui));
+
+  // The first evaluation and the one after the variable changed are misses. The repetitions and
+  // the second instance with the same condition reuse the outcome.
+  auto memo_table = FindConditionMemoTable(*proc->RootInstruction());
+  ASSERT_NE(memo_table, nullptr);
+  EXPECT_EQ(memo_table->GetMissCount(), 2);
+  EXPECT_EQ(memo_table->GetHitCount(), 3);
+}
+
+TEST_F(MemoizedConditionTest, TableOwnedByProcedure)
+{
+  const std::string body{R"(
+    <MemoizedCondition>
+        <Equals leftVar="live" rightVar="zero"/>
+    </MemoizedCondition>
+    <Workspace>
+        <Local name="live" type='{"type":"uint64"}' value='0' />
+        <Local name="zero" type='{"type":"uint64"}' value='0' />
+    </Workspace>
+)"};
+
+  // Procedures never share outcomes, even when they are created one after the other
+  test::NullUserInterface ui;
+  auto proc = ParseProcedureString(test::CreateProcedureString(body));
+  EXPECT_TRUE(test::TryAndExecute(proc, ui));
+  std::weak_ptr<ConditionMemoTable> first_table = FindConditionMemoTable(*proc->RootInstruction());
+  EXPECT_FALSE(first_table.expired());
+  proc.reset();
+  EXPECT_TRUE(first_table.expired());
+
+  auto other_proc = ParseProcedureString(test::CreateProcedureString(body));
+  EXPECT_TRUE(test::TryAndExecute(other_proc, ui));
+  auto memo_table = FindConditionMemoTable(*other_proc->RootInstruction());
+  ASSERT_NE(memo_table, nullptr);
+  EXPECT_EQ(memo_table->GetMissCount(), 1);
+  EXPECT_EQ(memo_table->GetHitCount(), 0);
+}
+
+TEST_F(MemoizedConditionTest, NotMemoizable)
+{
+  const std::string body{R"(
+    <MemoizedCondition>
+        <Sequence>
+            <Wait timeout="0.1"/>
+            <Equals leftVar="live" rightVar="zero"/>
+        </Sequence>
+    </MemoizedCondition>
+    <Workspace>
+        <Local name="live" type='{"type":"uint64"}' value='0' />
+        <Local name="zero" type='{"type":"uint64"}' value='0' />
+    </Workspace>
+)"};
+
+  auto proc = ParseProcedureString(test::CreateProcedureString(body));
+  EXPECT_THROW(proc->Setup(), InstructionSetupException);
+}
+
+TEST_F(MemoizedConditionTest, Signature)
+{
+  auto left = GlobalInstructionRegistry().Create("Equals");
+  auto right = GlobalInstructionRegistry().Create("Equals");
+  ASSERT_TRUE(left);
+  ASSERT_TRUE(right);
+  ASSERT_TRUE(left->AddAttribute("leftVar", "a"));
+  ASSERT_TRUE(left->AddAttribute("rightVar", "b"));
+  ASSERT_TRUE(right->AddAttribute("rightVar", "b"));
+  ASSERT_TRUE(right->AddAttribute("leftVar", "a"));
+  EXPECT_EQ(GetConditionSignature(*left), GetConditionSignature(*right));
+  EXPECT_TRUE(IsMemoizableCondition(*left));
+
+  auto other = GlobalInstructionRegistry().Create("Equals");
+  ASSERT_TRUE(other);
+  ASSERT_TRUE(other->AddAttribute("leftVar", "a"));
+  ASSERT_TRUE(other->AddAttribute("rightVar", "c"));
+  EXPECT_NE(GetConditionSignature(*left), GetConditionSignature(*other));
+
+  auto wait = GlobalInstructionRegistry().Create("Wait");
+  ASSERT_TRUE(wait);
+  EXPECT_FALSE(IsMemoizableCondition(*wait));
+}
@@ -0,0 +1,208 @@
+/******************************************************************************
+* $HeadURL: $
+* $Id: $
+*
+* Project       : Supervision and Automation - oac-tree
+*
+* Description   : SUP oac-tree control plugin
+*
+* Author        : Walter Van Herck (IO)
+*
+* Copyright (c) : 2010-2026 ITER Organization,
+*                 CS 90 046
+*                 13067 St. Paul-lez-Durance Cedex
+*                 France
+* SPDX-License-Identifier: MIT
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file LICENSE located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+#include "test_instructions.h"
+#include "test_user_interface.h"
+
+#include "oac-tree/control/pooled_instruction_ticker.h"
+#include "oac-tree/control/worker_pool.h"
+
+#include <sup/oac-tree/workspace.h>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <future>
+#include <stdexcept>
+#include <thread>
+
+using namespace sup::oac_tree;
+
+namespace
+{
+// Needs a number of ticks without waiting before it succeeds
+class StepAction : public Instruction
+{
+public:
+  explicit StepAction(std::size_t n_steps)
+    : Instruction("StepAction"), m_n_steps{n_steps}, m_ticks{0} {}
+  ~StepAction() override = default;
+
+  std::size_t GetTickCount() const { return m_ticks; }
+
+private:
+  ExecutionStatus ExecuteSingleImpl(UserInterface&, Workspace&) override
+  {
+    ++m_ticks;
+    return m_ticks < m_n_steps ? ExecutionStatus::NOT_FINISHED : ExecutionStatus::SUCCESS;
+  }
+  std::size_t m_n_steps;
+  std::size_t m_ticks;
+};
+
+// Throws on every tick
+class ThrowingAction : public Instruction
+{
+public:
+  ThrowingAction() : Instruction("ThrowingAction") {}
+  ~ThrowingAction() override = default;
+
+private:
+  ExecutionStatus ExecuteSingleImpl(UserInterface&, Workspace&) override
+  {
+    throw std::runtime_error("action failed");
+  }
+};
+
+// Ticks another action with a ticker on the same pool and waits for it
+class NestedTickerAction : public Instruction
+{
+public:
+  explicit NestedTickerAction(WorkerPool& pool)
+    : Instruction("NestedTickerAction"), m_inner{3}, m_ticker{pool, m_inner} {}
+  ~NestedTickerAction() override = default;
+
+private:
+  ExecutionStatus ExecuteSingleImpl(UserInterface& ui, Workspace& ws) override
+  {
+    (void)m_ticker.SubmitTicks(ui, ws);
+    m_ticker.Wait();
+    return m_inner.GetStatus();
+  }
+  StepAction m_inner;
+  PooledInstructionTicker m_ticker;
+};
+
+bool WaitUntilIdle(const PooledInstructionTicker& ticker)
+{
+  auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+  while (ticker.IsBusy())
+  {
+    if (std::chrono::steady_clock::now() > deadline)
+    {
+      return false;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  return true;
+}
+}  // unnamed namespace
+
+class PooledInstructionTickerTest : public ::testing::Test
+{
+protected:
+  PooledInstructionTickerTest() = default;
+  virtual ~PooledInstructionTickerTest() = default;
+
+  test::NullUserInterface ui;
+  Workspace ws;
+};
+
+TEST_F(PooledInstructionTickerTest, AdvanceUntilFinished)
+{
+  WorkerPool pool{1, 16};
+  StepAction action{5};
+  PooledInstructionTicker ticker{pool, action};
+  EXPECT_TRUE(ticker.SubmitTicks(ui, ws));
+  ASSERT_TRUE(WaitUntilIdle(ticker));
+  EXPECT_EQ(action.GetStatus(), ExecutionStatus::SUCCESS);
+  EXPECT_EQ(action.GetTickCount(), 5);
+}
+
+TEST_F(PooledInstructionTickerTest, StopWhenRunning)
+{
+  WorkerPool pool{1, 16};
+  test::RunningAction action;
+  PooledInstructionTicker ticker{pool, action};
+  EXPECT_TRUE(ticker.SubmitTicks(ui, ws));
+  ASSERT_TRUE(WaitUntilIdle(ticker));
+  EXPECT_EQ(action.GetStatus(), ExecutionStatus::RUNNING);
+}
+
+TEST_F(PooledInstructionTickerTest, MaxTicksPerJob)
+{
+  WorkerPool pool{1, 16};
+  StepAction action{2 * PooledInstructionTicker::kMaxTicksPerJob};
+  PooledInstructionTicker ticker{pool, action};
+  EXPECT_TRUE(ticker.SubmitTicks(ui, ws));
+  ASSERT_TRUE(WaitUntilIdle(ticker));
+  EXPECT_EQ(action.GetStatus(), ExecutionStatus::NOT_FINISHED);
+  EXPECT_EQ(action.GetTickCount(), PooledInstructionTicker::kMaxTicksPerJob);
+}
+
+TEST_F(PooledInstructionTickerTest, WaitExecutesQueuedJob)
+{
+  WorkerPool pool{1, 16};
+  std::promise<void> release;
+  auto released = release.get_future().share();
+  ASSERT_TRUE(pool.Submit([released]{ released.wait(); }));
+
+  // The only worker is blocked, so the job can only be executed by Wait
+  StepAction action{3};
+  PooledInstructionTicker ticker{pool, action};
+  EXPECT_TRUE(ticker.SubmitTicks(ui, ws));
+  EXPECT_TRUE(ticker.IsBusy());
+  EXPECT_FALSE(ticker.SubmitTicks(ui, ws));
+  ticker.Wait();
+  EXPECT_FALSE(ticker.IsBusy());
+  EXPECT_EQ(action.GetStatus(), ExecutionStatus::SUCCESS);
+  EXPECT_EQ(action.GetTickCount(), 3);
+  release.set_value();
+}
+
+TEST_F(PooledInstructionTickerTest, NestedTickersOnSingleWorker)
+{
+  WorkerPool pool{1, 16};
+  NestedTickerAction action{pool};
+  PooledInstructionTicker ticker{pool, action};
+  EXPECT_TRUE(ticker.SubmitTicks(ui, ws));
+  // The outer job runs on the only worker and waits for the inner job without deadlock
+  ASSERT_TRUE(WaitUntilIdle(ticker));
+  EXPECT_EQ(action.GetStatus(), ExecutionStatus::SUCCESS);
+}
+
+TEST_F(PooledInstructionTickerTest, ThrowingAction)
+{
+  WorkerPool pool{1, 16};
+  ThrowingAction action;
+  test::LogUserInterface log_ui;
+  PooledInstructionTicker ticker{pool, action};
+  EXPECT_FALSE(ticker.HasFailed());
+  EXPECT_TRUE(ticker.SubmitTicks(log_ui, ws));
+  ASSERT_TRUE(WaitUntilIdle(ticker));
+  EXPECT_TRUE(ticker.HasFailed());
+  ASSERT_EQ(log_ui.GetLogEntries().size(), 1);
+  EXPECT_NE(log_ui.GetLogEntries()[0].second.find("action failed"), std::string::npos);
+
+  // The ticker remains usable and a job executed by Wait does not throw either
+  ticker.ClearFailure();
+  EXPECT_FALSE(ticker.HasFailed());
+  std::promise<void> release;
+  auto released = release.get_future().share();
+  ASSERT_TRUE(pool.Submit([released]{ released.wait(); }));
+  EXPECT_TRUE(ticker.SubmitTicks(log_ui, ws));
+  EXPECT_NO_THROW(ticker.Wait());
+  EXPECT_FALSE(ticker.IsBusy());
+  EXPECT_TRUE(ticker.HasFailed());
+  EXPECT_EQ(log_ui.GetLogEntries().size(), 2);
+  release.set_value();
+}
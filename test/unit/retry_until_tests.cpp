@@ -0,0 +1,222 @@
+/******************************************************************************
+* $HeadURL: $
+* $Id: $
+*
+* Project       : Supervision and Automation - oac-tree
+*
+* Description   : SUP oac-tree control plugin
+*
+* Author        : Walter Van Herck (IO)
+*
+* Copyright (c) : 2010-2026 ITER Organization,
+*                 CS 90 046
+*                 13067 St. Paul-lez-Durance Cedex
+*                 France
+* SPDX-License-Identifier: MIT
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file LICENSE located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+
+#include "test_instructions.h"
+#include "test_user_interface.h"
+#include "unit_test_helper.h"
+
+#include "oac-tree/control/retry_backoff.h"
+#include "oac-tree/control/retry_until_instruction.h"
+
+#include <sup/oac-tree/instruction_registry.h>
+#include <sup/oac-tree/procedure.h>
+#include <sup/oac-tree/sequence_parser.h>
+#include <sup/oac-tree/workspace.h>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+using namespace sup::oac_tree;
+
+class RetryUntilTest : public ::testing::Test
+{
+protected:
+  RetryUntilTest() = default;
+  virtual ~RetryUntilTest() = default;
+};
+
+TEST_F(RetryUntilTest, RetryDelay)
+{
+  RetryBackoffOptions options;
+  options.m_initial_delay = 0.1;
+  options.m_backoff_factor = 2.0;
+  options.m_max_delay = 0.5;
+  EXPECT_DOUBLE_EQ(GetRetryDelay(options, 0, 0.5), 0.1);
+  EXPECT_DOUBLE_EQ(GetRetryDelay(options, 1, 0.5), 0.2);
+  EXPECT_DOUBLE_EQ(GetRetryDelay(options, 2, 0.5), 0.4);
+  EXPECT_DOUBLE_EQ(GetRetryDelay(options, 3, 0.5), 0.5);
+  EXPECT_DOUBLE_EQ(GetRetryDelay(options, 1000, 0.5), 0.5);
+
+  // Jitter scales the delay, which is still limited to the maximum
+  options.m_jitter = 0.5;
+  EXPECT_DOUBLE_EQ(GetRetryDelay(options, 0, 0.0), 0.05);
+  EXPECT_DOUBLE_EQ(GetRetryDelay(options, 0, 1.0), 0.15);
+  EXPECT_DOUBLE_EQ(GetRetryDelay(options, 2, 1.0), 0.5);
+
+  // Default options retry immediately
+  EXPECT_DOUBLE_EQ(GetRetryDelay(RetryBackoffOptions{}, 10, 0.5), 0.0);
+}
+
+TEST_F(RetryUntilTest, DirectSuccess)
+{
+  test::ScopedControlMetrics metrics_enabled;
+  const std::string body{R"(
+    <RetryUntil maxAttempts="3">
+        <Equals leftVar="live" rightVar="one"/>
+        <Copy inputVar="zero" outputVar="live"/>
+    </RetryUntil>
+    <Workspace>
+        <Local name="live" type='{"type":"uint64"}' value='1' />
+        <Local name="zero" type='{"type":"uint64"}' value='0' />
+        <Local name="one" type='{"type":"uint64"}' value='1' />
+    </Workspace>
+)"};
+
+  test::NullUserInterface ui;
+  auto proc = ParseProcedureString(test::CreateProcedureString(body));
+  EXPECT_TRUE(test::TryAndExecute(proc, ui));
+
+  auto instr = dynamic_cast<RetryUntilInstruction*>(proc->RootInstruction());
+  ASSERT_NE(instr, nullptr);
+  auto metrics = instr->GetControlMetrics().GetSnapshot();
+  EXPECT_EQ(metrics.m_action_runs, 0);
+  EXPECT_EQ(metrics.m_retries, 0);
+}
+
+TEST_F(RetryUntilTest, SuccessAfterRetries)
+{
+  test::ScopedControlMetrics metrics_enabled;
+  const std::string body{R"(
+    <RetryUntil maxAttempts="5" initialDelay="0.01" backoffFactor="1.5" jitter="0.2">
+        <GreaterThanOrEqual leftVar="counter" rightVar="three"/>
+        <Increment varName="counter"/>
+    </RetryUntil>
+    <Workspace>
+        <Local name="counter" type='{"type":"uint64"}' value='0' />
+        <Local name="three" type='{"type":"uint64"}' value='3' />
+    </Workspace>
+)"};
+
+  test::NullUserInterface ui;
+  auto proc = ParseProcedureString(test::CreateProcedureString(body));
+  EXPECT_TRUE(test::TryAndExecute(proc, ui));
+
+  auto instr = dynamic_cast<RetryUntilInstruction*>(proc->RootInstruction());
+  ASSERT_NE(instr, nullptr);
+  auto metrics = instr->GetControlMetrics().GetSnapshot();
+  EXPECT_EQ(metrics.m_action_runs, 3);
+  EXPECT_EQ(metrics.m_retries, 2);
+}
+
+TEST_F(RetryUntilTest, FailureAfterMaxAttempts)
+{
+  test::ScopedControlMetrics metrics_enabled;
+  const std::string body{R"(
+    <RetryUntil maxAttempts="3" initialDelay="0.01">
+        <Equals leftVar="live" rightVar="one"/>
+        <Copy inputVar="zero" outputVar="live"/>
+    </RetryUntil>
+    <Workspace>
+        <Local name="live" type='{"type":"uint64"}' value='0' />
+        <Local name="zero" type='{"type":"uint64"}' value='0' />
+        <Local name="one" type='{"type":"uint64"}' value='1' />
+    </Workspace>
+)"};
+
+  test::NullUserInterface ui;
+  auto proc = ParseProcedureString(test::CreateProcedureString(body));
+  EXPECT_TRUE(test::TryAndExecute(proc, ui, ExecutionStatus::FAILURE));
+
+  auto instr = dynamic_cast<RetryUntilInstruction*>(proc->RootInstruction());
+  ASSERT_NE(instr, nullptr);
+  auto metrics = instr->GetControlMetrics().GetSnapshot();
+  EXPECT_EQ(metrics.m_action_runs, 3);
+  EXPECT_EQ(metrics.m_retries, 2);
+}
+
+TEST_F(RetryUntilTest, WaitBetweenAttempts)
+{
+  RetryUntilInstruction instr;
+  auto condition = GlobalInstructionRegistry().Create(test::CountingCondition::Type);
+  auto action = GlobalInstructionRegistry().Create("Succeed");
+  ASSERT_TRUE(condition);
+  ASSERT_TRUE(action);
+  // The counting condition fails, since the variable is not present in the workspace
+  ASSERT_TRUE(condition->AddAttribute("varName", "live"));
+  ASSERT_TRUE(instr.InsertInstruction(std::move(condition), 0));
+  ASSERT_TRUE(instr.InsertInstruction(std::move(action), 1));
+  ASSERT_TRUE(instr.AddAttribute("maxAttempts", "2"));
+  ASSERT_TRUE(instr.AddAttribute("initialDelay", "10.0"));
+  Procedure proc;
+  ASSERT_NO_THROW(instr.Setup(proc));
+
+  test::NullUserInterface ui;
+  Workspace ws;
+  test::CountingCondition::ResetExecutionCount();
+  for (int i = 0; i < 10; ++i)
+  {
+    instr.ExecuteSingle(ui, ws);
+  }
+  EXPECT_EQ(instr.GetStatus(), ExecutionStatus::RUNNING);
+  EXPECT_EQ(instr.GetAttemptCount(), 1u);
+  auto n_evaluations = test::CountingCondition::GetExecutionCount();
+
+  // While waiting, nothing is ticked and the runner can sleep until the next attempt
+  instr.ExecuteSingle(ui, ws);
+  EXPECT_EQ(test::CountingCondition::GetExecutionCount(), n_evaluations);
+  auto hint = instr.GetWakeUpHint();
+  EXPECT_FALSE(hint.m_polling);
+  EXPECT_FALSE(hint.m_on_variable_change);
+  EXPECT_GT(hint.m_deadline, WakeUpHint::Clock::now() + std::chrono::seconds(9));
+
+  instr.Halt(ui);
+  instr.Reset(ui);
+  EXPECT_EQ(instr.GetAttemptCount(), 0u);
+}
+
+TEST_F(RetryUntilTest, Setup)
+{
+  const std::vector<std::string> invalid_attributes = {
+    "",  // maxAttempts is mandatory
+    R"(maxAttempts="0")",
+    R"(maxAttempts="2" initialDelay="-1.0")",
+    R"(maxAttempts="2" backoffFactor="0.5")",
+    R"(maxAttempts="2" maxDelay="-1.0")",
+    R"(maxAttempts="2" jitter="1.5")"
+  };
+  for (const auto& attributes : invalid_attributes)
+  {
+    const std::string body = "<RetryUntil " + attributes + R"(>
+          <Wait/>
+          <Wait/>
+      </RetryUntil>
+      <Workspace/>)";
+
+    auto proc = ParseProcedureString(test::CreateProcedureString(body));
+    EXPECT_THROW(proc->Setup(), InstructionSetupException) << attributes;
+  }
+  {
+    // One child
+    const std::string body{R"(
+      <RetryUntil maxAttempts="2">
+          <Wait/>
+      </RetryUntil>
+      <Workspace/>)"};
+
+    auto proc = ParseProcedureString(test::CreateProcedureString(body));
+    EXPECT_THROW(proc->Setup(), InstructionSetupException);
+  }
+}
@@ -0,0 +1,126 @@
+/******************************************************************************
+* $HeadURL: $
+* $Id: $
+*
+* Project       : Supervision and Automation - oac-tree
+*
+* Description   : SUP oac-tree control plugin
+*
+* Author        : Walter Van Herck (IO)
+*
+* Copyright (c) : 2010-2026 ITER Organization,
+*                 CS 90 046
+*                 13067 St. Paul-lez-Durance Cedex
+*                 France
+* SPDX-License-Identifier: MIT
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file LICENSE located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+#include "test_instructions.h"
+
+#include <sup/oac-tree/instruction_registry.h>
+#include <sup/oac-tree/workspace.h>
+
+#include <sup/dto/anyvalue.h>
+
+#include <atomic>
+
+namespace sup {
+
+namespace oac_tree {
+
+namespace test {
+
+namespace
+{
+const std::string VAR_NAME_ATTRIBUTE = "varName";
+
+std::atomic<std::size_t> g_counting_condition_executions{0};
+std::atomic<std::size_t> g_counting_condition_instances{0};
+std::atomic<std::size_t> g_running_action_halts{0};
+}  // unnamed namespace
+
+const std::string CountingCondition::Type = "CountingCondition";
+static bool _counting_condition_initialised_flag = RegisterGlobalInstruction<CountingCondition>();
+
+CountingCondition::CountingCondition()
+  : Instruction(Type)
+{
+  (void)AddAttributeDefinition(VAR_NAME_ATTRIBUTE).SetMandatory();
+  ++g_counting_condition_instances;
+}
+
+CountingCondition::~CountingCondition()
+{
+  --g_counting_condition_instances;
+}
+
+std::size_t CountingCondition::GetExecutionCount()
+{
+  return g_counting_condition_executions.load();
+}
+
+std::size_t CountingCondition::GetInstanceCount()
+{
+  return g_counting_condition_instances.load();
+}
+
+void CountingCondition::ResetExecutionCount()
+{
+  g_counting_condition_executions = 0;
+}
+
+ExecutionStatus CountingCondition::ExecuteSingleImpl(UserInterface& ui, Workspace& ws)
+{
+  (void)ui;
+  ++g_counting_condition_executions;
+  sup::dto::AnyValue value;
+  if (!ws.GetValue(GetAttributeString(VAR_NAME_ATTRIBUTE), value))
+  {
+    return ExecutionStatus::FAILURE;
+  }
+  return value.As<sup::dto::uint64>() != 0 ? ExecutionStatus::SUCCESS
+                                           : ExecutionStatus::FAILURE;
+}
+
+const std::string RunningAction::Type = "RunningAction";
+static bool _running_action_initialised_flag = RegisterGlobalInstruction<RunningAction>();
+
+RunningAction::RunningAction()
+  : Instruction(Type)
+{}
+
+RunningAction::~RunningAction() = default;
+
+std::size_t RunningAction::GetHaltCount()
+{
+  return g_running_action_halts.load();
+}
+
+void RunningAction::ResetHaltCount()
+{
+  g_running_action_halts = 0;
+}
+
+ExecutionStatus RunningAction::ExecuteSingleImpl(UserInterface& ui, Workspace& ws)
+{
+  (void)ui;
+  (void)ws;
+  return ExecutionStatus::RUNNING;
+}
+
+void RunningAction::HaltImpl(UserInterface& ui)
+{
+  (void)ui;
+  ++g_running_action_halts;
+}
+
+} // namespace test
+
+} // namespace oac_tree
+
+} // namespace sup
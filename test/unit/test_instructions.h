@@ -0,0 +1,82 @@
+/******************************************************************************
+* $HeadURL: $
+* $Id: $
+*
+* Project       : Supervision and Automation - oac-tree
+*
+* Description   : SUP oac-tree control plugin
+*
+* Author        : Walter Van Herck (IO)
+*
+* Copyright (c) : 2010-2026 ITER Organization,
+*                 CS 90 046
+*                 13067 St. Paul-lez-Durance Cedex
+*                 France
+* SPDX-License-Identifier: MIT
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file LICENSE located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+#ifndef SUP_OAC_TREE_PLUGIN_CONTROL_TEST_INSTRUCTIONS_H_
+#define SUP_OAC_TREE_PLUGIN_CONTROL_TEST_INSTRUCTIONS_H_
+
+#include <sup/oac-tree/instruction.h>
+
+#include <cstddef>
+
+namespace sup {
+
+namespace oac_tree {
+
+namespace test {
+
+/**
+ * @brief Condition instruction that succeeds when the workspace variable named by its 'varName'
+ * attribute is non-zero. It keeps global counters of its number of executions and live instances.
+ */
+class CountingCondition : public Instruction
+{
+public:
+  CountingCondition();
+  ~CountingCondition() override;
+
+  static const std::string Type;
+
+  static std::size_t GetExecutionCount();
+  static std::size_t GetInstanceCount();
+  static void ResetExecutionCount();
+
+private:
+  ExecutionStatus ExecuteSingleImpl(UserInterface& ui, Workspace& ws) override;
+};
+
+/**
+ * @brief Action instruction that never finishes by itself: it always returns RUNNING. It keeps a
+ * global counter of the number of times it was halted.
+ */
+class RunningAction : public Instruction
+{
+public:
+  RunningAction();
+  ~RunningAction() override;
+
+  static const std::string Type;
+
+  static std::size_t GetHaltCount();
+  static void ResetHaltCount();
+
+private:
+  ExecutionStatus ExecuteSingleImpl(UserInterface& ui, Workspace& ws) override;
+  void HaltImpl(UserInterface& ui) override;
+};
+
+} // namespace test
+
+} // namespace oac_tree
+
+} // namespace sup
+
+#endif // SUP_OAC_TREE_PLUGIN_CONTROL_TEST_INSTRUCTIONS_H_
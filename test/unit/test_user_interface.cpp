@@ -114,6 +114,25 @@ int TestUserInputInterface::GetUserChoice(const std::vector<std::string>& option
   return m_user_choices[m_current_index++];
 }
 
+LogUserInterface::LogUserInterface()
+  : m_mtx{}
+  , m_log_entries{}
+{}
+
+LogUserInterface::~LogUserInterface() = default;
+
+void LogUserInterface::Log(int severity, const std::string& message)
+{
+  std::lock_guard<std::mutex> lk{m_mtx};
+  m_log_entries.emplace_back(severity, message);
+}
+
+std::vector<LogUserInterface::LogEntry> LogUserInterface::GetLogEntries() const
+{
+  std::lock_guard<std::mutex> lk{m_mtx};
+  return m_log_entries;
+}
+
 } // namespace test
 
 } // namespace oac_tree
@@ -26,6 +26,8 @@
 #include <sup/oac-tree/async_input_adapter.h>
 #include <sup/oac-tree/user_interface.h>
 
+#include <mutex>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -61,6 +63,25 @@ private:
   bool m_return_valid_future;
 };
 
+/**
+ * @brief User interface that stores all received log entries. It can be used from multiple threads.
+ */
+class LogUserInterface : public DefaultUserInterface
+{
+public:
+  using LogEntry = std::pair<int, std::string>;
+  LogUserInterface();
+  ~LogUserInterface();
+
+  void Log(int severity, const std::string& message) override;
+
+  std::vector<LogEntry> GetLogEntries() const;
+
+private:
+  mutable std::mutex m_mtx;
+  std::vector<LogEntry> m_log_entries;
+};
+
 } // namespace test
 
 } // namespace oac_tree
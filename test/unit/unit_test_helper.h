@@ -23,10 +23,16 @@
 #ifndef SUP_OAC_TREE_PLUGIN_CONTROL_UNIT_TEST_HELPER_H_
 #define SUP_OAC_TREE_PLUGIN_CONTROL_UNIT_TEST_HELPER_H_
 
+#include "oac-tree/control/control_clock.h"
+#include "oac-tree/control/control_metrics.h"
+#include "oac-tree/control/wake_up_hint.h"
+
 #include <sup/oac-tree/instruction.h>
 #include <sup/oac-tree/procedure.h>
 #include <sup/oac-tree/user_interface.h>
 
+#include <algorithm>
+#include <chrono>
 #include <thread>
 #include <utility>
 #include <vector>
@@ -40,6 +46,48 @@ namespace test {
 static inline bool TryAndExecute(std::unique_ptr<Procedure>& proc, UserInterface& ui,
                                  const ExecutionStatus& expect = ExecutionStatus::SUCCESS);
 
+/**
+ * Sleeps until the next wake-up time hinted by the running procedure, polling at most every 100 ms.
+ * When a manual control clock is installed, it is advanced to the wake-up time instead.
+ */
+static inline void SleepUntilWakeUp(const Procedure& proc)
+{
+  const auto poll_period = std::chrono::milliseconds(100);
+  auto root = proc.RootInstruction();
+  auto hint = root != nullptr ? GetWakeUpHint(*root) : PollingWakeUpHint();
+  auto now = ControlClockNow();
+  auto wake_up_time = GetNextWakeUpTime(hint, now, poll_period);
+  if (auto manual_clock = dynamic_cast<ManualControlClock*>(GetControlClock()))
+  {
+    manual_clock->AdvanceTo(wake_up_time);
+    return;
+  }
+  // The control clock need not be the steady clock, so only the remaining duration is used
+  auto remaining = std::max(wake_up_time - now, ControlClock::Clock::duration::zero());
+  std::this_thread::sleep_for(
+    std::min(remaining, std::chrono::duration_cast<ControlClock::Clock::duration>(poll_period)));
+}
+
+/**
+ * Enables the collection of execution metrics for the lifetime of this object.
+ */
+class ScopedControlMetrics
+{
+public:
+  ScopedControlMetrics()
+    : m_previous{IsControlMetricsEnabled()}
+  {
+    SetControlMetricsEnabled(true);
+  }
+  ~ScopedControlMetrics() { SetControlMetricsEnabled(m_previous); }
+
+  ScopedControlMetrics(const ScopedControlMetrics&) = delete;
+  ScopedControlMetrics& operator=(const ScopedControlMetrics&) = delete;
+
+private:
+  bool m_previous;
+};
+
 static inline bool TryAndExecuteNoReset(std::unique_ptr<Procedure>& proc, UserInterface& ui,
                                         const ExecutionStatus& expect)
 {
@@ -53,7 +101,7 @@ static inline bool TryAndExecuteNoReset(std::unique_ptr<Procedure>& proc, UserIn
   {
     if (exec == ExecutionStatus::RUNNING)
     {
-      std::this_thread::sleep_for(std::chrono::milliseconds(100));
+      SleepUntilWakeUp(*proc);
     }
     proc->ExecuteSingle(ui);
     exec = proc->GetStatus();
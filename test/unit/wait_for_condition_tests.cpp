@@ -20,14 +20,24 @@
 * of the distribution package.
 ******************************************************************************/
 
+#include "test_instructions.h"
 #include "test_user_interface.h"
 #include "unit_test_helper.h"
 
+#include "oac-tree/control/control_clock.h"
+#include "oac-tree/control/variable_change_monitor.h"
+#include "oac-tree/control/wait_for_condition_instruction.h"
+
 #include <sup/oac-tree/instruction_registry.h>
 #include <sup/oac-tree/sequence_parser.h>
 
+#include <sup/oac-tree/workspace.h>
+
 #include <gtest/gtest.h>
 
+#include <chrono>
+#include <set>
+
 using namespace sup::oac_tree;
 
 class WaitForConditionTest : public ::testing::Test
@@ -90,7 +100,7 @@ TEST_F(WaitForConditionTest, Setup)
 TEST_F(WaitForConditionTest, Failure)
 {
   const std::string body{R"(
-    <WaitForCondition timeout="0.1">
+    <WaitForCondition timeout="60.0">
         <Equals leftVar="live" rightVar="one"/>
     </WaitForCondition>
     <Workspace>
@@ -99,6 +109,9 @@ TEST_F(WaitForConditionTest, Failure)
     </Workspace>
 )"};
 
+  // Simulated time: the timeout expires without waiting for it
+  ManualControlClock clock;
+  ScopedControlClock scoped_clock{clock};
   test::NullUserInterface ui;
   auto proc = ParseProcedureString(test::CreateProcedureString(body));
   EXPECT_TRUE(test::TryAndExecute(proc, ui, ExecutionStatus::FAILURE));
@@ -174,3 +187,397 @@ TEST_F(WaitForConditionTest, VariableTimeoutNotPresent)
   auto proc = ParseProcedureString(test::CreateProcedureString(body));
   EXPECT_TRUE(test::TryAndExecute(proc, ui, ExecutionStatus::FAILURE));
 }
+
+TEST_F(WaitForConditionTest, EventDrivenSuccess)
+{
+  test::ScopedControlMetrics metrics_enabled;
+  const std::string body{R"(
+    <ParallelSequence>
+        <WaitForCondition timeout="1.0" eventDriven="true">
+            <Equals leftVar="live" rightVar="one"/>
+        </WaitForCondition>
+        <Sequence>
+            <Wait timeout="0.3"/>
+            <Copy inputVar="one" outputVar="live"/>
+        </Sequence>
+    </ParallelSequence>
+    <Workspace>
+        <Local name="live" type='{"type":"uint64"}' value='0' />
+        <Local name="one" type='{"type":"uint64"}' value='1' />
+    </Workspace>
+)"};
+
+  test::NullUserInterface ui;
+  auto proc = ParseProcedureString(test::CreateProcedureString(body));
+  EXPECT_TRUE(test::TryAndExecute(proc, ui));
+  // Only evaluated initially and after the single change of the 'live' variable
+  auto root = proc->RootInstruction();
+  ASSERT_NE(root, nullptr);
+  auto instr = dynamic_cast<WaitForConditionInstruction*>(root->ChildInstructions()[0]);
+  ASSERT_NE(instr, nullptr);
+  EXPECT_EQ(instr->GetControlMetrics().GetSnapshot().m_condition_evaluations, 2);
+}
+
+TEST_F(WaitForConditionTest, EventDrivenFailure)
+{
+  test::ScopedControlMetrics metrics_enabled;
+  const std::string body{R"(
+    <WaitForCondition timeout="60.0" eventDriven="true">
+        <Equals leftVar="live" rightVar="one"/>
+    </WaitForCondition>
+    <Workspace>
+        <Local name="live" type='{"type":"uint64"}' value='0' />
+        <Local name="one" type='{"type":"uint64"}' value='1' />
+    </Workspace>
+)"};
+
+  ManualControlClock clock;
+  ScopedControlClock scoped_clock{clock};
+  test::NullUserInterface ui;
+  auto proc = ParseProcedureString(test::CreateProcedureString(body));
+  EXPECT_TRUE(test::TryAndExecuteNoReset(proc, ui, ExecutionStatus::FAILURE));
+  auto instr = dynamic_cast<WaitForConditionInstruction*>(proc->RootInstruction());
+  ASSERT_NE(instr, nullptr);
+  EXPECT_EQ(instr->GetControlMetrics().GetSnapshot().m_condition_evaluations, 1);
+  proc->Reset(ui);
+}
+
+TEST_F(WaitForConditionTest, PollingReevaluatesEveryTick)
+{
+  const std::string body{R"(
+    <WaitForCondition timeout="60.0">
+        <CountingCondition varName="live"/>
+    </WaitForCondition>
+    <Workspace>
+        <Local name="live" type='{"type":"uint64"}' value='0' />
+    </Workspace>
+)"};
+
+  ManualControlClock clock;
+  ScopedControlClock scoped_clock{clock};
+  test::NullUserInterface ui;
+  test::CountingCondition::ResetExecutionCount();
+  auto proc = ParseProcedureString(test::CreateProcedureString(body));
+  EXPECT_TRUE(test::TryAndExecute(proc, ui, ExecutionStatus::FAILURE));
+  EXPECT_GT(test::CountingCondition::GetExecutionCount(), 1);
+}
+
+TEST_F(WaitForConditionTest, EventDrivenVariableTimeout)
+{
+  const std::string body{R"(
+    <ParallelSequence>
+        <WaitForCondition timeout="@timeout" eventDriven="true">
+            <Equals leftVar="live" rightVar="one"/>
+        </WaitForCondition>
+        <Sequence>
+            <Wait timeout="0.1"/>
+            <Copy inputVar="one" outputVar="live"/>
+        </Sequence>
+    </ParallelSequence>
+    <Workspace>
+        <Local name="live" type='{"type":"uint64"}' value='0' />
+        <Local name="one" type='{"type":"uint64"}' value='1' />
+        <Local name="timeout" type='{"type":"float64"}' value='1.0' />
+    </Workspace>
+)"};
+
+  test::NullUserInterface ui;
+  auto proc = ParseProcedureString(test::CreateProcedureString(body));
+  EXPECT_TRUE(test::TryAndExecute(proc, ui));
+}
+
+TEST_F(WaitForConditionTest, EventDrivenVariableTimeoutNotPresent)
+{
+  const std::string body{R"(
+    <WaitForCondition timeout="@timeout" eventDriven="true">
+        <Equals leftVar="live" rightVar="one"/>
+    </WaitForCondition>
+    <Workspace>
+        <Local name="live" type='{"type":"uint64"}' value='0' />
+        <Local name="one" type='{"type":"uint64"}' value='1' />
+    </Workspace>
+)"};
+
+  test::NullUserInterface ui;
+  auto proc = ParseProcedureString(test::CreateProcedureString(body));
+  EXPECT_TRUE(test::TryAndExecute(proc, ui, ExecutionStatus::FAILURE));
+}
+
+TEST_F(WaitForConditionTest, EventDrivenUnknownAttributeFallsBackToPolling)
+{
+  const std::string body{R"(
+    <WaitForCondition timeout="3600.0" eventDriven="true">
+        <Repeat maxCount="1">
+            <Equals leftVar="live" rightVar="one"/>
+        </Repeat>
+    </WaitForCondition>
+    <Workspace>
+        <Local name="live" type='{"type":"uint64"}' value='0' />
+        <Local name="one" type='{"type":"uint64"}' value='1' />
+    </Workspace>
+)"};
+
+  test::NullUserInterface ui;
+  auto proc = ParseProcedureString(test::CreateProcedureString(body));
+  proc->Setup();
+  proc->ExecuteSingle(ui);
+  EXPECT_EQ(proc->GetStatus(), ExecutionStatus::RUNNING);
+  auto instr = dynamic_cast<WaitForConditionInstruction*>(proc->RootInstruction());
+  ASSERT_NE(instr, nullptr);
+  auto hint = instr->GetWakeUpHint();
+  EXPECT_TRUE(hint.m_polling);
+  EXPECT_FALSE(hint.m_on_variable_change);
+  proc->Reset(ui);
+}
+
+TEST_F(WaitForConditionTest, EventDrivenTimeDependentConditionFallsBackToPolling)
+{
+  // The outcome of a Wait does not only depend on the variables it references
+  const std::string body{R"(
+    <WaitForCondition timeout="3600.0" eventDriven="true">
+        <Sequence>
+            <Wait timeout="@delay"/>
+            <Equals leftVar="live" rightVar="one"/>
+        </Sequence>
+    </WaitForCondition>
+    <Workspace>
+        <Local name="live" type='{"type":"uint64"}' value='1' />
+        <Local name="one" type='{"type":"uint64"}' value='1' />
+        <Local name="delay" type='{"type":"float64"}' value='60.0' />
+    </Workspace>
+)"};
+
+  test::NullUserInterface ui;
+  auto proc = ParseProcedureString(test::CreateProcedureString(body));
+  proc->Setup();
+  proc->ExecuteSingle(ui);
+  EXPECT_EQ(proc->GetStatus(), ExecutionStatus::RUNNING);
+  auto instr = dynamic_cast<WaitForConditionInstruction*>(proc->RootInstruction());
+  ASSERT_NE(instr, nullptr);
+  auto hint = instr->GetWakeUpHint();
+  EXPECT_TRUE(hint.m_polling);
+  EXPECT_FALSE(hint.m_on_variable_change);
+  proc->Reset(ui);
+}
+
+TEST_F(WaitForConditionTest, ReferencedVariableNames)
+{
+  auto condition = GlobalInstructionRegistry().Create("Equals");
+  ASSERT_TRUE(condition);
+  ASSERT_TRUE(condition->AddAttribute("leftVar", "live.value"));
+  ASSERT_TRUE(condition->AddAttribute("rightVar", "one"));
+  ASSERT_TRUE(condition->AddAttribute("name", "check"));
+  EXPECT_EQ(GetReferencedVariableNames(*condition), (std::set<std::string>{"live", "one"}));
+  EXPECT_TRUE(AreReferencedVariableNamesComplete(*condition));
+
+  auto repeat = GlobalInstructionRegistry().Create("Repeat");
+  ASSERT_TRUE(repeat);
+  ASSERT_TRUE(repeat->AddAttribute("maxCount", "@count"));
+  ASSERT_TRUE(repeat->InsertInstruction(std::move(condition), 0));
+  EXPECT_EQ(GetReferencedVariableNames(*repeat),
+            (std::set<std::string>{"count", "live", "one"}));
+  EXPECT_TRUE(AreReferencedVariableNamesComplete(*repeat));
+
+  // Literal attribute values that are not known to be variable names
+  auto literal_repeat = GlobalInstructionRegistry().Create("Repeat");
+  ASSERT_TRUE(literal_repeat);
+  ASSERT_TRUE(literal_repeat->AddAttribute("maxCount", "2"));
+  EXPECT_FALSE(AreReferencedVariableNamesComplete(*literal_repeat));
+}
+
+TEST_F(WaitForConditionTest, SubMillisecondTimeout)
+{
+  auto instr = GlobalInstructionRegistry().Create("WaitForCondition");
+  auto condition = GlobalInstructionRegistry().Create(test::CountingCondition::Type);
+  ASSERT_TRUE(instr);
+  ASSERT_TRUE(condition);
+  ASSERT_TRUE(condition->AddAttribute("varName", "live"));
+  ASSERT_TRUE(instr->InsertInstruction(std::move(condition), 0));
+  ASSERT_TRUE(instr->AddAttribute("timeout", "0.0005"));
+  Procedure proc;
+  ASSERT_NO_THROW(instr->Setup(proc));
+
+  // Condition fails, since the variable is not present in the workspace. Simulated time makes
+  // the expiry exact and independent of the load of the machine.
+  ManualControlClock clock;
+  ScopedControlClock scoped_clock{clock};
+  test::NullUserInterface ui;
+  Workspace ws;
+  auto wait_instr = dynamic_cast<WaitForConditionInstruction*>(instr.get());
+  ASSERT_NE(wait_instr, nullptr);
+  instr->ExecuteSingle(ui, ws);
+  EXPECT_EQ(instr->GetStatus(), ExecutionStatus::RUNNING);
+  EXPECT_EQ(wait_instr->GetTimeRemaining(), std::chrono::microseconds(500));
+
+  clock.Advance(std::chrono::microseconds(499));
+  instr->ExecuteSingle(ui, ws);
+  EXPECT_EQ(instr->GetStatus(), ExecutionStatus::RUNNING);
+  EXPECT_EQ(wait_instr->GetTimeRemaining(), std::chrono::microseconds(1));
+
+  clock.Advance(std::chrono::microseconds(1));
+  instr->ExecuteSingle(ui, ws);
+  EXPECT_EQ(instr->GetStatus(), ExecutionStatus::FAILURE);
+}
+
+TEST_F(WaitForConditionTest, TimeRemaining)
+{
+  WaitForConditionInstruction instr;
+  auto condition = GlobalInstructionRegistry().Create(test::CountingCondition::Type);
+  ASSERT_TRUE(condition);
+  ASSERT_TRUE(condition->AddAttribute("varName", "live"));
+  ASSERT_TRUE(instr.InsertInstruction(std::move(condition), 0));
+  ASSERT_TRUE(instr.AddAttribute("timeout", "10.0"));
+  Procedure proc;
+  ASSERT_NO_THROW(instr.Setup(proc));
+  EXPECT_EQ(instr.GetTimeRemaining(), std::chrono::steady_clock::duration::zero());
+
+  test::NullUserInterface ui;
+  Workspace ws;
+  instr.ExecuteSingle(ui, ws);
+  EXPECT_EQ(instr.GetStatus(), ExecutionStatus::RUNNING);
+  EXPECT_GT(instr.GetTimeRemaining(), std::chrono::seconds(9));
+  EXPECT_LE(instr.GetTimeRemaining(), std::chrono::seconds(10));
+
+  instr.Reset(ui);
+  EXPECT_EQ(instr.GetTimeRemaining(), std::chrono::steady_clock::duration::zero());
+}
+
+TEST_F(WaitForConditionTest, SimulatedTimeout)
+{
+  WaitForConditionInstruction instr;
+  auto condition = GlobalInstructionRegistry().Create(test::CountingCondition::Type);
+  ASSERT_TRUE(condition);
+  ASSERT_TRUE(condition->AddAttribute("varName", "live"));
+  ASSERT_TRUE(instr.InsertInstruction(std::move(condition), 0));
+  ASSERT_TRUE(instr.AddAttribute("timeout", "86400.0"));
+  Procedure proc;
+  ASSERT_NO_THROW(instr.Setup(proc));
+
+  ManualControlClock clock;
+  ScopedControlClock scoped_clock{clock};
+  test::NullUserInterface ui;
+  Workspace ws;
+  instr.ExecuteSingle(ui, ws);
+  EXPECT_EQ(instr.GetStatus(), ExecutionStatus::RUNNING);
+  EXPECT_EQ(instr.GetTimeRemaining(), std::chrono::hours(24));
+
+  clock.Advance(std::chrono::hours(20));
+  instr.ExecuteSingle(ui, ws);
+  EXPECT_EQ(instr.GetStatus(), ExecutionStatus::RUNNING);
+  EXPECT_EQ(instr.GetTimeRemaining(), std::chrono::hours(4));
+
+  clock.Advance(std::chrono::hours(4));
+  instr.ExecuteSingle(ui, ws);
+  EXPECT_EQ(instr.GetStatus(), ExecutionStatus::FAILURE);
+}
+
+TEST_F(WaitForConditionTest, CompiledCondition)
+{
+  test::ScopedControlMetrics metrics_enabled;
+  const std::string body{R"(
+    <ParallelSequence>
+        <WaitForCondition timeout="1.0" compileCondition="true">
+            <Sequence>
+                <GreaterThanOrEqual leftVar="live" rightVar="one"/>
+                <Inverter>
+                    <Equals leftVar="live" rightVar="zero"/>
+                </Inverter>
+            </Sequence>
+        </WaitForCondition>
+        <Sequence>
+            <Wait timeout="0.1"/>
+            <Copy inputVar="one" outputVar="live"/>
+        </Sequence>
+    </ParallelSequence>
+    <Workspace>
+        <Local name="live" type='{"type":"uint64"}' value='0' />
+        <Local name="zero" type='{"type":"uint64"}' value='0' />
+        <Local name="one" type='{"type":"uint64"}' value='1' />
+    </Workspace>
+)"};
+
+  test::NullUserInterface ui;
+  auto proc = ParseProcedureString(test::CreateProcedureString(body));
+  EXPECT_TRUE(test::TryAndExecute(proc, ui));
+
+  auto root = proc->RootInstruction();
+  ASSERT_NE(root, nullptr);
+  auto instr = dynamic_cast<WaitForConditionInstruction*>(root->ChildInstructions()[0]);
+  ASSERT_NE(instr, nullptr);
+  EXPECT_TRUE(instr->IsConditionCompiled());
+  EXPECT_GT(instr->GetControlMetrics().GetSnapshot().m_condition_evaluations, 1);
+}
+
+TEST_F(WaitForConditionTest, CompiledConditionFailure)
+{
+  const std::string body{R"(
+    <WaitForCondition timeout="60.0" compileCondition="true">
+        <LessThan leftVar="one" rightVar="zero"/>
+    </WaitForCondition>
+    <Workspace>
+        <Local name="zero" type='{"type":"uint64"}' value='0' />
+        <Local name="one" type='{"type":"uint64"}' value='1' />
+    </Workspace>
+)"};
+
+  ManualControlClock clock;
+  ScopedControlClock scoped_clock{clock};
+  test::NullUserInterface ui;
+  auto proc = ParseProcedureString(test::CreateProcedureString(body));
+  EXPECT_TRUE(test::TryAndExecute(proc, ui, ExecutionStatus::FAILURE));
+}
+
+TEST_F(WaitForConditionTest, CompiledConditionNotCompilable)
+{
+  const std::string body{R"(
+    <ParallelSequence>
+        <WaitForCondition timeout="1.0" compileCondition="true">
+            <CountingCondition varName="live"/>
+        </WaitForCondition>
+        <Sequence>
+            <Wait timeout="0.1"/>
+            <Copy inputVar="one" outputVar="live"/>
+        </Sequence>
+    </ParallelSequence>
+    <Workspace>
+        <Local name="live" type='{"type":"uint64"}' value='0' />
+        <Local name="one" type='{"type":"uint64"}' value='1' />
+    </Workspace>
+)"};
+
+  test::NullUserInterface ui;
+  test::CountingCondition::ResetExecutionCount();
+  auto proc = ParseProcedureString(test::CreateProcedureString(body));
+  EXPECT_TRUE(test::TryAndExecute(proc, ui));
+  // Falls back to executing the condition tree
+  EXPECT_GT(test::CountingCondition::GetExecutionCount(), 1);
+
+  auto root = proc->RootInstruction();
+  ASSERT_NE(root, nullptr);
+  auto instr = dynamic_cast<WaitForConditionInstruction*>(root->ChildInstructions()[0]);
+  ASSERT_NE(instr, nullptr);
+  EXPECT_FALSE(instr->IsConditionCompiled());
+}
+
+TEST_F(WaitForConditionTest, CompiledConditionMissingVariable)
+{
+  WaitForConditionInstruction instr;
+  auto condition = GlobalInstructionRegistry().Create("Equals");
+  ASSERT_TRUE(condition);
+  ASSERT_TRUE(condition->AddAttribute("leftVar", "live"));
+  ASSERT_TRUE(condition->AddAttribute("rightVar", "one"));
+  ASSERT_TRUE(instr.InsertInstruction(std::move(condition), 0));
+  ASSERT_TRUE(instr.AddAttribute("timeout", "10.0"));
+  ASSERT_TRUE(instr.AddAttribute("compileCondition", "true"));
+  Procedure proc;
+  ASSERT_NO_THROW(instr.Setup(proc));
+  EXPECT_TRUE(instr.IsConditionCompiled());
+
+  // The program cannot read the variables and the condition tree is executed instead
+  test::NullUserInterface ui;
+  Workspace ws;
+  instr.ExecuteSingle(ui, ws);
+  EXPECT_EQ(instr.GetStatus(), ExecutionStatus::RUNNING);
+  EXPECT_EQ(instr.ChildInstructions()[0]->GetStatus(), ExecutionStatus::FAILURE);
+  instr.Reset(ui);
+}
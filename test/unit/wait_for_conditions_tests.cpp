@@ -0,0 +1,266 @@
+/******************************************************************************
+* $HeadURL: $
+* $Id: $
+*
+* Project       : Supervision and Automation - oac-tree
+*
+* Description   : SUP oac-tree control plugin
+*
+* Author        : Walter Van Herck (IO)
+*
+* Copyright (c) : 2010-2026 ITER Organization,
+*                 CS 90 046
+*                 13067 St. Paul-lez-Durance Cedex
+*                 France
+* SPDX-License-Identifier: MIT
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file LICENSE located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+
+#include "test_instructions.h"
+#include "test_user_interface.h"
+#include "unit_test_helper.h"
+
+#include "oac-tree/control/wait_for_conditions_instruction.h"
+
+#include <sup/oac-tree/instruction_registry.h>
+#include <sup/oac-tree/sequence_parser.h>
+
+#include <sup/oac-tree/workspace.h>
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace sup::oac_tree;
+
+class WaitForConditionsTest : public ::testing::Test
+{
+protected:
+  WaitForConditionsTest() = default;
+  virtual ~WaitForConditionsTest() = default;
+};
+
+static const std::string kWorkspace{R"(
+    <Workspace>
+        <Local name="a" type='{"type":"uint64"}' value='0' />
+        <Local name="b" type='{"type":"uint64"}' value='0' />
+        <Local name="zero" type='{"type":"uint64"}' value='0' />
+        <Local name="one" type='{"type":"uint64"}' value='1' />
+    </Workspace>
+)"};
+
+TEST_F(WaitForConditionsTest, AllSuccess)
+{
+  // The conditions become true one after the other and the first one becomes false again
+  const std::string body{R"(
+    <ParallelSequence>
+        <WaitForAllConditions timeout="2.0">
+            <Equals leftVar="a" rightVar="one"/>
+            <Equals leftVar="b" rightVar="one"/>
+        </WaitForAllConditions>
+        <Sequence>
+            <Wait timeout="0.05"/>
+            <Copy inputVar="one" outputVar="a"/>
+            <Wait timeout="0.05"/>
+            <Copy inputVar="zero" outputVar="a"/>
+            <Copy inputVar="one" outputVar="b"/>
+        </Sequence>
+    </ParallelSequence>
+)" + kWorkspace};
+
+  test::NullUserInterface ui;
+  auto proc = ParseProcedureString(test::CreateProcedureString(body));
+  EXPECT_TRUE(test::TryAndExecute(proc, ui));
+}
+
+TEST_F(WaitForConditionsTest, AllFailure)
+{
+  const std::string body{R"(
+    <WaitForAllConditions timeout="0.1">
+        <Equals leftVar="one" rightVar="one"/>
+        <Equals leftVar="a" rightVar="one"/>
+    </WaitForAllConditions>
+)" + kWorkspace};
+
+  test::NullUserInterface ui;
+  auto proc = ParseProcedureString(test::CreateProcedureString(body));
+  EXPECT_TRUE(test::TryAndExecute(proc, ui, ExecutionStatus::FAILURE));
+}
+
+TEST_F(WaitForConditionsTest, AnySuccess)
+{
+  const std::string body{R"(
+    <ParallelSequence>
+        <WaitForAnyCondition timeout="2.0">
+            <Equals leftVar="a" rightVar="one"/>
+            <Equals leftVar="b" rightVar="one"/>
+        </WaitForAnyCondition>
+        <Sequence>
+            <Wait timeout="0.05"/>
+            <Copy inputVar="one" outputVar="b"/>
+        </Sequence>
+    </ParallelSequence>
+)" + kWorkspace};
+
+  test::NullUserInterface ui;
+  auto proc = ParseProcedureString(test::CreateProcedureString(body));
+  EXPECT_TRUE(test::TryAndExecute(proc, ui));
+}
+
+TEST_F(WaitForConditionsTest, AnyFailure)
+{
+  const std::string body{R"(
+    <WaitForAnyCondition timeout="0.1">
+        <Equals leftVar="a" rightVar="one"/>
+        <Equals leftVar="b" rightVar="one"/>
+    </WaitForAnyCondition>
+)" + kWorkspace};
+
+  test::NullUserInterface ui;
+  auto proc = ParseProcedureString(test::CreateProcedureString(body));
+  EXPECT_TRUE(test::TryAndExecute(proc, ui, ExecutionStatus::FAILURE));
+}
+
+TEST_F(WaitForConditionsTest, Threshold)
+{
+  const std::string body_template{R"(
+    <WaitForConditions timeout="0.1" threshold="THRESHOLD">
+        <Equals leftVar="one" rightVar="one"/>
+        <Equals leftVar="a" rightVar="one"/>
+        <Equals leftVar="zero" rightVar="zero"/>
+    </WaitForConditions>
+)" + kWorkspace};
+
+  test::NullUserInterface ui;
+  for (const auto& [threshold, expected] :
+       std::vector<std::pair<std::string, ExecutionStatus>>{{"1", ExecutionStatus::SUCCESS},
+                                                            {"2", ExecutionStatus::SUCCESS},
+                                                            {"3", ExecutionStatus::FAILURE}})
+  {
+    auto body = body_template;
+    body.replace(body.find("THRESHOLD"), std::string{"THRESHOLD"}.size(), threshold);
+    auto proc = ParseProcedureString(test::CreateProcedureString(body));
+    EXPECT_TRUE(test::TryAndExecute(proc, ui, expected)) << threshold;
+  }
+}
+
+TEST_F(WaitForConditionsTest, SettledConditionsNotEvaluated)
+{
+  const std::string body{R"(
+    <WaitForAllConditions timeout="3600.0">
+        <CountingCondition varName="one"/>
+        <CountingCondition varName="one"/>
+        <CountingCondition varName="a"/>
+    </WaitForAllConditions>
+)" + kWorkspace};
+
+  test::NullUserInterface ui;
+  auto proc = ParseProcedureString(test::CreateProcedureString(body));
+  proc->Setup();
+  test::CountingCondition::ResetExecutionCount();
+  proc->ExecuteSingle(ui);
+  EXPECT_EQ(test::CountingCondition::GetExecutionCount(), 3);
+
+  // Only the unsatisfied condition is evaluated on the next ticks
+  proc->ExecuteSingle(ui);
+  proc->ExecuteSingle(ui);
+  EXPECT_EQ(test::CountingCondition::GetExecutionCount(), 5);
+  EXPECT_EQ(proc->GetStatus(), ExecutionStatus::RUNNING);
+
+  auto instr = dynamic_cast<WaitForConditionsInstruction*>(proc->RootInstruction());
+  ASSERT_NE(instr, nullptr);
+  EXPECT_EQ(instr->GetRequiredCount(), 3u);
+  EXPECT_EQ(instr->GetSatisfiedCount(), 2u);
+  auto hint = instr->GetWakeUpHint();
+  EXPECT_TRUE(hint.m_polling);
+  EXPECT_GT(instr->GetTimeRemaining(), DeadlineTimer::Clock::duration::zero());
+
+  // After a reset, all conditions are evaluated again
+  proc->Reset(ui);
+  EXPECT_EQ(instr->GetSatisfiedCount(), 0u);
+  test::CountingCondition::ResetExecutionCount();
+  proc->ExecuteSingle(ui);
+  EXPECT_EQ(test::CountingCondition::GetExecutionCount(), 3);
+  proc->Reset(ui);
+}
+
+TEST_F(WaitForConditionsTest, RunningConditionsHaltedOnSuccess)
+{
+  const std::string body{R"(
+    <WaitForAnyCondition timeout="3600.0">
+        <RunningAction/>
+        <CountingCondition varName="one"/>
+    </WaitForAnyCondition>
+)" + kWorkspace};
+
+  test::NullUserInterface ui;
+  auto proc = ParseProcedureString(test::CreateProcedureString(body));
+  proc->Setup();
+  test::RunningAction::ResetHaltCount();
+  proc->ExecuteSingle(ui);
+  EXPECT_EQ(proc->GetStatus(), ExecutionStatus::SUCCESS);
+  // The still running condition was halted, since the instruction finished
+  EXPECT_EQ(test::RunningAction::GetHaltCount(), 1u);
+  proc->Reset(ui);
+}
+
+TEST_F(WaitForConditionsTest, Metrics)
+{
+  test::ScopedControlMetrics metrics_enabled;
+  const std::string body{R"(
+    <WaitForAnyCondition timeout="0.0">
+        <Equals leftVar="a" rightVar="one"/>
+        <Equals leftVar="b" rightVar="one"/>
+    </WaitForAnyCondition>
+)" + kWorkspace};
+
+  test::NullUserInterface ui;
+  auto proc = ParseProcedureString(test::CreateProcedureString(body));
+  EXPECT_TRUE(test::TryAndExecute(proc, ui, ExecutionStatus::FAILURE));
+
+  auto instr = dynamic_cast<WaitForConditionsInstruction*>(proc->RootInstruction());
+  ASSERT_NE(instr, nullptr);
+  auto metrics = instr->GetControlMetrics().GetSnapshot();
+  EXPECT_EQ(metrics.m_ticks, 1);
+  EXPECT_EQ(metrics.m_condition_evaluations, 2);
+  EXPECT_EQ(metrics.m_timeouts, 1);
+}
+
+TEST_F(WaitForConditionsTest, Setup)
+{
+  const std::vector<std::string> invalid_bodies = {
+    // No children
+    R"(<WaitForAllConditions timeout="1.0"/>)",
+    R"(<WaitForAnyCondition timeout="1.0"/>)",
+    // Missing timeout
+    R"(<WaitForAllConditions><Wait/></WaitForAllConditions>)",
+    // Missing threshold
+    R"(<WaitForConditions timeout="1.0"><Wait/></WaitForConditions>)",
+    // Threshold out of range
+    R"(<WaitForConditions timeout="1.0" threshold="0"><Wait/></WaitForConditions>)",
+    R"(<WaitForConditions timeout="1.0" threshold="2"><Wait/></WaitForConditions>)"
+  };
+  for (const auto& instr_xml : invalid_bodies)
+  {
+    auto proc = ParseProcedureString(test::CreateProcedureString(instr_xml + kWorkspace));
+    EXPECT_THROW(proc->Setup(), InstructionSetupException) << instr_xml;
+  }
+  {
+    // Threshold is not an attribute of the special cases
+    auto instr = GlobalInstructionRegistry().Create("WaitForAnyCondition");
+    auto wait = GlobalInstructionRegistry().Create("Wait");
+    ASSERT_TRUE(instr);
+    ASSERT_TRUE(wait);
+    ASSERT_TRUE(instr->InsertInstruction(std::move(wait), 0));
+    EXPECT_TRUE(instr->AddAttribute("timeout", "1.0"));
+    Procedure proc;
+    EXPECT_NO_THROW(instr->Setup(proc));
+  }
+}
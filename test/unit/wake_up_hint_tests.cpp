@@ -0,0 +1,202 @@
+/******************************************************************************
+* $HeadURL: $
+* $Id: $
+*
+* Project       : Supervision and Automation - oac-tree
+*
+* Description   : SUP oac-tree control plugin
+*
+* Author        : Walter Van Herck (IO)
+*
+* Copyright (c) : 2010-2026 ITER Organization,
+*                 CS 90 046
+*                 13067 St. Paul-lez-Durance Cedex
+*                 France
+* SPDX-License-Identifier: MIT
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file LICENSE located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+
+#include "test_user_interface.h"
+#include "unit_test_helper.h"
+
+#include "oac-tree/control/wake_up_hint.h"
+
+#include <sup/oac-tree/sequence_parser.h>
+
+#include <gtest/gtest.h>
+
+using namespace sup::oac_tree;
+
+class WakeUpHintTest : public ::testing::Test
+{
+protected:
+  WakeUpHintTest() = default;
+  virtual ~WakeUpHintTest() = default;
+
+  WakeUpHint GetHintAfterFirstTick(const std::string& body);
+
+  test::NullUserInterface m_ui;
+  std::unique_ptr<Procedure> m_proc;
+};
+
+TEST_F(WakeUpHintTest, Combine)
+{
+  auto now = WakeUpHint::Clock::now();
+  WakeUpHint left;
+  left.m_deadline = now + std::chrono::seconds(2);
+  left.m_on_variable_change = true;
+  WakeUpHint right;
+  right.m_deadline = now + std::chrono::seconds(1);
+  auto combined = CombineWakeUpHints(left, right);
+  EXPECT_EQ(combined.m_deadline, right.m_deadline);
+  EXPECT_TRUE(combined.m_on_variable_change);
+  EXPECT_FALSE(combined.m_polling);
+
+  combined = CombineWakeUpHints(combined, PollingWakeUpHint());
+  EXPECT_EQ(combined.m_deadline, right.m_deadline);
+  EXPECT_TRUE(combined.m_polling);
+
+  combined = CombineWakeUpHints(combined, ImmediateWakeUpHint());
+  EXPECT_EQ(combined.m_deadline, WakeUpHint::Clock::time_point::min());
+}
+
+TEST_F(WakeUpHintTest, NextWakeUpTime)
+{
+  auto now = WakeUpHint::Clock::now();
+  const auto poll_period = std::chrono::milliseconds(100);
+
+  // Immediate
+  EXPECT_EQ(GetNextWakeUpTime(ImmediateWakeUpHint(), now, poll_period), now);
+
+  // Polling without deadline
+  EXPECT_EQ(GetNextWakeUpTime(PollingWakeUpHint(), now, poll_period), now + poll_period);
+
+  // Deadline before the next poll
+  auto hint = PollingWakeUpHint();
+  hint.m_deadline = now + std::chrono::milliseconds(20);
+  EXPECT_EQ(GetNextWakeUpTime(hint, now, poll_period), hint.m_deadline);
+
+  // Waiting for a variable change is bounded by the poll period
+  hint.m_polling = false;
+  hint.m_on_variable_change = true;
+  hint.m_deadline = now + std::chrono::seconds(5);
+  EXPECT_EQ(GetNextWakeUpTime(hint, now, poll_period), now + poll_period);
+
+  // Only a deadline
+  hint.m_on_variable_change = false;
+  EXPECT_EQ(GetNextWakeUpTime(hint, now, poll_period), hint.m_deadline);
+}
+
+TEST_F(WakeUpHintTest, WaitForConditionPolling)
+{
+  const std::string body{R"(
+    <WaitForCondition timeout="1.0">
+        <CountingCondition varName="live"/>
+    </WaitForCondition>
+    <Workspace>
+        <Local name="live" type='{"type":"uint64"}' value='0' />
+    </Workspace>
+)"};
+
+  auto before = WakeUpHint::Clock::now();
+  auto hint = GetHintAfterFirstTick(body);
+  EXPECT_TRUE(hint.m_polling);
+  EXPECT_FALSE(hint.m_on_variable_change);
+  EXPECT_GT(hint.m_deadline, before);
+  EXPECT_LE(hint.m_deadline, WakeUpHint::Clock::now() + std::chrono::seconds(1));
+  m_proc->Reset(m_ui);
+}
+
+TEST_F(WakeUpHintTest, WaitForConditionEventDriven)
+{
+  const std::string body{R"(
+    <WaitForCondition timeout="1.0" eventDriven="true">
+        <Equals leftVar="live" rightVar="one"/>
+    </WaitForCondition>
+    <Workspace>
+        <Local name="live" type='{"type":"uint64"}' value='0' />
+        <Local name="one" type='{"type":"uint64"}' value='1' />
+    </Workspace>
+)"};
+
+  auto before = WakeUpHint::Clock::now();
+  auto hint = GetHintAfterFirstTick(body);
+  EXPECT_FALSE(hint.m_polling);
+  EXPECT_TRUE(hint.m_on_variable_change);
+  EXPECT_GT(hint.m_deadline, before);
+  EXPECT_LE(hint.m_deadline, WakeUpHint::Clock::now() + std::chrono::seconds(1));
+  m_proc->Reset(m_ui);
+}
+
+TEST_F(WakeUpHintTest, WaitForConditionPendingChange)
+{
+  const std::string body{R"(
+    <ParallelSequence>
+        <WaitForCondition timeout="1.0" eventDriven="true">
+            <Equals leftVar="live" rightVar="one"/>
+        </WaitForCondition>
+        <Copy inputVar="one" outputVar="live"/>
+    </ParallelSequence>
+    <Workspace>
+        <Local name="live" type='{"type":"uint64"}' value='0' />
+        <Local name="one" type='{"type":"uint64"}' value='1' />
+    </Workspace>
+)"};
+
+  // Variable changed after the condition was evaluated: tick again immediately
+  auto hint = GetHintAfterFirstTick(body);
+  EXPECT_EQ(hint.m_deadline, WakeUpHint::Clock::time_point::min());
+  m_proc->ExecuteSingle(m_ui);
+  EXPECT_EQ(m_proc->GetStatus(), ExecutionStatus::SUCCESS);
+  m_proc->Reset(m_ui);
+}
+
+TEST_F(WakeUpHintTest, CombinedTree)
+{
+  const std::string body{R"(
+    <ParallelSequence>
+        <WaitForCondition timeout="1.0" eventDriven="true">
+            <Equals leftVar="live" rightVar="one"/>
+        </WaitForCondition>
+        <AchieveConditionWithTimeout timeout="0.5">
+            <CountingCondition varName="live"/>
+            <Succeed/>
+        </AchieveConditionWithTimeout>
+    </ParallelSequence>
+    <Workspace>
+        <Local name="live" type='{"type":"uint64"}' value='0' />
+        <Local name="one" type='{"type":"uint64"}' value='1' />
+    </Workspace>
+)"};
+
+  auto hint = GetHintAfterFirstTick(body);
+  for (int i = 0; i < 3; ++i)
+  {
+    m_proc->ExecuteSingle(m_ui);
+  }
+  ASSERT_EQ(m_proc->GetStatus(), ExecutionStatus::RUNNING);
+  hint = GetWakeUpHint(*m_proc->RootInstruction());
+  // Deadline of AchieveConditionWithTimeout is the earliest
+  EXPECT_TRUE(hint.m_polling);
+  EXPECT_TRUE(hint.m_on_variable_change);
+  EXPECT_LE(hint.m_deadline, WakeUpHint::Clock::now() + std::chrono::milliseconds(500));
+  EXPECT_GT(hint.m_deadline, WakeUpHint::Clock::now() + std::chrono::milliseconds(250));
+  m_proc->Reset(m_ui);
+}
+
+WakeUpHint WakeUpHintTest::GetHintAfterFirstTick(const std::string& body)
+{
+  m_proc = ParseProcedureString(test::CreateProcedureString(body));
+  EXPECT_TRUE(m_proc);
+  m_proc->Setup();
+  m_proc->ExecuteSingle(m_ui);
+  EXPECT_EQ(m_proc->GetStatus(), ExecutionStatus::RUNNING);
+  auto root = m_proc->RootInstruction();
+  EXPECT_NE(root, nullptr);
+  return GetWakeUpHint(*root);
+}
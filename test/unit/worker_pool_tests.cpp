@@ -0,0 +1,100 @@
+/******************************************************************************
+* $HeadURL: $
+* $Id: $
+*
+* Project       : Supervision and Automation - oac-tree
+*
+* Description   : SUP oac-tree control plugin
+*
+* Author        : Walter Van Herck (IO)
+*
+* Copyright (c) : 2010-2026 ITER Organization,
+*                 CS 90 046
+*                 13067 St. Paul-lez-Durance Cedex
+*                 France
+* SPDX-License-Identifier: MIT
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file LICENSE located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+
+#include "oac-tree/control/worker_pool.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <future>
+
+using namespace sup::oac_tree;
+
+class WorkerPoolTest : public ::testing::Test
+{
+protected:
+  WorkerPoolTest() = default;
+  virtual ~WorkerPoolTest() = default;
+};
+
+TEST_F(WorkerPoolTest, ExecuteTasks)
+{
+  std::atomic<int> counter{0};
+  {
+    WorkerPool pool{2, 16};
+    EXPECT_EQ(pool.GetWorkerCount(), 2);
+    EXPECT_EQ(pool.GetMaxQueueSize(), 16);
+    for (int idx = 0; idx < 10; ++idx)
+    {
+      EXPECT_TRUE(pool.Submit([&counter]{ ++counter; }));
+    }
+    // Destruction executes the remaining tasks
+  }
+  EXPECT_EQ(counter.load(), 10);
+}
+
+TEST_F(WorkerPoolTest, BoundedQueue)
+{
+  std::promise<void> release;
+  auto released = release.get_future().share();
+  std::promise<void> started;
+  WorkerPool pool{1, 2};
+  EXPECT_TRUE(pool.Submit([&started, released]{
+    started.set_value();
+    released.wait();
+  }));
+  started.get_future().wait();
+
+  // Worker is blocked: tasks are queued until the queue is full
+  EXPECT_TRUE(pool.Submit([]{}));
+  EXPECT_TRUE(pool.Submit([]{}));
+  EXPECT_FALSE(pool.Submit([]{}));
+  auto metrics = pool.GetMetrics();
+  EXPECT_EQ(metrics.m_queue_depth, 2);
+  EXPECT_EQ(metrics.m_max_queue_depth, 2);
+  EXPECT_EQ(metrics.m_submitted, 3);
+  EXPECT_EQ(metrics.m_rejected, 1);
+
+  release.set_value();
+  std::promise<void> done;
+  auto done_future = done.get_future();
+  while (!pool.Submit([&done]{ done.set_value(); }))
+  {}
+  done_future.wait();
+  metrics = pool.GetMetrics();
+  EXPECT_EQ(metrics.m_queue_depth, 0);
+  EXPECT_GE(metrics.m_completed, 3);
+  EXPECT_GE(metrics.m_total_dispatch_latency, metrics.m_max_dispatch_latency);
+  EXPECT_GT(metrics.m_max_dispatch_latency, std::chrono::steady_clock::duration::zero());
+}
+
+TEST_F(WorkerPoolTest, ControlWorkerPool)
+{
+  auto& pool = GetControlWorkerPool();
+  EXPECT_EQ(std::addressof(pool), std::addressof(GetControlWorkerPool()));
+  EXPECT_GE(pool.GetWorkerCount(), 2);
+  std::promise<void> done;
+  auto done_future = done.get_future();
+  EXPECT_TRUE(pool.Submit([&done]{ done.set_value(); }));
+  done_future.wait();
+}
@@ -0,0 +1,228 @@
+/******************************************************************************
+* $HeadURL: $
+* $Id: $
+*
+* Project       : Supervision and Automation - oac-tree
+*
+* Description   : SUP oac-tree control plugin
+*
+* Author        : Walter Van Herck (IO)
+*
+* Copyright (c) : 2010-2026 ITER Organization,
+*                 CS 90 046
+*                 13067 St. Paul-lez-Durance Cedex
+*                 France
+* SPDX-License-Identifier: MIT
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file LICENSE located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+
+#include "test_user_interface.h"
+
+#include "oac-tree/control/wrapped_instruction_manager.h"
+
+#include <sup/oac-tree/log_severity.h>
+#include <sup/oac-tree/procedure.h>
+#include <sup/oac-tree/workspace.h>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+using namespace sup::oac_tree;
+
+namespace
+{
+/**
+ * @brief Instruction that records the UserInterface it was executed with.
+ */
+class UserInterfaceRecorder : public Instruction
+{
+public:
+  UserInterfaceRecorder();
+  ~UserInterfaceRecorder() override = default;
+
+  UserInterface* GetLastUserInterface() const;
+
+private:
+  ExecutionStatus ExecuteSingleImpl(UserInterface& ui, Workspace& ws) override;
+  UserInterface* m_last_ui;
+};
+}  // unnamed namespace
+
+class WrappedInstructionManagerTest : public ::testing::Test
+{
+protected:
+  WrappedInstructionManagerTest();
+  virtual ~WrappedInstructionManagerTest() = default;
+
+  void ExecuteWrapper(Instruction& wrapper, UserInterface& ui);
+
+  Procedure m_proc;
+  Workspace m_ws;
+  UserInterfaceRecorder m_recorder;
+};
+
+TEST_F(WrappedInstructionManagerTest, SameUserInterface)
+{
+  test::LogUserInterface ui;
+  WrappedInstructionManager manager;
+  auto wrapper = manager.CreateInstructionWrapper(m_recorder);
+  auto& wrapped_ui = manager.GetWrappedUI(ui, "prefix: ");
+  auto& wrapped_ui_2 = manager.GetWrappedUI(ui, "prefix: ");
+  EXPECT_EQ(std::addressof(wrapped_ui), std::addressof(wrapped_ui_2));
+
+  // Wrapped instruction is executed with the original UserInterface
+  ExecuteWrapper(*wrapper, wrapped_ui);
+  EXPECT_EQ(m_recorder.GetLastUserInterface(), std::addressof(ui));
+
+  wrapped_ui.Log(log::SUP_SEQ_LOG_INFO, "message");
+  auto entries = ui.GetLogEntries();
+  ASSERT_EQ(entries.size(), 1);
+  EXPECT_EQ(entries[0].second, "prefix: message");
+}
+
+TEST_F(WrappedInstructionManagerTest, DifferentUserInterface)
+{
+  test::LogUserInterface ui_1;
+  test::LogUserInterface ui_2;
+  WrappedInstructionManager manager;
+  auto wrapper = manager.CreateInstructionWrapper(m_recorder);
+  auto& wrapped_ui_1 = manager.GetWrappedUI(ui_1, "prefix: ");
+  ExecuteWrapper(*wrapper, wrapped_ui_1);
+  EXPECT_EQ(m_recorder.GetLastUserInterface(), std::addressof(ui_1));
+
+  // Passing a different UserInterface rebinds the wrappers and the wrapped UserInterface
+  auto& wrapped_ui_2 = manager.GetWrappedUI(ui_2, "prefix: ");
+  ExecuteWrapper(*wrapper, wrapped_ui_2);
+  EXPECT_EQ(m_recorder.GetLastUserInterface(), std::addressof(ui_2));
+  wrapped_ui_2.Log(log::SUP_SEQ_LOG_INFO, "message");
+  EXPECT_EQ(ui_1.GetLogEntries().size(), 0);
+  ASSERT_EQ(ui_2.GetLogEntries().size(), 1);
+  EXPECT_EQ(ui_2.GetLogEntries()[0].second, "prefix: message");
+
+  // Previous wrapped UserInterface stays valid until a later call found its queue drained
+  wrapped_ui_1.Log(log::SUP_SEQ_LOG_INFO, "late message");
+  ASSERT_EQ(ui_1.GetLogEntries().size(), 1);
+  EXPECT_EQ(ui_1.GetLogEntries()[0].second, "prefix: late message");
+
+  // Switching back rebinds again
+  auto& wrapped_ui_3 = manager.GetWrappedUI(ui_1, "prefix: ");
+  ExecuteWrapper(*wrapper, wrapped_ui_3);
+  EXPECT_EQ(m_recorder.GetLastUserInterface(), std::addressof(ui_1));
+}
+
+TEST_F(WrappedInstructionManagerTest, RetiredUserInterfaceKeptUntilReleased)
+{
+  test::LogUserInterface ui_1;
+  test::LogUserInterface ui_2;
+  WrappedInstructionManager manager;
+  auto& wrapped_ui_1 = manager.GetWrappedUI(ui_1, "prefix: ");
+
+  // An asynchronous user keeps logging to the retired wrapped UserInterface while the
+  // UserInterface is switched and the manager keeps being ticked
+  std::atomic<bool> switched{false};
+  std::thread async_user([&wrapped_ui_1, &switched] {
+    while (!switched)
+    {
+      std::this_thread::yield();
+    }
+    for (int idx = 0; idx < 10; ++idx)
+    {
+      wrapped_ui_1.Log(log::SUP_SEQ_LOG_INFO, "late message");
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+  });
+  (void)manager.GetWrappedUI(ui_2, "prefix: ");
+  switched = true;
+  for (int idx = 0; idx < 20; ++idx)
+  {
+    (void)manager.GetWrappedUI(ui_2, "prefix: ");
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  async_user.join();
+  ASSERT_EQ(ui_1.GetLogEntries().size(), 10);
+  EXPECT_EQ(ui_1.GetLogEntries()[0].second, "prefix: late message");
+  manager.ReleaseRetiredUIs();
+
+  // Alternating between user interfaces reuses their wrapped user interfaces
+  auto& wrapped_ui_2 = manager.GetWrappedUI(ui_2, "prefix: ");
+  auto& wrapped_ui_1_again = manager.GetWrappedUI(ui_1, "prefix: ");
+  for (int idx = 0; idx < 100; ++idx)
+  {
+    auto& wrapped_ui = manager.GetWrappedUI(idx % 2 == 0 ? ui_1 : ui_2, "prefix: ");
+    EXPECT_EQ(std::addressof(wrapped_ui),
+              idx % 2 == 0 ? std::addressof(wrapped_ui_1_again) : std::addressof(wrapped_ui_2));
+    wrapped_ui.Log(log::SUP_SEQ_LOG_INFO, "message");
+  }
+  manager.ClearWrappers();
+  EXPECT_EQ(ui_1.GetLogEntries().size(), 60);
+  EXPECT_EQ(ui_2.GetLogEntries().size(), 50);
+}
+
+TEST_F(WrappedInstructionManagerTest, WrapperCreatedAfterBinding)
+{
+  test::LogUserInterface ui;
+  WrappedInstructionManager manager;
+  auto& wrapped_ui = manager.GetWrappedUI(ui, "prefix: ");
+  auto wrapper = manager.CreateInstructionWrapper(m_recorder);
+  ExecuteWrapper(*wrapper, wrapped_ui);
+  EXPECT_EQ(m_recorder.GetLastUserInterface(), std::addressof(ui));
+}
+
+TEST_F(WrappedInstructionManagerTest, ClearWrappers)
+{
+  test::LogUserInterface ui;
+  WrappedInstructionManager manager;
+  {
+    auto wrapper = manager.CreateInstructionWrapper(m_recorder);
+    (void)manager.GetWrappedUI(ui, "prefix: ");
+  }
+  manager.ClearWrappers();
+
+  // New wrappers are bound again on the next call
+  auto wrapper = manager.CreateInstructionWrapper(m_recorder);
+  auto& wrapped_ui = manager.GetWrappedUI(ui, "prefix: ");
+  ExecuteWrapper(*wrapper, wrapped_ui);
+  EXPECT_EQ(m_recorder.GetLastUserInterface(), std::addressof(ui));
+}
+
+WrappedInstructionManagerTest::WrappedInstructionManagerTest()
+  : m_proc{}
+  , m_ws{}
+  , m_recorder{}
+{}
+
+void WrappedInstructionManagerTest::ExecuteWrapper(Instruction& wrapper, UserInterface& ui)
+{
+  wrapper.Setup(m_proc);
+  wrapper.ExecuteSingle(ui, m_ws);
+  EXPECT_EQ(wrapper.GetStatus(), ExecutionStatus::SUCCESS);
+  wrapper.Reset(ui);
+}
+
+namespace
+{
+UserInterfaceRecorder::UserInterfaceRecorder()
+  : Instruction("UserInterfaceRecorder")
+  , m_last_ui{nullptr}
+{}
+
+UserInterface* UserInterfaceRecorder::GetLastUserInterface() const
+{
+  return m_last_ui;
+}
+
+ExecutionStatus UserInterfaceRecorder::ExecuteSingleImpl(UserInterface& ui, Workspace& ws)
+{
+  (void)ws;
+  m_last_ui = std::addressof(ui);
+  return ExecutionStatus::SUCCESS;
+}
+}  // unnamed namespace
@@ -0,0 +1,364 @@
+/******************************************************************************
+* $HeadURL: $
+* $Id: $
+*
+* Project       : Supervision and Automation - oac-tree
+*
+* Description   : SUP oac-tree control plugin
+*
+* Author        : Walter Van Herck (IO)
+*
+* Copyright (c) : 2010-2026 ITER Organization,
+*                 CS 90 046
+*                 13067 St. Paul-lez-Durance Cedex
+*                 France
+* SPDX-License-Identifier: MIT
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file LICENSE located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+#include "allocation_counter.h"
+#include "test_user_interface.h"
+
+#include "oac-tree/control/async_log_forwarder.h"
+#include "oac-tree/control/wrapped_user_interface.h"
+
+#include <sup/oac-tree/log_severity.h>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace sup::oac_tree;
+
+namespace
+{
+/**
+ * @brief Log interface that blocks the first call to Log until it is released. This allows to
+ * fill the asynchronous queue deterministically.
+ */
+class BlockingLogUserInterface : public test::LogUserInterface
+{
+public:
+  BlockingLogUserInterface() = default;
+  ~BlockingLogUserInterface() = default;
+
+  void Log(int severity, const std::string& message) override;
+
+  void WaitUntilBlocked();
+  void Release();
+
+private:
+  std::mutex m_block_mtx;
+  std::condition_variable m_block_cv;
+  bool m_blocked = false;
+  bool m_released = false;
+};
+
+const std::size_t kQueueSize = 4;
+}  // unnamed namespace
+
+class WrappedUserInterfaceTest : public ::testing::Test
+{
+protected:
+  WrappedUserInterfaceTest() = default;
+  virtual ~WrappedUserInterfaceTest() = default;
+};
+
+TEST_F(WrappedUserInterfaceTest, ForwardWithPrefix)
+{
+  test::LogUserInterface log_ui;
+  WrappedUserInterface wrapped_ui{log_ui, "prefix: "};
+  UserInterface& ui = wrapped_ui;
+  ui.Log(log::SUP_SEQ_LOG_WARNING, "first message");
+  ui.Log(log::SUP_SEQ_LOG_INFO, "second");
+  auto entries = log_ui.GetLogEntries();
+  ASSERT_EQ(entries.size(), 2);
+  EXPECT_EQ(entries[0].first, log::SUP_SEQ_LOG_WARNING);
+  EXPECT_EQ(entries[0].second, "prefix: first message");
+  EXPECT_EQ(entries[1].first, log::SUP_SEQ_LOG_INFO);
+  EXPECT_EQ(entries[1].second, "prefix: second");
+}
+
+TEST_F(WrappedUserInterfaceTest, NestedForwarding)
+{
+  test::LogUserInterface log_ui;
+  WrappedUserInterface inner_ui{log_ui, "inner: "};
+  WrappedUserInterface outer_ui{inner_ui, "outer: "};
+  UserInterface& ui = outer_ui;
+  ui.Log(log::SUP_SEQ_LOG_ERROR, "message");
+  auto entries = log_ui.GetLogEntries();
+  ASSERT_EQ(entries.size(), 1);
+  EXPECT_EQ(entries[0].second, "inner: outer: message");
+}
+
+TEST_F(WrappedUserInterfaceTest, AsyncForwarding)
+{
+  test::LogUserInterface log_ui;
+  {
+    LogForwardingOptions options;
+    options.m_queue_size = 64;
+    WrappedUserInterface wrapped_ui{log_ui, "prefix: ", options};
+    UserInterface& ui = wrapped_ui;
+    for (int idx = 0; idx < 10; ++idx)
+    {
+      ui.Log(log::SUP_SEQ_LOG_INFO, std::to_string(idx));
+    }
+    // Destruction forwards all remaining messages
+  }
+  auto entries = log_ui.GetLogEntries();
+  ASSERT_EQ(entries.size(), 10);
+  for (int idx = 0; idx < 10; ++idx)
+  {
+    EXPECT_EQ(entries[idx].first, log::SUP_SEQ_LOG_INFO);
+    EXPECT_EQ(entries[idx].second, "prefix: " + std::to_string(idx));
+  }
+}
+
+TEST_F(WrappedUserInterfaceTest, AsyncForwardingManyInterfaces)
+{
+  // All wrapped interfaces share one forwarding thread
+  const std::size_t n_interfaces = 100;
+  const std::size_t n_messages = 10;
+  test::LogUserInterface log_ui;
+  LogForwardingOptions options;
+  options.m_queue_size = 4;
+  std::vector<std::unique_ptr<WrappedUserInterface>> wrapped_uis;
+  for (std::size_t idx = 0; idx < n_interfaces; ++idx)
+  {
+    wrapped_uis.push_back(std::make_unique<WrappedUserInterface>(log_ui, "", options));
+  }
+  for (std::size_t msg_idx = 0; msg_idx < n_messages; ++msg_idx)
+  {
+    for (auto& wrapped_ui : wrapped_uis)
+    {
+      // Wait for room in the queue, so that no message is dropped
+      while (wrapped_ui->HasQueuedMessages())
+      {
+        std::this_thread::yield();
+      }
+      UserInterface& ui = *wrapped_ui;
+      ui.Log(log::SUP_SEQ_LOG_INFO, std::to_string(msg_idx));
+    }
+  }
+  // Messages are forwarded without destroying the interfaces
+  for (int idx = 0; idx < 1000 && log_ui.GetLogEntries().size() < n_interfaces * n_messages;
+       ++idx)
+  {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  EXPECT_EQ(log_ui.GetLogEntries().size(), n_interfaces * n_messages);
+  for (const auto& wrapped_ui : wrapped_uis)
+  {
+    EXPECT_EQ(wrapped_ui->GetDroppedMessageCount(), 0);
+  }
+  wrapped_uis.clear();
+  EXPECT_EQ(log_ui.GetLogEntries().size(), n_interfaces * n_messages);
+}
+
+TEST_F(WrappedUserInterfaceTest, AsyncSchedulingFromManyThreads)
+{
+  const std::size_t n_threads = 8;
+  const std::size_t n_messages = 200;
+  test::LogUserInterface log_ui;
+  std::vector<std::unique_ptr<AsyncLogForwarder>> forwarders;
+  for (std::size_t idx = 0; idx < n_threads; ++idx)
+  {
+    forwarders.push_back(
+      std::make_unique<AsyncLogForwarder>(log_ui, 2, LogOverflowPolicy::kDropNewest));
+  }
+  std::vector<std::thread> threads;
+  for (auto& forwarder : forwarders)
+  {
+    threads.emplace_back([&forwarder, n_messages]() {
+      for (std::size_t msg_idx = 0; msg_idx < n_messages; ++msg_idx)
+      {
+        // Wait until drained, so that every message schedules the forwarder again
+        while (!forwarder->IsEmpty())
+        {
+          std::this_thread::yield();
+        }
+        (void)forwarder->Push(log::SUP_SEQ_LOG_INFO, "message");
+      }
+    });
+  }
+  for (auto& thread : threads)
+  {
+    thread.join();
+  }
+  for (int idx = 0; idx < 1000 && log_ui.GetLogEntries().size() < n_threads * n_messages; ++idx)
+  {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  EXPECT_EQ(log_ui.GetLogEntries().size(), n_threads * n_messages);
+  for (const auto& forwarder : forwarders)
+  {
+    EXPECT_EQ(forwarder->GetDroppedCount(), 0);
+  }
+}
+
+TEST_F(WrappedUserInterfaceTest, AsyncSchedulingDoesNotAllocate)
+{
+  test::LogUserInterface log_ui;
+  AsyncLogForwarder forwarder{log_ui, 4, LogOverflowPolicy::kDropNewest};
+  // Short enough to be stored without allocation in the queued strings
+  const std::string message{"message"};
+  std::size_t n_queued = 0;
+  test::AllocationCounter counter{test::AllocationCounter::kCurrentThread};
+  for (int idx = 0; idx < 100; ++idx)
+  {
+    // Wait until drained, so that every message schedules the forwarder again
+    while (!forwarder.IsEmpty())
+    {
+      std::this_thread::yield();
+    }
+    n_queued += forwarder.Push(log::SUP_SEQ_LOG_INFO, message) ? 1 : 0;
+  }
+  EXPECT_EQ(counter.Allocations(), 0);
+  EXPECT_EQ(n_queued, 100);
+}
+
+TEST_F(WrappedUserInterfaceTest, AsyncDropNewest)
+{
+  BlockingLogUserInterface log_ui;
+  {
+    LogForwardingOptions options;
+    options.m_queue_size = kQueueSize;
+    WrappedUserInterface wrapped_ui{log_ui, "", options};
+    UserInterface& ui = wrapped_ui;
+    ui.Log(log::SUP_SEQ_LOG_INFO, "blocking");
+    log_ui.WaitUntilBlocked();
+    for (std::size_t idx = 0; idx < kQueueSize + 3; ++idx)
+    {
+      ui.Log(log::SUP_SEQ_LOG_INFO, std::to_string(idx));
+    }
+    EXPECT_EQ(wrapped_ui.GetDroppedMessageCount(), 3);
+    log_ui.Release();
+  }
+  auto entries = log_ui.GetLogEntries();
+  ASSERT_EQ(entries.size(), kQueueSize + 2);
+  EXPECT_EQ(entries[0].second, "blocking");
+  for (std::size_t idx = 0; idx < kQueueSize; ++idx)
+  {
+    EXPECT_EQ(entries[idx + 1].second, std::to_string(idx));
+  }
+  EXPECT_EQ(entries.back().first, log::SUP_SEQ_LOG_WARNING);
+  EXPECT_NE(entries.back().second.find("dropped 3 message"), std::string::npos);
+}
+
+TEST_F(WrappedUserInterfaceTest, AsyncDropOldest)
+{
+  BlockingLogUserInterface log_ui;
+  {
+    LogForwardingOptions options;
+    options.m_queue_size = kQueueSize;
+    options.m_overflow_policy = LogOverflowPolicy::kDropOldest;
+    WrappedUserInterface wrapped_ui{log_ui, "", options};
+    UserInterface& ui = wrapped_ui;
+    ui.Log(log::SUP_SEQ_LOG_INFO, "blocking");
+    log_ui.WaitUntilBlocked();
+    for (std::size_t idx = 0; idx < kQueueSize + 3; ++idx)
+    {
+      ui.Log(log::SUP_SEQ_LOG_INFO, std::to_string(idx));
+    }
+    EXPECT_EQ(wrapped_ui.GetDroppedMessageCount(), 3);
+    log_ui.Release();
+  }
+  auto entries = log_ui.GetLogEntries();
+  ASSERT_EQ(entries.size(), kQueueSize + 2);
+  EXPECT_EQ(entries[0].second, "blocking");
+  for (std::size_t idx = 0; idx < kQueueSize; ++idx)
+  {
+    EXPECT_EQ(entries[idx + 1].second, std::to_string(idx + 3));
+  }
+  EXPECT_EQ(entries.back().first, log::SUP_SEQ_LOG_WARNING);
+  EXPECT_NE(entries.back().second.find("dropped 3 message"), std::string::npos);
+}
+
+TEST_F(WrappedUserInterfaceTest, DeduplicateRepeatedMessages)
+{
+  test::LogUserInterface log_ui;
+  {
+    LogForwardingOptions options;
+    options.m_dedup_window = 3600.0;
+    WrappedUserInterface wrapped_ui{log_ui, "prefix: ", options};
+    UserInterface& ui = wrapped_ui;
+    for (int idx = 0; idx < 5; ++idx)
+    {
+      ui.Log(log::SUP_SEQ_LOG_WARNING, "condition failed");
+    }
+    ui.Log(log::SUP_SEQ_LOG_INFO, "done");
+    ui.Log(log::SUP_SEQ_LOG_INFO, "done");
+    // Destruction reports the remaining repetitions
+  }
+  auto entries = log_ui.GetLogEntries();
+  ASSERT_EQ(entries.size(), 4);
+  EXPECT_EQ(entries[0].first, log::SUP_SEQ_LOG_WARNING);
+  EXPECT_EQ(entries[0].second, "prefix: condition failed");
+  EXPECT_EQ(entries[1].first, log::SUP_SEQ_LOG_WARNING);
+  EXPECT_EQ(entries[1].second, "prefix: Last message repeated 4 time(s): condition failed");
+  EXPECT_EQ(entries[2].first, log::SUP_SEQ_LOG_INFO);
+  EXPECT_EQ(entries[2].second, "prefix: done");
+  EXPECT_EQ(entries[3].first, log::SUP_SEQ_LOG_INFO);
+  EXPECT_EQ(entries[3].second, "prefix: Last message repeated 1 time(s): done");
+}
+
+TEST_F(WrappedUserInterfaceTest, DeduplicateWithAsyncForwarding)
+{
+  test::LogUserInterface log_ui;
+  {
+    LogForwardingOptions options;
+    options.m_queue_size = 16;
+    options.m_dedup_window = 3600.0;
+    WrappedUserInterface wrapped_ui{log_ui, "", options};
+    UserInterface& ui = wrapped_ui;
+    for (int idx = 0; idx < 100; ++idx)
+    {
+      ui.Log(log::SUP_SEQ_LOG_WARNING, "condition failed");
+    }
+  }
+  auto entries = log_ui.GetLogEntries();
+  ASSERT_EQ(entries.size(), 2);
+  EXPECT_EQ(entries[0].second, "condition failed");
+  EXPECT_EQ(entries[1].second, "Last message repeated 99 time(s): condition failed");
+}
+
+namespace
+{
+void BlockingLogUserInterface::Log(int severity, const std::string& message)
+{
+  {
+    std::unique_lock<std::mutex> lk{m_block_mtx};
+    if (!m_blocked)
+    {
+      m_blocked = true;
+      m_block_cv.notify_all();
+      m_block_cv.wait(lk, [this]{ return m_released; });
+    }
+  }
+  test::LogUserInterface::Log(severity, message);
+}
+
+void BlockingLogUserInterface::WaitUntilBlocked()
+{
+  std::unique_lock<std::mutex> lk{m_block_mtx};
+  m_block_cv.wait(lk, [this]{ return m_blocked; });
+}
+
+void BlockingLogUserInterface::Release()
+{
+  {
+    std::lock_guard<std::mutex> lk{m_block_mtx};
+    m_released = true;
+  }
+  m_block_cv.notify_all();
+}
+}  // unnamed namespace